@@ -25,9 +25,14 @@
 #include "UObject/FieldPath.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "MCPMaterialIndexSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Blueprint Command"), STAT_MCP_BlueprintCommand, STATGROUP_UnrealMCP);
 
 FEpicUnrealMCPBlueprintCommands::FEpicUnrealMCPBlueprintCommands()
 {
@@ -35,6 +40,8 @@ FEpicUnrealMCPBlueprintCommands::FEpicUnrealMCPBlueprintCommands()
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_BlueprintCommand);
+
     if (CommandType == TEXT("create_blueprint"))
     {
         return HandleCreateBlueprint(Params);
@@ -688,8 +695,41 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params)
 {
+    return BeginGetAvailableMaterials(Params).RunInline();
+}
+
+FMCPSlicedCommand FEpicUnrealMCPBlueprintCommands::BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("get_available_materials"))
+    {
+        return BeginGetAvailableMaterials(Params);
+    }
+
+    return FMCPSlicedCommand::FromResult(HandleCommand(CommandType, Params));
+}
+
+bool FEpicUnrealMCPBlueprintCommands::IsSlicedCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_available_materials");
+}
+
+// Answered from the material index once it is built. Until then the registry
+// query is cheap; loading each listed asset to check its class is the slow
+// part, so that is what gets spread across frames
+FMCPSlicedCommand FEpicUnrealMCPBlueprintCommands::BeginGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params)
+{
+    struct FState
+    {
+        FString SearchPath;
+        TArray<FAssetData> AssetDataArray;
+        TSet<FString> KnownPaths;
+        TArray<FString> CandidatePaths;
+    };
+    TSharedRef<FState> State = MakeShared<FState>();
+    FString& SearchPath = State->SearchPath;
+    TArray<FAssetData>& AssetDataArray = State->AssetDataArray;
+
     // Get parameters - make search path completely dynamic
-    FString SearchPath;
     if (!Params->TryGetStringField(TEXT("search_path"), SearchPath))
     {
         // Default to empty string to search everywhere
@@ -702,6 +742,27 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         bIncludeEngineMaterials = Params->GetBoolField(TEXT("include_engine_materials"));
     }
 
+    if (!SearchPath.IsEmpty())
+    {
+        // Ensure the path starts with /
+        if (!SearchPath.StartsWith(TEXT("/")))
+        {
+            SearchPath = TEXT("/") + SearchPath;
+        }
+        // Ensure the path ends with / for proper directory search
+        if (!SearchPath.EndsWith(TEXT("/")))
+        {
+            SearchPath += TEXT("/");
+        }
+    }
+
+    // Once the material index is built, answer from memory instead of scanning content
+    UMCPMaterialIndexSubsystem* MaterialIndex = GEditor ? GEditor->GetEditorSubsystem<UMCPMaterialIndexSubsystem>() : nullptr;
+    if (MaterialIndex && MaterialIndex->IsReady())
+    {
+        return FMCPSlicedCommand::FromResult(QueryMaterialIndex(*MaterialIndex, Params, SearchPath, bIncludeEngineMaterials));
+    }
+
     // Get asset registry module
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -716,16 +777,6 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
     // Add search paths dynamically
     if (!SearchPath.IsEmpty())
     {
-        // Ensure the path starts with /
-        if (!SearchPath.StartsWith(TEXT("/")))
-        {
-            SearchPath = TEXT("/") + SearchPath;
-        }
-        // Ensure the path ends with / for proper directory search
-        if (!SearchPath.EndsWith(TEXT("/")))
-        {
-            SearchPath += TEXT("/");
-        }
         Filter.PackagePaths.Add(*SearchPath);
         UE_LOG(LogTemp, Log, TEXT("Searching for materials in: %s"), *SearchPath);
     }
@@ -745,7 +796,6 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
     Filter.bRecursivePaths = true;
 
     // Get assets from registry
-    TArray<FAssetData> AssetDataArray;
     AssetRegistry.GetAssets(Filter, AssetDataArray);
     
     UE_LOG(LogTemp, Log, TEXT("Asset registry found %d materials"), AssetDataArray.Num());
@@ -761,39 +811,92 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         AllAssetPaths = UEditorAssetLibrary::ListAssets(TEXT("/Game/"), true, false);
     }
     
+    State->KnownPaths.Reserve(AssetDataArray.Num());
+    for (const FAssetData& ExistingData : AssetDataArray)
+    {
+        State->KnownPaths.Add(ExistingData.GetObjectPathString());
+    }
+
+    for (FString& AssetPath : AllAssetPaths)
+    {
+        if (AssetPath.Contains(TEXT("Material")) && !AssetPath.Contains(TEXT(".uasset")) && !State->KnownPaths.Contains(AssetPath))
+        {
+            State->CandidatePaths.Add(MoveTemp(AssetPath));
+        }
+    }
+
+    FMCPSlicedCommand Command;
+    Command.Total = State->CandidatePaths.Num();
+
     // Filter for materials from the manual search
-    for (const FString& AssetPath : AllAssetPaths)
+    Command.ProcessItem = [State](int32 Index)
     {
-        if (AssetPath.Contains(TEXT("Material")) && !AssetPath.Contains(TEXT(".uasset")))
+        const FString& AssetPath = State->CandidatePaths[Index];
+        UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
+        if (Asset && Asset->IsA<UMaterialInterface>())
         {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-            if (Asset && Asset->IsA<UMaterialInterface>())
-            {
-                // Check if we already have this asset from registry search
-                bool bAlreadyFound = false;
-                for (const FAssetData& ExistingData : AssetDataArray)
-                {
-                    if (ExistingData.GetObjectPathString() == AssetPath)
-                    {
-                        bAlreadyFound = true;
-                        break;
-                    }
-                }
-                
-                if (!bAlreadyFound)
-                {
-                    // Create FAssetData manually for this asset
-                    FAssetData ManualAssetData(Asset);
-                    AssetDataArray.Add(ManualAssetData);
-                }
-            }
+            // Create FAssetData manually for this asset
+            State->AssetDataArray.Add(FAssetData(Asset));
         }
+    };
+
+    Command.Finish = [State](int32 NumProcessed, bool bCancelled)
+    {
+        const FString& SearchPath = State->SearchPath;
+        const TArray<FAssetData>& AssetDataArray = State->AssetDataArray;
+
+        UE_LOG(LogTemp, Log, TEXT("Total materials found after manual search: %d"), AssetDataArray.Num());
+
+        // Convert to JSON
+        TArray<TSharedPtr<FJsonValue>> MaterialArray;
+        for (const FAssetData& AssetData : AssetDataArray)
+        {
+            TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
+            MaterialObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+            MaterialObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+            MaterialObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+            MaterialObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+        
+            MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
+        
+            UE_LOG(LogTemp, Verbose, TEXT("Found material: %s at %s"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString());
+        }
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetArrayField(TEXT("materials"), MaterialArray);
+        ResultObj->SetNumberField(TEXT("count"), MaterialArray.Num());
+        ResultObj->SetStringField(TEXT("search_path_used"), SearchPath.IsEmpty() ? TEXT("/Game/") : SearchPath);
+    
+        if (bCancelled)
+        {
+            ResultObj->SetBoolField(TEXT("cancelled"), true);
+        }
+
+        return ResultObj;
+    };
+    return Command;
+}
+
+// Index-backed get_available_materials: same result shape, plus optional "name" filter and paging
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::QueryMaterialIndex(const UMCPMaterialIndexSubsystem& MaterialIndex,
+    const TSharedPtr<FJsonObject>& Params, const FString& SearchPath, bool bIncludeEngineMaterials)
+{
+    FMCPMaterialQuery Query;
+    Query.SearchPath = SearchPath.IsEmpty() ? TEXT("/Game/") : SearchPath;
+    Query.bIncludeEngine = bIncludeEngineMaterials;
+    Params->TryGetStringField(TEXT("name"), Query.NameFilter);
+    if (Params->TryGetNumberField(TEXT("page_size"), Query.PageSize))
+    {
+        Query.PageSize = FMath::Clamp(Query.PageSize, 1, MaxMaterialPageSize);
     }
+    Params->TryGetStringField(TEXT("cursor"), Query.Cursor);
 
-    UE_LOG(LogTemp, Log, TEXT("Total materials found after manual search: %d"), AssetDataArray.Num());
+    TArray<FAssetData> AssetDataArray;
+    FString NextCursor;
+    MaterialIndex.Query(Query, AssetDataArray, NextCursor);
 
-    // Convert to JSON
     TArray<TSharedPtr<FJsonValue>> MaterialArray;
+    MaterialArray.Reserve(AssetDataArray.Num());
     for (const FAssetData& AssetData : AssetDataArray)
     {
         TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
@@ -801,17 +904,21 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         MaterialObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
         MaterialObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
         MaterialObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
-        
         MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
-        
-        UE_LOG(LogTemp, Verbose, TEXT("Found material: %s at %s"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString());
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("materials"), MaterialArray);
     ResultObj->SetNumberField(TEXT("count"), MaterialArray.Num());
-    ResultObj->SetStringField(TEXT("search_path_used"), SearchPath.IsEmpty() ? TEXT("/Game/") : SearchPath);
-    
+    ResultObj->SetStringField(TEXT("search_path_used"), Query.SearchPath);
+    if (Query.PageSize > 0)
+    {
+        ResultObj->SetBoolField(TEXT("has_more"), !NextCursor.IsEmpty());
+        if (!NextCursor.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("next_cursor"), NextCursor);
+        }
+    }
     return ResultObj;
 }
 
@@ -878,6 +985,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleApplyMaterialToAc
         if (MeshComp)
         {
             MeshComp->SetMaterial(MaterialSlot, Material);
+            // Raises the property-changed event the world snapshot and change feed listen for
+            MeshComp->PostEditChange();
             bAppliedToAny = true;
         }
     }
@@ -521,6 +521,110 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToJsonObject(AActor* Act
     return ActorObject;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToProjectedJson(AActor* Actor, EMCPActorFields Fields)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    auto MakeTriple = [](double A, double B, double C)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(3);
+        Array.Add(MakeShared<FJsonValueNumber>(A));
+        Array.Add(MakeShared<FJsonValueNumber>(B));
+        Array.Add(MakeShared<FJsonValueNumber>(C));
+        return Array;
+    };
+
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        const FVector Location = Actor->GetActorLocation();
+        ActorObject->SetArrayField(TEXT("location"), MakeTriple(Location.X, Location.Y, Location.Z));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        const FRotator Rotation = Actor->GetActorRotation();
+        ActorObject->SetArrayField(TEXT("rotation"), MakeTriple(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        const FVector Scale = Actor->GetActorScale3D();
+        ActorObject->SetArrayField(TEXT("scale"), MakeTriple(Scale.X, Scale.Y, Scale.Z));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Label))
+    {
+        ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Folder))
+    {
+        ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Tags))
+    {
+        TArray<TSharedPtr<FJsonValue>> TagArray;
+        TagArray.Reserve(Actor->Tags.Num());
+        for (const FName& Tag : Actor->Tags)
+        {
+            TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        ActorObject->SetArrayField(TEXT("tags"), TagArray);
+    }
+
+    return ActorObject;
+}
+
+bool FEpicUnrealMCPCommonUtils::ParseActorFields(const TArray<TSharedPtr<FJsonValue>>& FieldNames, EMCPActorFields& OutFields, FString& OutUnknown)
+{
+    static const TPair<const TCHAR*, EMCPActorFields> KnownFields[] =
+    {
+        { TEXT("name"), EMCPActorFields::Name },
+        { TEXT("class"), EMCPActorFields::Class },
+        { TEXT("location"), EMCPActorFields::Location },
+        { TEXT("rotation"), EMCPActorFields::Rotation },
+        { TEXT("scale"), EMCPActorFields::Scale },
+        { TEXT("label"), EMCPActorFields::Label },
+        { TEXT("folder"), EMCPActorFields::Folder },
+        { TEXT("tags"), EMCPActorFields::Tags },
+    };
+
+    OutFields = EMCPActorFields::None;
+    for (const TSharedPtr<FJsonValue>& FieldValue : FieldNames)
+    {
+        const FString FieldName = FieldValue.IsValid() ? FieldValue->AsString() : FString();
+
+        bool bKnown = false;
+        for (const TPair<const TCHAR*, EMCPActorFields>& Known : KnownFields)
+        {
+            if (FieldName.Equals(Known.Key, ESearchCase::IgnoreCase))
+            {
+                OutFields |= Known.Value;
+                bKnown = true;
+                break;
+            }
+        }
+
+        if (!bKnown)
+        {
+            OutUnknown = FieldName;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 UK2Node_Event* FEpicUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
 {
     if (!Graph)
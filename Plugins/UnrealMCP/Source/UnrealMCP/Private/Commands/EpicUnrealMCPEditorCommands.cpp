@@ -29,6 +29,12 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EditorAssetLibrary.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "EngineUtils.h"
+#include "MCPActorNameIndexSubsystem.h"
+#include "Algo/Sort.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Editor Command"), STAT_MCP_EditorCommand, STATGROUP_UnrealMCP);
 
 FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 {
@@ -36,6 +42,8 @@ FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_EditorCommand);
+
     // Actor manipulation commands
     if (CommandType == TEXT("get_actors_in_level"))
     {
@@ -68,24 +76,200 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
+    return BeginGetActorsInLevel(Params).RunInline();
+}
+
+FMCPSlicedCommand FEpicUnrealMCPEditorCommands::BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("get_actors_in_level"))
     {
-        if (Actor)
+        return BeginGetActorsInLevel(Params);
+    }
+
+    return FMCPSlicedCommand::FromResult(HandleCommand(CommandType, Params));
+}
+
+bool FEpicUnrealMCPEditorCommands::IsSlicedCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_actors_in_level");
+}
+
+// Optional query parameters:
+//   class      - native or Blueprint class name (or full path); uses the engine's per-class actor lists
+//   tag        - actor tag that must be present
+//   bounds     - {"min": [x,y,z], "max": [x,y,z]} box the actor location must fall in
+//   fields     - subset of name, class, location, rotation, scale, label, folder, tags
+//   page_size  - return at most this many actors plus a next_cursor; omitted returns everything
+//   cursor     - next_cursor from the previous page
+// Collecting the matching actors is cheap; serializing each one is the part spread across frames
+FMCPSlicedCommand FEpicUnrealMCPEditorCommands::BeginGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
+{
+    // Same world the snapshot is built from, so both paths answer about the same level
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FMCPSlicedCommand::FromResult(FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No world loaded")));
+    }
+
+    UClass* ActorClass = AActor::StaticClass();
+    FString ClassName;
+    if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+    {
+        ActorClass = FindActorClass(ClassName);
+        if (!ActorClass)
         {
-            ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            return FMCPSlicedCommand::FromResult(FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown actor class: %s"), *ClassName)));
         }
     }
-    
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
-    
-    return ResultObj;
+
+    FName Tag = NAME_None;
+    FString TagString;
+    if (Params->TryGetStringField(TEXT("tag"), TagString) && !TagString.IsEmpty())
+    {
+        Tag = *TagString;
+    }
+
+    TOptional<FBox> Bounds;
+    const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("bounds"), BoundsObj) && BoundsObj)
+    {
+        Bounds = FBox(
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min")),
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max")));
+    }
+
+    EMCPActorFields Fields = EMCPActorFields::Default;
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray)
+    {
+        FString UnknownField;
+        if (!FEpicUnrealMCPCommonUtils::ParseActorFields(*FieldsArray, Fields, UnknownField))
+        {
+            return FMCPSlicedCommand::FromResult(FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown field: %s"), *UnknownField)));
+        }
+    }
+
+    int32 PageSize = 0;
+    if (Params->TryGetNumberField(TEXT("page_size"), PageSize))
+    {
+        PageSize = FMath::Clamp(PageSize, 1, MaxActorPageSize);
+    }
+
+    FString CursorString;
+    Params->TryGetStringField(TEXT("cursor"), CursorString);
+    const FName Cursor = CursorString.IsEmpty() ? NAME_None : FName(*CursorString);
+
+    struct FState
+    {
+        TArray<TWeakObjectPtr<AActor>> Actors;
+        TArray<TSharedPtr<FJsonValue>> ActorArray;
+        EMCPActorFields Fields = EMCPActorFields::Default;
+        int32 PageSize = 0;
+
+        // Name of the last actor in the page, set only when more remain
+        FString NextCursor;
+    };
+    TSharedRef<FState> State = MakeShared<FState>();
+    State->Fields = Fields;
+    State->PageSize = PageSize;
+
+    TArray<AActor*> Matches;
+    for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (Tag != NAME_None && !Actor->ActorHasTag(Tag))
+        {
+            continue;
+        }
+        if (Bounds.IsSet() && !Bounds->IsInsideOrOn(Actor->GetActorLocation()))
+        {
+            continue;
+        }
+        // Pages are ordered by name, so everything up to the cursor was already returned
+        if (PageSize > 0 && !Cursor.IsNone() && !Cursor.LexicalLess(Actor->GetFName()))
+        {
+            continue;
+        }
+        Matches.Add(Actor);
+    }
+
+    if (PageSize > 0)
+    {
+        // Lexical, not FastLess: FastLess follows name-table order, which differs between
+        // sessions and from the snapshot's, so a cursor could skip or repeat actors
+        Algo::Sort(Matches, [](const AActor* A, const AActor* B) { return A->GetFName().LexicalLess(B->GetFName()); });
+
+        if (Matches.Num() > PageSize)
+        {
+            Matches.SetNum(PageSize, EAllowShrinking::No);
+            State->NextCursor = Matches.Last()->GetName();
+        }
+    }
+
+    State->Actors.Reserve(Matches.Num());
+    for (AActor* Actor : Matches)
+    {
+        State->Actors.Add(Actor);
+    }
+    State->ActorArray.Reserve(Matches.Num());
+
+    FMCPSlicedCommand Command;
+    Command.Total = State->Actors.Num();
+    Command.ProcessItem = [State](int32 Index)
+    {
+        // Actors deleted between frames are skipped
+        if (AActor* Actor = State->Actors[Index].Get())
+        {
+            State->ActorArray.Add(MakeShared<FJsonValueObject>(FEpicUnrealMCPCommonUtils::ActorToProjectedJson(Actor, State->Fields)));
+        }
+    };
+    Command.Finish = [State](int32 NumProcessed, bool bCancelled)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetArrayField(TEXT("actors"), State->ActorArray);
+        if (State->PageSize > 0)
+        {
+            ResultObj->SetNumberField(TEXT("count"), State->ActorArray.Num());
+            ResultObj->SetBoolField(TEXT("has_more"), !State->NextCursor.IsEmpty());
+            if (!State->NextCursor.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("next_cursor"), State->NextCursor);
+            }
+        }
+        if (bCancelled)
+        {
+            ResultObj->SetBoolField(TEXT("cancelled"), true);
+        }
+        return ResultObj;
+    };
+    return Command;
+}
+
+// Short names resolve native classes first, then loaded Blueprint classes; paths are loaded directly
+UClass* FEpicUnrealMCPEditorCommands::FindActorClass(const FString& ClassName)
+{
+    UClass* Class = nullptr;
+    if (ClassName.Contains(TEXT("/")))
+    {
+        Class = LoadObject<UClass>(nullptr, *ClassName);
+    }
+    else
+    {
+        Class = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+        if (!Class && ClassName.Len() > 1 && ClassName[0] == TEXT('A') && FChar::IsUpper(ClassName[1]))
+        {
+            // Accept the C++ spelling, e.g. AStaticMeshActor
+            Class = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+        }
+    }
+
+    return Class && Class->IsChildOf(AActor::StaticClass()) ? Class : nullptr;
 }
 
+// The order of matches is unspecified: this path returns the name index's order
+// (see UMCPActorNameIndexSubsystem::FindActors), the snapshot path level order
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
 {
     FString Pattern;
@@ -94,40 +278,174 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(con
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
     }
     
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> MatchingActors;
-    for (AActor* Actor : AllActors)
+    // Optional: "match" is substring (default), prefix or glob; "search" is name (default), label or both
+    EMCPNameMatch Match = EMCPNameMatch::Substring;
+    FString MatchString;
+    if (Params->TryGetStringField(TEXT("match"), MatchString))
+    {
+        if (MatchString == TEXT("prefix"))
+        {
+            Match = EMCPNameMatch::Prefix;
+        }
+        else if (MatchString == TEXT("glob"))
+        {
+            Match = EMCPNameMatch::Glob;
+        }
+        else if (MatchString != TEXT("substring"))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown match mode: %s"), *MatchString));
+        }
+    }
+
+    EMCPNameFields Fields = EMCPNameFields::Name;
+    FString SearchString;
+    if (Params->TryGetStringField(TEXT("search"), SearchString))
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        if (SearchString == TEXT("label"))
         {
-            MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            Fields = EMCPNameFields::Label;
         }
+        else if (SearchString == TEXT("both"))
+        {
+            Fields = EMCPNameFields::Both;
+        }
+        else if (SearchString != TEXT("name"))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown search field: %s"), *SearchString));
+        }
+    }
+
+    UMCPActorNameIndexSubsystem* NameIndex = GEditor ? GEditor->GetEditorSubsystem<UMCPActorNameIndexSubsystem>() : nullptr;
+    if (!NameIndex)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Actor name index is not available"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    TArray<AActor*> FoundActors;
+    NameIndex->FindActors(World, Pattern, Match, Fields, FoundActors);
+
+    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+    MatchingActors.Reserve(FoundActors.Num());
+    for (AActor* Actor : FoundActors)
+    {
+        MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
     }
     
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
+
+    bool bIndexStats = false;
+    if (Params->TryGetBoolField(TEXT("index_stats"), bIndexStats) && bIndexStats)
+    {
+        TSharedPtr<FJsonObject> IndexObj = MakeShared<FJsonObject>();
+        IndexObj->SetNumberField(TEXT("actors"), NameIndex->GetNumIndexedActors());
+        IndexObj->SetNumberField(TEXT("trigrams"), NameIndex->GetNumTrigrams());
+        IndexObj->SetNumberField(TEXT("bytes"), static_cast<double>(NameIndex->GetAllocatedSize()));
+        ResultObj->SetObjectField(TEXT("index"), IndexObj);
+    }
     
     return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSharedPtr<FJsonObject>& Params)
+{
+    FMCPActorSpawnSpec Spec;
+    FString Error;
+    if (!ParseSpawnSpec(Params, Spec, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Check if an actor with this name already exists
+    TSet<FName> ExistingNames;
+    CollectActorNames(World, ExistingNames);
+    if (ExistingNames.Contains(Spec.Name))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *Spec.Name.ToString()));
+    }
+
+    UStaticMesh* Mesh = nullptr;
+    if (!Spec.StaticMeshPath.IsEmpty())
+    {
+        Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Spec.StaticMeshPath));
+        if (!Mesh)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *Spec.StaticMeshPath);
+        }
+    }
+
+    AActor* NewActor = SpawnFromSpec(World, Spec, Mesh);
+    if (NewActor)
+    {
+        // Return the created actor's details
+        return FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
+    }
+
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create actor"));
+}
+
+bool FEpicUnrealMCPEditorCommands::ParseSpawnSpec(const TSharedPtr<FJsonObject>& Params, FMCPActorSpawnSpec& OutSpec, FString& OutError)
 {
     // Get required parameters
     FString ActorType;
     if (!Params->TryGetStringField(TEXT("type"), ActorType))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'type' parameter"));
+        OutError = TEXT("Missing 'type' parameter");
+        return false;
     }
 
     // Get actor name (required parameter)
     FString ActorName;
     if (!Params->TryGetStringField(TEXT("name"), ActorName))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+        OutError = TEXT("Missing 'name' parameter");
+        return false;
+    }
+
+    if (ActorType == TEXT("StaticMeshActor"))
+    {
+        OutSpec.ActorClass = AStaticMeshActor::StaticClass();
+
+        // Optional static_mesh parameter to assign a mesh
+        Params->TryGetStringField(TEXT("static_mesh"), OutSpec.StaticMeshPath);
+    }
+    else if (ActorType == TEXT("PointLight"))
+    {
+        OutSpec.ActorClass = APointLight::StaticClass();
+    }
+    else if (ActorType == TEXT("SpotLight"))
+    {
+        OutSpec.ActorClass = ASpotLight::StaticClass();
+    }
+    else if (ActorType == TEXT("DirectionalLight"))
+    {
+        OutSpec.ActorClass = ADirectionalLight::StaticClass();
+    }
+    else if (ActorType == TEXT("CameraActor"))
+    {
+        OutSpec.ActorClass = ACameraActor::StaticClass();
+    }
+    else
+    {
+        OutError = FString::Printf(TEXT("Unknown actor type: %s"), *ActorType);
+        return false;
     }
 
+    OutSpec.Name = *ActorName;
+
     // Get optional transform parameters
     FVector Location(0.0f, 0.0f, 0.0f);
     FRotator Rotation(0.0f, 0.0f, 0.0f);
@@ -145,91 +463,64 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
     {
         Scale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale"));
     }
+    OutSpec.Transform = FTransform(Rotation, Location, Scale);
 
-    // Create the actor based on type
-    AActor* NewActor = nullptr;
-    UWorld* World = GEditor->GetEditorWorldContext().World();
-
-    if (!World)
+    // Handle optional folder path for World Outliner organization
+    FString FolderPath;
+    if (Params->TryGetStringField(TEXT("folder_path"), FolderPath))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+        OutSpec.FolderPath = FName(*FolderPath);
     }
 
-    // Check if an actor with this name already exists
+    return true;
+}
+
+void FEpicUnrealMCPEditorCommands::CollectActorNames(UWorld* World, TSet<FName>& OutNames)
+{
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+
+    OutNames.Reserve(OutNames.Num() + AllActors.Num());
     for (AActor* Actor : AllActors)
     {
-        if (Actor && Actor->GetName() == ActorName)
+        if (Actor)
         {
-            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+            OutNames.Add(Actor->GetFName());
         }
     }
+}
 
+AActor* FEpicUnrealMCPEditorCommands::SpawnFromSpec(UWorld* World, const FMCPActorSpawnSpec& Spec, UStaticMesh* Mesh)
+{
     FActorSpawnParameters SpawnParams;
-    SpawnParams.Name = *ActorName;
+    SpawnParams.Name = Spec.Name;
+    SpawnParams.bDeferConstruction = true;
 
-    if (ActorType == TEXT("StaticMeshActor"))
-    {
-        AStaticMeshActor* NewMeshActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, SpawnParams);
-        if (NewMeshActor)
-        {
-            // Check for an optional static_mesh parameter to assign a mesh
-            FString MeshPath;
-            if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
-            {
-                UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
-                if (Mesh)
-                {
-                    NewMeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *MeshPath);
-                }
-            }
-        }
-        NewActor = NewMeshActor;
-    }
-    else if (ActorType == TEXT("PointLight"))
-    {
-        NewActor = World->SpawnActor<APointLight>(APointLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("SpotLight"))
-    {
-        NewActor = World->SpawnActor<ASpotLight>(ASpotLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("DirectionalLight"))
+    AActor* NewActor = World->SpawnActor(Spec.ActorClass, &Spec.Transform, SpawnParams);
+    if (!NewActor)
     {
-        NewActor = World->SpawnActor<ADirectionalLight>(ADirectionalLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("CameraActor"))
-    {
-        NewActor = World->SpawnActor<ACameraActor>(ACameraActor::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
+        return nullptr;
     }
 
-    if (NewActor)
+    // Components are still unregistered here, so this costs nothing extra
+    if (Mesh)
     {
-        // Set scale (since SpawnActor only takes location and rotation)
-        FTransform Transform = NewActor->GetTransform();
-        Transform.SetScale3D(Scale);
-        NewActor->SetActorTransform(Transform);
-        // Handle optional folder path for World Outliner organization
-        FString FolderPath;
-        if (Params->TryGetStringField(TEXT("folder_path"), FolderPath))
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(NewActor))
         {
-            NewActor->SetFolderPath(FName(*FolderPath));
-            UE_LOG(LogTemp, Display, TEXT("Actor '%s' placed in folder: %s"), *ActorName, *FolderPath);
+            MeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
         }
-        // Return the created actor's details
-        return FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
     }
 
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create actor"));
+    // Scale goes in with the spawn transform instead of a second SetActorTransform
+    NewActor->FinishSpawning(Spec.Transform);
+
+    if (!Spec.FolderPath.IsNone())
+    {
+        NewActor->SetFolderPath(Spec.FolderPath);
+        UE_LOG(LogTemp, Verbose, TEXT("Actor '%s' placed in folder: %s"), *Spec.Name.ToString(), *Spec.FolderPath.ToString());
+    }
+
+    return NewActor;
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TSharedPtr<FJsonObject>& Params)
@@ -240,8 +531,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
     TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
     
     for (AActor* Actor : AllActors)
     {
@@ -273,8 +570,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
 
     // Find the actor
     AActor* TargetActor = nullptr;
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
     TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
     
     for (AActor* Actor : AllActors)
     {
@@ -306,8 +609,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
         NewTransform.SetScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
     }
 
-    // Set the new transform
+    // Set the new transform; SetActorTransform raises no editor event, so broadcast the move as the gizmo does
     TargetActor->SetActorTransform(NewTransform);
+    GEngine->BroadcastOnActorMoved(TargetActor);
 
     // Return updated actor info
     return FEpicUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
@@ -10,7 +10,10 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Editor.h"
 #include "Engine/DirectionalLight.h"
 #include "Engine/PointLight.h"
 #include "Engine/SpotLight.h"
@@ -50,6 +53,11 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPChangeFeedSubsystem.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Execute Command (Game Thread)"), STAT_MCP_ExecuteCommand, STATGROUP_UnrealMCP);
+DECLARE_CYCLE_STAT(TEXT("MCP Spawn Actors Batch"), STAT_MCP_SpawnActorsBatch, STATGROUP_UnrealMCP);
 
 // Server defaults - can be changed in config later
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -91,35 +99,22 @@ FString UEpicUnrealMCPBridge::CreateSuccessResponse(const TSharedPtr<FJsonObject
 // Helper: Serialize JSON object to string
 FString UEpicUnrealMCPBridge::SerializeJsonObject(const TSharedPtr<FJsonObject>& JsonObject)
 {
+    // Condensed - one response per line on the wire, and smaller than pretty output
     FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
     FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
     return OutputString;
 }
 
-// Helper: Spawn a single actor (delegates to EditorCommands)
-FString UEpicUnrealMCPBridge::SpawnActor(const TSharedPtr<FJsonObject>& Params)
-{
-    TSharedPtr<FJsonObject> Result = EditorCommands->HandleCommand(TEXT("spawn_actor"), Params);
-
-    if (Result.IsValid())
-    {
-        // Check if command was successful
-        if (Result->HasField(TEXT("success")) && Result->GetBoolField(TEXT("success")))
-        {
-            return CreateSuccessResponse(Result);
-        }
-        else if (Result->HasField(TEXT("error")))
-        {
-            return CreateErrorResponse(Result->GetStringField(TEXT("error")));
-        }
-    }
-
-    return CreateErrorResponse(TEXT("Unknown error in SpawnActor"));
-}
-
-// Batch spawn multiple actors in one command - reduces TCP overhead
-FString UEpicUnrealMCPBridge::SpawnActorsBatch(const TSharedPtr<FJsonObject>& Params)
+// Batch spawn multiple actors in one command - reduces TCP overhead.
+// Every entry is parsed up front; each item is then a typed, deferred spawn, so
+// large batches can be spread across frames. Each frame's slice is one undo step
+// - the whole batch when it fits in a frame. A transaction is never left open
+// across frames, where it would swallow whatever the user edits in between, and
+// a finished transaction cannot be extended, so a batch that spans N frames takes
+// N undos to remove. "undo_steps" in the response tells the caller how many.
+FMCPSlicedCommand UEpicUnrealMCPBridge::BeginSpawnActorsBatch(UWorld* World, const TSharedPtr<FJsonObject>& Params)
 {
     // Get the array of actors to spawn
     const TArray<TSharedPtr<FJsonValue>>* ActorsArrayPtr = nullptr;
@@ -127,69 +122,232 @@ FString UEpicUnrealMCPBridge::SpawnActorsBatch(const TSharedPtr<FJsonObject>& Pa
     // Correct API usage: pass pointer reference, not direct array
     if (!Params->TryGetArrayField(TEXT("actors"), ActorsArrayPtr) || !ActorsArrayPtr)
     {
-        return CreateErrorResponse(TEXT("Missing 'actors' array parameter"));
+        TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject());
+        ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
+        ErrorObj->SetStringField(TEXT("error"), TEXT("Missing 'actors' array parameter"));
+        return FMCPSlicedCommand::FromResult(ErrorObj);
     }
 
-    const TArray<TSharedPtr<FJsonValue>>& ActorsArray = *ActorsArrayPtr;
+    struct FState
+    {
+        TWeakObjectPtr<UWorld> World;
+        TArray<FMCPActorSpawnSpec> Specs;
+
+        // Per entry; empty when the spec parsed
+        TArray<FString> ParseErrors;
+
+        // Existing actors plus everything spawned so far, so duplicate names are caught without rescanning the level
+        TSet<FName> TakenNames;
+        TMap<FString, TWeakObjectPtr<UStaticMesh>> MeshCache;
+        TArray<TSharedPtr<FJsonValue>> Results;
+        int32 SuccessCount = 0;
+        int32 FailCount = 0;
+        int32 UndoSteps = 0;
+        bool bTransactionOpen = false;
+    };
+    TSharedRef<FState> State = MakeShared<FState>();
 
-    TArray<TSharedPtr<FJsonValue>> Results;
-    int32 SuccessCount = 0;
-    int32 FailCount = 0;
+    const TArray<TSharedPtr<FJsonValue>>& ActorsArray = *ActorsArrayPtr;
+    State->Specs.SetNum(ActorsArray.Num());
+    State->ParseErrors.SetNum(ActorsArray.Num());
+    State->Results.Reserve(ActorsArray.Num());
 
-    // Spawn each actor in the batch
-    for (const TSharedPtr<FJsonValue>& ActorValue : ActorsArray)
+    for (int32 Index = 0; Index < ActorsArray.Num(); ++Index)
     {
+        const TSharedPtr<FJsonValue>& ActorValue = ActorsArray[Index];
         if (ActorValue->Type != EJson::Object)
         {
-            FailCount++;
-            // Add error result for non-object entries
+            State->ParseErrors[Index] = TEXT("Invalid actor data (not an object)");
+            continue;
+        }
+
+        FEpicUnrealMCPEditorCommands::ParseSpawnSpec(ActorValue->AsObject(), State->Specs[Index], State->ParseErrors[Index]);
+    }
+
+    if (World)
+    {
+        State->World = World;
+        FEpicUnrealMCPEditorCommands::CollectActorNames(World, State->TakenNames);
+    }
+
+    FMCPSlicedCommand Command;
+    Command.Total = ActorsArray.Num();
+
+    // Spawn one actor in the batch
+    Command.ProcessItem = [State](int32 Index)
+    {
+        UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_SpawnActorsBatch);
+
+        auto AddError = [&State](const FString& Error)
+        {
+            State->FailCount++;
             TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject());
             ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
-            ErrorObj->SetStringField(TEXT("error"), TEXT("Invalid actor data (not an object)"));
-            Results.Add(MakeShareable(new FJsonValueObject(ErrorObj)));
-            continue;
+            ErrorObj->SetStringField(TEXT("error"), Error);
+            State->Results.Add(MakeShareable(new FJsonValueObject(ErrorObj)));
+        };
+
+        if (!State->ParseErrors[Index].IsEmpty())
+        {
+            AddError(State->ParseErrors[Index]);
+            return;
         }
 
-        TSharedPtr<FJsonObject> ActorParams = ActorValue->AsObject();
+        UWorld* SpawnWorld = State->World.Get();
+        if (!SpawnWorld)
+        {
+            AddError(TEXT("Failed to get editor world"));
+            return;
+        }
+
+        const FMCPActorSpawnSpec& Spec = State->Specs[Index];
+        if (State->TakenNames.Contains(Spec.Name))
+        {
+            AddError(FString::Printf(TEXT("Actor with name '%s' already exists"), *Spec.Name.ToString()));
+            return;
+        }
 
-        // Spawn the actor using existing single-spawn logic
-        FString Result = SpawnActor(ActorParams);
+        if (!State->bTransactionOpen)
+        {
+            GEditor->BeginTransaction(NSLOCTEXT("UnrealMCP", "SpawnActorsBatch", "MCP Spawn Actors Batch"));
+            State->bTransactionOpen = true;
+            State->UndoSteps++;
+        }
 
-        // Parse result and add to results array
-        TSharedPtr<FJsonObject> ResultObj;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
-        if (FJsonSerializer::Deserialize(Reader, ResultObj))
+        // Each mesh is loaded once per batch, not once per actor
+        UStaticMesh* Mesh = nullptr;
+        if (!Spec.StaticMeshPath.IsEmpty())
         {
-            if (ResultObj->GetStringField(TEXT("status")) == TEXT("success"))
+            TWeakObjectPtr<UStaticMesh>* Cached = State->MeshCache.Find(Spec.StaticMeshPath);
+            if (Cached)
             {
-                SuccessCount++;
+                Mesh = Cached->Get();
             }
             else
             {
-                FailCount++;
+                Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Spec.StaticMeshPath));
+                State->MeshCache.Add(Spec.StaticMeshPath, Mesh);
+                if (!Mesh)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("EpicUnrealMCPBridge: Could not find static mesh at path: %s"), *Spec.StaticMeshPath);
+                }
             }
-            Results.Add(MakeShareable(new FJsonValueObject(ResultObj)));
         }
-        else
+
+        AActor* NewActor = FEpicUnrealMCPEditorCommands::SpawnFromSpec(SpawnWorld, Spec, Mesh);
+        if (!NewActor)
         {
-            // Failed to parse result
-            FailCount++;
-            TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject());
-            ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
-            ErrorObj->SetStringField(TEXT("error"), TEXT("Failed to parse spawn result"));
-            Results.Add(MakeShareable(new FJsonValueObject(ErrorObj)));
+            AddError(TEXT("Failed to create actor"));
+            return;
+        }
+
+        State->TakenNames.Add(Spec.Name);
+        State->SuccessCount++;
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShareable(new FJsonObject());
+        ResultObj->SetStringField(TEXT("status"), TEXT("success"));
+        ResultObj->SetObjectField(TEXT("result"), FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true));
+        State->Results.Add(MakeShareable(new FJsonValueObject(ResultObj)));
+    };
+
+    // The executor ends every slice before yielding the frame
+    Command.EndSlice = [State]()
+    {
+        if (State->bTransactionOpen)
+        {
+            GEditor->EndTransaction();
+            State->bTransactionOpen = false;
+        }
+    };
+
+    // Create batch response with statistics - already a complete response, not wrapped in "result"
+    Command.Finish = [State](int32 NumProcessed, bool bCancelled)
+    {
+
+        TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+        ResponseObj->SetStringField(TEXT("status"), TEXT("success"));
+        ResponseObj->SetNumberField(TEXT("success_count"), State->SuccessCount);
+        ResponseObj->SetNumberField(TEXT("fail_count"), State->FailCount);
+        ResponseObj->SetNumberField(TEXT("total"), State->Specs.Num());
+        ResponseObj->SetNumberField(TEXT("undo_steps"), State->UndoSteps);
+        ResponseObj->SetArrayField(TEXT("results"), State->Results);
+        if (bCancelled)
+        {
+            // Actors spawned before the cancel are kept
+            ResponseObj->SetBoolField(TEXT("cancelled"), true);
         }
+        return ResponseObj;
+    };
+
+    return Command;
+}
+
+// Start a command on the executor if it is one that can be sliced across frames
+bool UEpicUnrealMCPBridge::BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    FMCPSlicedCommand& OutCommand)
+{
+    if (CommandType == TEXT("spawn_actors_batch"))
+    {
+        OutCommand = BeginSpawnActorsBatch(GEditor ? GEditor->GetEditorWorldContext().World() : nullptr, Params);
+        return true;
     }
 
-    // Create batch response with statistics
-    TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
-    ResponseObj->SetStringField(TEXT("status"), TEXT("success"));
-    ResponseObj->SetNumberField(TEXT("success_count"), SuccessCount);
-    ResponseObj->SetNumberField(TEXT("fail_count"), FailCount);
-    ResponseObj->SetNumberField(TEXT("total"), ActorsArray.Num());
-    ResponseObj->SetArrayField(TEXT("results"), Results);
+    FMCPSlicedCommand HandlerCommand;
+    if (FEpicUnrealMCPEditorCommands::IsSlicedCommand(CommandType))
+    {
+        HandlerCommand = EditorCommands->BeginSlicedCommand(CommandType, Params);
+    }
+    else if (FEpicUnrealMCPBlueprintCommands::IsSlicedCommand(CommandType))
+    {
+        HandlerCommand = BlueprintCommands->BeginSlicedCommand(CommandType, Params);
+    }
+    else
+    {
+        return false;
+    }
 
-    return SerializeJsonObject(ResponseObj);
+    // Handlers return a bare result; wrap it in the usual status envelope
+    TFunction<TSharedPtr<FJsonObject>(int32, bool)> HandlerFinish = MoveTemp(HandlerCommand.Finish);
+    OutCommand = MoveTemp(HandlerCommand);
+    OutCommand.Finish = [this, HandlerFinish = MoveTemp(HandlerFinish)](int32 NumProcessed, bool bCancelled)
+    {
+        return MakeCommandResponse(HandlerFinish(NumProcessed, bCancelled));
+    };
+    return true;
+}
+
+// Wrap a handler result as {"status": "success", "result": ...} or {"status": "error", "error": ...}
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::MakeCommandResponse(const TSharedPtr<FJsonObject>& ResultJson)
+{
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+
+    // Check if the result contains an error
+    bool bSuccess = true;
+    FString ErrorMessage;
+
+    if (ResultJson->HasField(TEXT("success")))
+    {
+        bSuccess = ResultJson->GetBoolField(TEXT("success"));
+        if (!bSuccess && ResultJson->HasField(TEXT("error")))
+        {
+            ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+        }
+    }
+
+    if (bSuccess)
+    {
+        // Set success status and include the result
+        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+        ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+    }
+    else
+    {
+        // Set error status and include the error message
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+    }
+
+    return ResponseJson;
 }
 
 // Initialize subsystem - auto-starts server
@@ -204,6 +362,10 @@ void UEpicUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    Executor = MakeShared<FMCPGameThreadExecutor>();
+    Snapshots = MakeShared<FMCPWorldSnapshotCache>();
+    ResponseCache = MakeShared<FMCPResponseCache>();
+
     // Start the server automatically
     StartServer();
 }
@@ -213,6 +375,17 @@ void UEpicUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Shutting down"));
     StopServer();
+
+    // Anything still running is answered as cancelled; the server thread is gone so the replies are dropped
+    if (Executor.IsValid())
+    {
+        Executor->CancelAll();
+        Executor.Reset();
+    }
+
+    // The server thread has stopped, so nothing is reading these
+    Snapshots.Reset();
+    ResponseCache.Reset();
 }
 
 // Start the MCP server on configured port
@@ -252,8 +425,8 @@ void UEpicUnrealMCPBridge::StartServer()
         return;
     }
 
-    // Start listening
-    if (!NewListenerSocket->Listen(5))
+    // Start listening - backlog sized for many tools connecting at once
+    if (!NewListenerSocket->Listen(FMCPServerRunnable::ListenBacklog))
     {
         UE_LOG(LogTemp, Error, TEXT("EpicUnrealMCPBridge: Failed to start listening"));
         return;
@@ -312,112 +485,188 @@ void UEpicUnrealMCPBridge::StopServer()
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Server stopped"));
 }
 
-// Execute a command received from Python MCP client
-FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+// Queue a command on the game thread without waiting; OnComplete runs on the game thread
+void UEpicUnrealMCPBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    TUniqueFunction<void(FString&&)> OnComplete, FMCPRequestHandlePtr Handle)
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
 
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
-
-    // Queue execution on Game Thread (Unreal requires editor operations on main thread)
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    // Repeated queries are answered with the bytes sent last time while nothing they depend on changed
+    const bool bCacheable = ResponseCache.IsValid() && FMCPResponseCache::IsCacheableCommand(CommandType);
+    FString CacheKey;
+    FMCPResponseCache::FGenerations Generations;
+    if (bCacheable)
+    {
+        CacheKey = FMCPResponseCache::MakeKey(CommandType, Params);
+        FString CachedResponse;
+        if (ResponseCache->Find(CacheKey, CachedResponse))
         {
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+            OnComplete(MoveTemp(CachedResponse));
+            return;
+        }
 
-            try
-            {
-                TSharedPtr<FJsonObject> ResultJson;
+        // Generations are taken before the command runs, so a change made meanwhile keeps the result out
+        Generations = ResponseCache->GetGenerations();
+    }
 
-                // Simple ping command
-                if (CommandType == TEXT("ping"))
-                {
-                    ResultJson = MakeShareable(new FJsonObject);
-                    ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
-                }
-                // Batch spawning - NEW COMMAND
-                else if (CommandType == TEXT("spawn_actors_batch"))
-                {
-                    FString BatchResult = SpawnActorsBatch(Params);
-                    Promise.SetValue(BatchResult);
-                    return; // Early return for batch spawning
-                }
-                // Editor Commands (including actor manipulation)
-                else if (CommandType == TEXT("get_actors_in_level") ||
-                    CommandType == TEXT("find_actors_by_name") ||
-                    CommandType == TEXT("spawn_actor") ||
-                    CommandType == TEXT("delete_actor") ||
-                    CommandType == TEXT("set_actor_transform") ||
-                    CommandType == TEXT("spawn_blueprint_actor"))
-                {
-                    ResultJson = EditorCommands->HandleCommand(CommandType, Params);
-                }
-                // Blueprint Commands
-                else if (CommandType == TEXT("create_blueprint") ||
-                    CommandType == TEXT("add_component_to_blueprint") ||
-                    CommandType == TEXT("set_physics_properties") ||
-                    CommandType == TEXT("compile_blueprint") ||
-                    CommandType == TEXT("set_static_mesh_properties") ||
-                    CommandType == TEXT("set_mesh_material_color") ||
-                    CommandType == TEXT("get_available_materials") ||
-                    CommandType == TEXT("apply_material_to_actor") ||
-                    CommandType == TEXT("apply_material_to_blueprint") ||
-                    CommandType == TEXT("get_actor_material_info") ||
-                    CommandType == TEXT("get_blueprint_material_info"))
-                {
-                    ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-                }
-                else
+    // Reads answered from the last published snapshot never wait for the game thread. They are
+    // not cached: each carries the snapshot_frame it was read at, which a replay would misreport
+    TSharedPtr<FJsonObject> SnapshotResult;
+    if (Snapshots.IsValid() && Snapshots->TryExecute(CommandType, Params, SnapshotResult))
+    {
+        OnComplete(SerializeJsonObject(MakeCommandResponse(SnapshotResult)));
+        return;
+    }
+
+    if (bCacheable)
+    {
+        OnComplete = [this, CacheKey = MoveTemp(CacheKey), CommandType, Generations,
+            Handle, InnerOnComplete = MoveTemp(OnComplete)](FString&& Response) mutable
+            {
+                // Errors and cancelled partial results are not answers worth repeating
+                const bool bCancelled = Handle.IsValid() && Handle->IsCancelled();
+                if (ResponseCache.IsValid() && !bCancelled && Response.StartsWith(TEXT("{\"status\":\"success\"")))
                 {
-                    // Unknown command
-                    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                    ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-
-                    FString ResultString;
-                    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                    Promise.SetValue(ResultString);
-                    return;
+                    ResponseCache->Store(CacheKey, CommandType, Generations, Response);
                 }
+                InnerOnComplete(MoveTemp(Response));
+            };
+    }
 
-                // Check if the result contains an error
-                bool bSuccess = true;
-                FString ErrorMessage;
+    // Queue execution on Game Thread (Unreal requires editor operations on main thread)
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, OnComplete = MoveTemp(OnComplete), Handle = MoveTemp(Handle)]() mutable
+        {
+            // Anything that may have modified the world invalidates cached responses before the
+            // client sees the response, so its next read cannot be stale. The snapshot needs no
+            // notice: the engine events the command raised have already marked its actors dirty
+            const bool bMayModifyWorld = !FMCPWorldSnapshotCache::IsReadOnlyCommand(CommandType);
 
-                if (ResultJson->HasField(TEXT("success")))
-                {
-                    bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                    if (!bSuccess && ResultJson->HasField(TEXT("error")))
+            // Cancelled while still waiting for the game thread
+            if (Handle.IsValid() && Handle->IsCancelled())
+            {
+                OnComplete(CreateErrorResponse(TEXT("Cancelled")));
+                return;
+            }
+
+            // Heavy commands run a slice per frame so the editor stays responsive
+            FMCPSlicedCommand SlicedCommand;
+            if (Executor.IsValid() && BeginSlicedCommand(CommandType, Params, SlicedCommand))
+            {
+                Executor->Enqueue(CommandType, MoveTemp(SlicedCommand), MoveTemp(Handle),
+                    [this, bMayModifyWorld, OnComplete = MoveTemp(OnComplete)](TSharedPtr<FJsonObject> Response) mutable
                     {
-                        ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                    }
-                }
+                        if (bMayModifyWorld)
+                        {
+                            NotifyWorldModified();
+                        }
+                        OnComplete(SerializeJsonObject(Response));
+                    });
+                return;
+            }
 
-                if (bSuccess)
-                {
-                    // Set success status and include the result
-                    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                    ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-                }
-                else
-                {
-                    // Set error status and include the error message
-                    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                    ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-                }
+            FString Response = ExecuteCommandOnGameThread(CommandType, Params, Handle);
+            if (bMayModifyWorld)
+            {
+                NotifyWorldModified();
+            }
+            OnComplete(MoveTemp(Response));
+        });
+}
+
+// Game thread: a command may have changed anything in the level
+void UEpicUnrealMCPBridge::NotifyWorldModified()
+{
+    if (ResponseCache.IsValid())
+    {
+        ResponseCache->NotifyWorldModified();
+    }
+}
+
+// Dispatch a command to its handler and build the response string
+FString UEpicUnrealMCPBridge::ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    const FMCPRequestHandlePtr& Handle)
+{
+    check(IsInGameThread());
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ExecuteCommand);
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*CommandType, UnrealMCPChannel);
+
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+
+    try
+    {
+        TSharedPtr<FJsonObject> ResultJson;
+
+        // Simple ping command
+        if (CommandType == TEXT("ping"))
+        {
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        }
+        // Batch spawning - NEW COMMAND
+        else if (CommandType == TEXT("spawn_actors_batch"))
+        {
+            return SerializeJsonObject(BeginSpawnActorsBatch(GEditor ? GEditor->GetEditorWorldContext().World() : nullptr, Params).RunInline()); // Early return for batch spawning
+        }
+        // Editor Commands (including actor manipulation)
+        else if (CommandType == TEXT("get_actors_in_level") ||
+            CommandType == TEXT("find_actors_by_name") ||
+            CommandType == TEXT("spawn_actor") ||
+            CommandType == TEXT("delete_actor") ||
+            CommandType == TEXT("set_actor_transform") ||
+            CommandType == TEXT("spawn_blueprint_actor"))
+        {
+            ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+        }
+        // Blueprint Commands
+        else if (CommandType == TEXT("create_blueprint") ||
+            CommandType == TEXT("add_component_to_blueprint") ||
+            CommandType == TEXT("set_physics_properties") ||
+            CommandType == TEXT("compile_blueprint") ||
+            CommandType == TEXT("set_static_mesh_properties") ||
+            CommandType == TEXT("set_mesh_material_color") ||
+            CommandType == TEXT("get_available_materials") ||
+            CommandType == TEXT("apply_material_to_actor") ||
+            CommandType == TEXT("apply_material_to_blueprint") ||
+            CommandType == TEXT("get_actor_material_info") ||
+            CommandType == TEXT("get_blueprint_material_info"))
+        {
+            ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
+        }
+        // Change subscriptions - events are pushed on the connection the request came from
+        else if (UMCPChangeFeedSubsystem::IsChangeFeedCommand(CommandType))
+        {
+            UMCPChangeFeedSubsystem* ChangeFeed = GEditor ? GEditor->GetEditorSubsystem<UMCPChangeFeedSubsystem>() : nullptr;
+            if (!ChangeFeed)
+            {
+                return CreateErrorResponse(TEXT("Change feed is not available"));
             }
-            catch (const std::exception& e)
+            ResultJson = ChangeFeed->HandleCommand(CommandType, Params, Handle.IsValid() ? Handle->Channel : nullptr);
+        }
+        else if (CommandType == TEXT("get_response_cache_stats"))
+        {
+            if (!ResponseCache.IsValid())
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+                return CreateErrorResponse(TEXT("Response cache is not available"));
             }
+            ResultJson = ResponseCache->GetStats();
+        }
+        else
+        {
+            // Unknown command
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
 
-            FString ResultString;
-            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-            FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-            Promise.SetValue(ResultString);
-        });
+            return SerializeJsonObject(ResponseJson);
+        }
+
+        ResponseJson = MakeCommandResponse(ResultJson);
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
 
-    return Future.Get();
+    return SerializeJsonObject(ResponseJson);
 }
\ No newline at end of file
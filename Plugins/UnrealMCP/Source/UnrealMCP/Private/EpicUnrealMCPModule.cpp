@@ -9,8 +9,11 @@
 #include "EditorUtilityWidgetBlueprint.h"
 #include "Styling/SlateStyle.h"
 #include "Styling/SlateStyleRegistry.h"
+#include "EpicUnrealMCPStats.h"
 #define LOCTEXT_NAMESPACE "FEpicUnrealMCPModule"
 
+UE_TRACE_CHANNEL_DEFINE(UnrealMCPChannel);
+
 void FEpicUnrealMCPModule::StartupModule()
 {
 	UE_LOG(LogTemp, Display, TEXT("Epic Unreal MCP Module has started"));
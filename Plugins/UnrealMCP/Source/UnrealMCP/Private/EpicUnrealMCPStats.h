@@ -0,0 +1,22 @@
+// File: EpicUnrealMCPStats.h
+// Purpose: Stat group and Insights trace channel for the MCP bridge
+//
+// "stat UnrealMCP" shows bridge cost per frame; -trace=cpu,UnrealMCP adds a
+// CPU scope per command (named after the command type) to Unreal Insights.
+// Channel is defined in EpicUnrealMCPModule.cpp.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("UnrealMCP"), STATGROUP_UnrealMCP, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(UnrealMCPChannel);
+
+// Cycle counter for "stat UnrealMCP" plus a named CPU scope on UnrealMCPChannel
+#define UNREALMCP_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, UnrealMCPChannel)
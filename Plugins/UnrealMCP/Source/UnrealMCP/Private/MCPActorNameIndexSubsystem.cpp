@@ -0,0 +1,350 @@
+// File: MCPActorNameIndexSubsystem.cpp
+// Purpose: Trigram index over actor names and labels for find_actors_by_name
+
+#include "MCPActorNameIndexSubsystem.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Actor Name Index Query"), STAT_MCP_ActorNameIndexQuery, STATGROUP_UnrealMCP);
+DECLARE_CYCLE_STAT(TEXT("MCP Actor Name Index Rebuild"), STAT_MCP_ActorNameIndexRebuild, STATGROUP_UnrealMCP);
+DECLARE_MEMORY_STAT(TEXT("MCP Actor Name Index"), STAT_MCP_ActorNameIndexMemory, STATGROUP_UnrealMCP);
+
+void UMCPActorNameIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddUObject(this, &UMCPActorNameIndexSubsystem::HandleActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddUObject(this, &UMCPActorNameIndexSubsystem::HandleActorDeleted);
+    }
+
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleActorLabelChanged);
+    ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleObjectRenamed);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleLevelChanged);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleWorldCleanup);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddUObject(this, &UMCPActorNameIndexSubsystem::HandleUndoRedo);
+}
+
+void UMCPActorNameIndexSubsystem::Deinitialize()
+{
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+    }
+
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+    Reset();
+    Super::Deinitialize();
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+void UMCPActorNameIndexSubsystem::FindActors(UWorld* World, const FString& Pattern, EMCPNameMatch Match,
+    EMCPNameFields Fields, TArray<AActor*>& OutActors)
+{
+    OutActors.Reset();
+    if (!World)
+    {
+        return;
+    }
+
+    EnsureIndexed(World);
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ActorNameIndexQuery);
+
+    const FString LowerPattern = Pattern.ToLower();
+
+    // Every match contains each literal run of the pattern, so it is in the
+    // posting list of every trigram of those runs - the shortest list suffices
+    TArray<FString, TInlineAllocator<4>> Literals;
+    if (Match == EMCPNameMatch::Glob)
+    {
+        FString Run;
+        for (const TCHAR Char : LowerPattern)
+        {
+            if (Char == TEXT('*') || Char == TEXT('?'))
+            {
+                Literals.Add(MoveTemp(Run));
+                Run.Reset();
+            }
+            else
+            {
+                Run.AppendChar(Char);
+            }
+        }
+        Literals.Add(MoveTemp(Run));
+    }
+    else
+    {
+        Literals.Add(LowerPattern);
+    }
+
+    const TArray<int32>* Candidates = nullptr;
+    for (const FString& Literal : Literals)
+    {
+        for (int32 Index = 0; Index + 3 <= Literal.Len(); ++Index)
+        {
+            const TArray<int32>* Posting = Postings.Find(PackTrigram(*Literal + Index));
+            if (!Posting)
+            {
+                // No indexed name or label contains this trigram
+                return;
+            }
+            if (!Candidates || Posting->Num() < Candidates->Num())
+            {
+                Candidates = Posting;
+            }
+        }
+    }
+
+    auto Consider = [this, &LowerPattern, Match, Fields, &OutActors](int32 EntryIndex)
+    {
+        const FEntry& Entry = Entries[EntryIndex];
+        if (!Entry.bLive || !MatchesEntry(Entry, LowerPattern, Match, Fields))
+        {
+            return;
+        }
+
+        AActor* Actor = Entry.Actor.Get();
+        if (IsValid(Actor))
+        {
+            OutActors.Add(Actor);
+        }
+    };
+
+    if (Candidates)
+    {
+        for (const int32 EntryIndex : *Candidates)
+        {
+            Consider(EntryIndex);
+        }
+    }
+    else
+    {
+        // Pattern too short for a trigram - scan the cached lowercase strings
+        for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+        {
+            Consider(EntryIndex);
+        }
+    }
+}
+
+bool UMCPActorNameIndexSubsystem::MatchesEntry(const FEntry& Entry, const FString& LowerPattern,
+    EMCPNameMatch Match, EMCPNameFields Fields) const
+{
+    auto Test = [&LowerPattern, Match](const FString& Text)
+    {
+        switch (Match)
+        {
+        case EMCPNameMatch::Prefix:
+            return Text.StartsWith(LowerPattern, ESearchCase::CaseSensitive);
+        case EMCPNameMatch::Glob:
+            return Text.MatchesWildcard(LowerPattern, ESearchCase::CaseSensitive);
+        default:
+            return Text.Contains(LowerPattern, ESearchCase::CaseSensitive);
+        }
+    };
+
+    return (EnumHasAnyFlags(Fields, EMCPNameFields::Name) && Test(Entry.Name))
+        || (EnumHasAnyFlags(Fields, EMCPNameFields::Label) && Test(Entry.Label));
+}
+
+SIZE_T UMCPActorNameIndexSubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = Entries.GetAllocatedSize() + EntryByActor.GetAllocatedSize() + Postings.GetAllocatedSize();
+    for (const FEntry& Entry : Entries)
+    {
+        Size += Entry.Name.GetAllocatedSize() + Entry.Label.GetAllocatedSize();
+    }
+    for (const TPair<uint64, TArray<int32>>& Posting : Postings)
+    {
+        Size += Posting.Value.GetAllocatedSize();
+    }
+    return Size;
+}
+
+// ============================================================================
+// INDEX MAINTENANCE
+// ============================================================================
+
+void UMCPActorNameIndexSubsystem::EnsureIndexed(UWorld* World)
+{
+    const bool bNeedsCompaction = NumDeadEntries > MinEntriesForCompaction && NumDeadEntries > EntryByActor.Num();
+    if (bNeedsRebuild || bNeedsCompaction || IndexedWorld.Get() != World)
+    {
+        Rebuild(World);
+    }
+}
+
+void UMCPActorNameIndexSubsystem::Rebuild(UWorld* World)
+{
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ActorNameIndexRebuild);
+
+    Reset();
+    IndexedWorld = World;
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AddActor(*It);
+    }
+
+    bNeedsRebuild = false;
+    SET_MEMORY_STAT(STAT_MCP_ActorNameIndexMemory, GetAllocatedSize());
+
+    UE_LOG(LogTemp, Verbose, TEXT("MCPActorNameIndex: Indexed %d actors, %d trigrams"), EntryByActor.Num(), Postings.Num());
+}
+
+void UMCPActorNameIndexSubsystem::Reset()
+{
+    IndexedWorld.Reset();
+    Entries.Reset();
+    NumDeadEntries = 0;
+    EntryByActor.Reset();
+    Postings.Reset();
+    bNeedsRebuild = true;
+}
+
+void UMCPActorNameIndexSubsystem::AddActor(AActor* Actor)
+{
+    if (!IsValid(Actor) || EntryByActor.Contains(Actor))
+    {
+        return;
+    }
+
+    const int32 EntryIndex = Entries.AddDefaulted();
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.Actor = Actor;
+    Entry.Name = Actor->GetName().ToLower();
+    Entry.Label = Actor->GetActorLabel().ToLower();
+    Entry.bLive = true;
+
+    EntryByActor.Add(Actor, EntryIndex);
+    AddPostings(EntryIndex);
+}
+
+void UMCPActorNameIndexSubsystem::RemoveActor(AActor* Actor)
+{
+    int32 EntryIndex = INDEX_NONE;
+    if (!EntryByActor.RemoveAndCopyValue(Actor, EntryIndex))
+    {
+        return;
+    }
+
+    // Postings still point here; queries skip dead entries until the next rebuild
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.bLive = false;
+    Entry.Actor.Reset();
+    Entry.Name.Empty();
+    Entry.Label.Empty();
+    ++NumDeadEntries;
+}
+
+void UMCPActorNameIndexSubsystem::AddPostings(int32 EntryIndex)
+{
+    const FEntry& Entry = Entries[EntryIndex];
+
+    // A trigram repeated within a name, or shared by name and label, is posted once
+    TArray<uint64, TInlineAllocator<64>> Trigrams;
+    for (const FString* Text : { &Entry.Name, &Entry.Label })
+    {
+        for (int32 Index = 0; Index + 3 <= Text->Len(); ++Index)
+        {
+            Trigrams.AddUnique(PackTrigram(**Text + Index));
+        }
+    }
+
+    for (const uint64 Trigram : Trigrams)
+    {
+        Postings.FindOrAdd(Trigram).Add(EntryIndex);
+    }
+}
+
+// Characters are truncated to 16 bits; a collision only adds candidates, which are verified anyway
+uint64 UMCPActorNameIndexSubsystem::PackTrigram(const TCHAR* Chars)
+{
+    return (uint64(uint16(Chars[0])) << 32) | (uint64(uint16(Chars[1])) << 16) | uint64(uint16(Chars[2]));
+}
+
+// ============================================================================
+// EVENTS
+// ============================================================================
+
+void UMCPActorNameIndexSubsystem::HandleActorAdded(AActor* Actor)
+{
+    if (!bNeedsRebuild && Actor && Actor->GetWorld() == IndexedWorld.Get())
+    {
+        AddActor(Actor);
+    }
+}
+
+void UMCPActorNameIndexSubsystem::HandleActorDeleted(AActor* Actor)
+{
+    if (!bNeedsRebuild)
+    {
+        RemoveActor(Actor);
+    }
+}
+
+void UMCPActorNameIndexSubsystem::HandleActorLabelChanged(AActor* Actor)
+{
+    if (!bNeedsRebuild && Actor && EntryByActor.Contains(Actor))
+    {
+        RemoveActor(Actor);
+        AddActor(Actor);
+    }
+}
+
+void UMCPActorNameIndexSubsystem::HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName)
+{
+    AActor* Actor = Cast<AActor>(Object);
+    if (bNeedsRebuild || !Actor)
+    {
+        return;
+    }
+
+    // The rename may also have moved the actor into or out of the indexed world
+    RemoveActor(Actor);
+    if (Actor->GetWorld() == IndexedWorld.Get())
+    {
+        AddActor(Actor);
+    }
+}
+
+void UMCPActorNameIndexSubsystem::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+    if (World && World == IndexedWorld.Get())
+    {
+        bNeedsRebuild = true;
+    }
+}
+
+void UMCPActorNameIndexSubsystem::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (World && World == IndexedWorld.Get())
+    {
+        Reset();
+    }
+}
+
+// Undo can resurrect or remove actors without the add/delete events
+void UMCPActorNameIndexSubsystem::HandleUndoRedo()
+{
+    bNeedsRebuild = true;
+}
@@ -0,0 +1,521 @@
+// File: MCPChangeFeedSubsystem.cpp
+// Purpose: Per-frame, coalesced actor change events for subscribed MCP clients
+
+#include "MCPChangeFeedSubsystem.h"
+#include "Editor.h"
+#include "Algo/Find.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "UObject/UObjectGlobals.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Commands/EpicUnrealMCPEditorCommands.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Change Feed Flush"), STAT_MCP_ChangeFeedFlush, STATGROUP_UnrealMCP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MCP Change Feed Subscriptions"), STAT_MCP_ChangeFeedSubscriptions, STATGROUP_UnrealMCP);
+
+namespace
+{
+    struct FChangeKindName
+    {
+        EMCPChangeKind Kind;
+        const TCHAR* Name;
+    };
+
+    const FChangeKindName ChangeKindNames[] =
+    {
+        { EMCPChangeKind::Added, TEXT("added") },
+        { EMCPChangeKind::Removed, TEXT("removed") },
+        { EMCPChangeKind::Transform, TEXT("transform") },
+        { EMCPChangeKind::Property, TEXT("property") },
+    };
+}
+
+void UMCPChangeFeedSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddUObject(this, &UMCPChangeFeedSubsystem::HandleActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddUObject(this, &UMCPChangeFeedSubsystem::HandleActorDeleted);
+        ActorMovedHandle = GEngine->OnActorMoved().AddUObject(this, &UMCPChangeFeedSubsystem::HandleActorMoved);
+    }
+
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UMCPChangeFeedSubsystem::HandleObjectPropertyChanged);
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMCPChangeFeedSubsystem::Tick));
+}
+
+void UMCPChangeFeedSubsystem::Deinitialize()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    }
+
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+
+    Subscriptions.Empty();
+    PendingChanges.Empty();
+    Super::Deinitialize();
+}
+
+// ============================================================================
+// COMMANDS
+// ============================================================================
+
+bool UMCPChangeFeedSubsystem::IsChangeFeedCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("subscribe") || CommandType == TEXT("unsubscribe");
+}
+
+TSharedPtr<FJsonObject> UMCPChangeFeedSubsystem::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    const FMCPClientChannelPtr& Channel)
+{
+    // Events are pushed down the connection, so an in-process caller has nowhere to receive them
+    if (!Channel.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s requires a streaming connection"), *CommandType));
+    }
+
+    if (CommandType == TEXT("subscribe"))
+    {
+        return HandleSubscribe(Params, Channel);
+    }
+    else if (CommandType == TEXT("unsubscribe"))
+    {
+        return HandleUnsubscribe(Params, Channel);
+    }
+
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown change feed command: %s"), *CommandType));
+}
+
+TSharedPtr<FJsonObject> UMCPChangeFeedSubsystem::HandleSubscribe(const TSharedPtr<FJsonObject>& Params, const FMCPClientChannelPtr& Channel)
+{
+    FSubscription Subscription;
+    Subscription.Channel = Channel;
+
+    // Optional: "classes" (or a single "class") limits events to actors of those classes or subclasses
+    TArray<FString> ClassNames;
+    const TArray<TSharedPtr<FJsonValue>>* ClassesArray = nullptr;
+    FString SingleClass;
+    if (Params.IsValid() && Params->TryGetArrayField(TEXT("classes"), ClassesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ClassesArray)
+        {
+            ClassNames.Add(Value->AsString());
+        }
+    }
+    else if (Params.IsValid() && Params->TryGetStringField(TEXT("class"), SingleClass))
+    {
+        ClassNames.Add(SingleClass);
+    }
+
+    for (const FString& ClassName : ClassNames)
+    {
+        UClass* ActorClass = FEpicUnrealMCPEditorCommands::FindActorClass(ClassName);
+        if (!ActorClass)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor class: %s"), *ClassName));
+        }
+        Subscription.Classes.Add(ActorClass);
+    }
+
+    // Optional: "path" is a prefix of the actor's object path, e.g. a level or sublevel
+    if (Params.IsValid())
+    {
+        Params->TryGetStringField(TEXT("path"), Subscription.PathPrefix);
+    }
+
+    // Optional: "events" is a subset of added, removed, transform, property
+    const TArray<TSharedPtr<FJsonValue>>* EventsArray = nullptr;
+    if (Params.IsValid() && Params->TryGetArrayField(TEXT("events"), EventsArray))
+    {
+        Subscription.Events = EMCPChangeKind::None;
+        for (const TSharedPtr<FJsonValue>& Value : *EventsArray)
+        {
+            const FString EventName = Value->AsString();
+            const FChangeKindName* Found = Algo::FindBy(ChangeKindNames, EventName,
+                [](const FChangeKindName& Entry) { return FString(Entry.Name); });
+            if (!Found)
+            {
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown event: %s"), *EventName));
+            }
+            Subscription.Events |= Found->Kind;
+        }
+
+        if (Subscription.Events == EMCPChangeKind::None)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'events' must name at least one event"));
+        }
+    }
+
+    Subscription.Id = NextSubscriptionId++;
+    Subscriptions.Add(MoveTemp(Subscription));
+    SET_DWORD_STAT(STAT_MCP_ChangeFeedSubscriptions, Subscriptions.Num());
+
+    UE_LOG(LogTemp, Display, TEXT("MCPChangeFeed: Connection %u subscribed (subscription %d)"),
+        Channel->ConnectionId, Subscriptions.Last().Id);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("subscription"), Subscriptions.Last().Id);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> UMCPChangeFeedSubsystem::HandleUnsubscribe(const TSharedPtr<FJsonObject>& Params, const FMCPClientChannelPtr& Channel)
+{
+    int32 SubscriptionId = 0;
+    if (!Params.IsValid() || !Params->TryGetNumberField(TEXT("subscription"), SubscriptionId))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'subscription' parameter"));
+    }
+
+    // Only the connection that subscribed can unsubscribe
+    const int32 NumRemoved = Subscriptions.RemoveAll([SubscriptionId, &Channel](const FSubscription& Subscription)
+        {
+            return Subscription.Id == SubscriptionId && Subscription.Channel == Channel;
+        });
+    if (NumRemoved == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No subscription %d on this connection"), SubscriptionId));
+    }
+
+    SET_DWORD_STAT(STAT_MCP_ChangeFeedSubscriptions, Subscriptions.Num());
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("subscription"), SubscriptionId);
+    ResultObj->SetBoolField(TEXT("unsubscribed"), true);
+    return ResultObj;
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+UMCPChangeFeedSubsystem::FPendingChange* UMCPChangeFeedSubsystem::FindOrAddChange(AActor* Actor)
+{
+    if (Subscriptions.Num() == 0 || !Actor || !GEditor || Actor->HasAnyFlags(RF_Transient | RF_ClassDefaultObject))
+    {
+        return nullptr;
+    }
+
+    // Only the level being edited - not PIE, previews or thumbnails
+    if (Actor->GetWorld() != GEditor->GetEditorWorldContext().World())
+    {
+        return nullptr;
+    }
+
+    FPendingChange& Change = PendingChanges.FindOrAdd(Actor);
+    if (!Change.Actor.IsValid())
+    {
+        Change.Actor = Actor;
+        Change.Class = Actor->GetClass();
+        Change.Name = Actor->GetName();
+        Change.Path = Actor->GetPathName();
+    }
+    return &Change;
+}
+
+void UMCPChangeFeedSubsystem::RecordChange(AActor* Actor, EMCPChangeKind Kind, FName PropertyName)
+{
+    FPendingChange* Change = FindOrAddChange(Actor);
+    if (!Change)
+    {
+        return;
+    }
+
+    switch (Kind)
+    {
+    case EMCPChangeKind::Added:
+        // Removed and re-added in one frame (undo/redo) - report it as added
+        Change->Kinds = EMCPChangeKind::Added;
+        Change->Properties.Reset();
+        Change->bPropertiesTruncated = false;
+        break;
+
+    case EMCPChangeKind::Removed:
+        if (EnumHasAnyFlags(Change->Kinds, EMCPChangeKind::Added))
+        {
+            // Never seen by a client
+            PendingChanges.Remove(Actor);
+            return;
+        }
+        Change->Kinds = EMCPChangeKind::Removed;
+        Change->Properties.Reset();
+        Change->bPropertiesTruncated = false;
+        break;
+
+    default:
+        // An added actor is reported with its final state; a removed one has none
+        if (EnumHasAnyFlags(Change->Kinds, EMCPChangeKind::Added | EMCPChangeKind::Removed))
+        {
+            return;
+        }
+        Change->Kinds |= Kind;
+        if (PropertyName != NAME_None && !Change->Properties.Contains(PropertyName))
+        {
+            if (Change->Properties.Num() < MaxPropertiesPerChange)
+            {
+                Change->Properties.Add(PropertyName);
+            }
+            else
+            {
+                Change->bPropertiesTruncated = true;
+            }
+        }
+        break;
+    }
+}
+
+void UMCPChangeFeedSubsystem::HandleActorAdded(AActor* Actor)
+{
+    RecordChange(Actor, EMCPChangeKind::Added);
+}
+
+void UMCPChangeFeedSubsystem::HandleActorDeleted(AActor* Actor)
+{
+    RecordChange(Actor, EMCPChangeKind::Removed);
+}
+
+void UMCPChangeFeedSubsystem::HandleActorMoved(AActor* Actor)
+{
+    RecordChange(Actor, EMCPChangeKind::Transform);
+}
+
+void UMCPChangeFeedSubsystem::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    if (Subscriptions.Num() == 0 || !Object)
+    {
+        return;
+    }
+
+    // Component edits are reported against the actor that owns them
+    AActor* Actor = Cast<AActor>(Object);
+    if (!Actor)
+    {
+        if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+        {
+            Actor = Component->GetOwner();
+        }
+    }
+
+    RecordChange(Actor, EMCPChangeKind::Property, Event.GetMemberPropertyName());
+}
+
+// ============================================================================
+// DELIVERY
+// ============================================================================
+
+bool UMCPChangeFeedSubsystem::Tick(float DeltaTime)
+{
+    PruneClosedSubscriptions();
+
+    if (PendingChanges.Num() == 0)
+    {
+        return true;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ChangeFeedFlush);
+
+    SendChanges();
+
+    // Keeps its allocation - the next frame's changes usually need about as much
+    PendingChanges.Reset();
+    return true;
+}
+
+void UMCPChangeFeedSubsystem::PruneClosedSubscriptions()
+{
+    const int32 NumRemoved = Subscriptions.RemoveAll([](const FSubscription& Subscription)
+        {
+            return !Subscription.Channel->IsOpen();
+        });
+
+    if (NumRemoved > 0)
+    {
+        SET_DWORD_STAT(STAT_MCP_ChangeFeedSubscriptions, Subscriptions.Num());
+        if (Subscriptions.Num() == 0)
+        {
+            PendingChanges.Empty();
+            Batches.Empty();
+            for (FString& Serialized : SerializedByKinds)
+            {
+                Serialized.Empty();
+            }
+        }
+    }
+}
+
+// Each change is serialized once per distinct event mask among the subscriptions
+// that match it - usually once - and the same bytes go into every matching line
+void UMCPChangeFeedSubsystem::SendChanges()
+{
+    Batches.SetNum(Subscriptions.Num());
+
+    for (const TPair<TObjectKey<AActor>, FPendingChange>& Pair : PendingChanges)
+    {
+        const FPendingChange& Change = Pair.Value;
+        uint32 SerializedMasks = 0;
+
+        for (int32 Index = 0; Index < Subscriptions.Num(); ++Index)
+        {
+            const FSubscription& Subscription = Subscriptions[Index];
+            const EMCPChangeKind Kinds = Change.Kinds & Subscription.Events;
+            if (Kinds == EMCPChangeKind::None || !Matches(Subscription, Change))
+            {
+                continue;
+            }
+
+            const uint32 MaskBit = 1u << static_cast<uint32>(Kinds);
+            FString& Serialized = SerializedByKinds[static_cast<int32>(Kinds)];
+            if ((SerializedMasks & MaskBit) == 0)
+            {
+                Serialized.Reset();
+                TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+                    TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+                FJsonSerializer::Serialize(ChangeToJson(Change, Kinds).ToSharedRef(), Writer);
+                SerializedMasks |= MaskBit;
+            }
+
+            FEventBatch& Batch = Batches[Index];
+            if (Batch.NumChanges > 0)
+            {
+                Batch.Changes.AppendChar(TEXT(','));
+            }
+            Batch.Changes += Serialized;
+
+            if (++Batch.NumChanges == MaxChangesPerEvent)
+            {
+                SendBatch(Subscription, Batch);
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < Subscriptions.Num(); ++Index)
+    {
+        if (Batches[Index].NumChanges > 0)
+        {
+            SendBatch(Subscriptions[Index], Batches[Index]);
+        }
+    }
+}
+
+void UMCPChangeFeedSubsystem::SendBatch(const FSubscription& Subscription, FEventBatch& Batch)
+{
+    FString Line = FString::Printf(TEXT("{\"event\":\"changes\",\"subscription\":%d,\"frame\":%llu,\"changes\":["),
+        Subscription.Id, static_cast<uint64>(GFrameCounter));
+    Line.Reserve(Line.Len() + Batch.Changes.Len() + 2);
+    Line += Batch.Changes;
+    Line += TEXT("]}");
+    Subscription.Channel->Send(MoveTemp(Line));
+
+    // Keeps its allocation for the next batch
+    Batch.Changes.Reset();
+    Batch.NumChanges = 0;
+}
+
+SIZE_T UMCPChangeFeedSubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = Subscriptions.GetAllocatedSize() + PendingChanges.GetAllocatedSize() + Batches.GetAllocatedSize();
+    for (const FSubscription& Subscription : Subscriptions)
+    {
+        Size += Subscription.Classes.GetAllocatedSize() + Subscription.PathPrefix.GetAllocatedSize();
+    }
+    for (const TPair<TObjectKey<AActor>, FPendingChange>& Pair : PendingChanges)
+    {
+        Size += Pair.Value.Name.GetAllocatedSize() + Pair.Value.Path.GetAllocatedSize() + Pair.Value.Properties.GetAllocatedSize();
+    }
+    for (const FEventBatch& Batch : Batches)
+    {
+        Size += Batch.Changes.GetAllocatedSize();
+    }
+    for (const FString& Serialized : SerializedByKinds)
+    {
+        Size += Serialized.GetAllocatedSize();
+    }
+    return Size;
+}
+
+bool UMCPChangeFeedSubsystem::Matches(const FSubscription& Subscription, const FPendingChange& Change)
+{
+    if (!Subscription.PathPrefix.IsEmpty() && !Change.Path.StartsWith(Subscription.PathPrefix))
+    {
+        return false;
+    }
+
+    if (Subscription.Classes.Num() == 0)
+    {
+        return true;
+    }
+
+    const UClass* ChangeClass = Change.Class.Get();
+    if (!ChangeClass)
+    {
+        return false;
+    }
+
+    for (const TWeakObjectPtr<UClass>& FilterClass : Subscription.Classes)
+    {
+        if (FilterClass.IsValid() && ChangeClass->IsChildOf(FilterClass.Get()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TSharedPtr<FJsonObject> UMCPChangeFeedSubsystem::ChangeToJson(const FPendingChange& Change, EMCPChangeKind Kinds)
+{
+    // Added and moved actors carry their current transform so a mirror needs no follow-up query
+    AActor* Actor = Change.Actor.Get();
+    TSharedPtr<FJsonObject> ChangeObj;
+    if (Actor && EnumHasAnyFlags(Kinds, EMCPChangeKind::Added | EMCPChangeKind::Transform))
+    {
+        ChangeObj = FEpicUnrealMCPCommonUtils::ActorToProjectedJson(Actor, EMCPActorFields::Default);
+    }
+    else
+    {
+        ChangeObj = MakeShared<FJsonObject>();
+        ChangeObj->SetStringField(TEXT("name"), Change.Name);
+        ChangeObj->SetStringField(TEXT("class"), Change.Class.IsValid() ? Change.Class->GetName() : FString());
+    }
+    ChangeObj->SetStringField(TEXT("path"), Change.Path);
+
+    TArray<TSharedPtr<FJsonValue>> KindsArray;
+    for (const FChangeKindName& Entry : ChangeKindNames)
+    {
+        if (EnumHasAnyFlags(Kinds, Entry.Kind))
+        {
+            KindsArray.Add(MakeShared<FJsonValueString>(Entry.Name));
+        }
+    }
+    ChangeObj->SetArrayField(TEXT("kinds"), KindsArray);
+
+    if (EnumHasAnyFlags(Kinds, EMCPChangeKind::Property) && Change.Properties.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> PropertiesArray;
+        PropertiesArray.Reserve(Change.Properties.Num());
+        for (const FName& PropertyName : Change.Properties)
+        {
+            PropertiesArray.Add(MakeShared<FJsonValueString>(PropertyName.ToString()));
+        }
+        ChangeObj->SetArrayField(TEXT("properties"), PropertiesArray);
+        if (Change.bPropertiesTruncated)
+        {
+            ChangeObj->SetBoolField(TEXT("properties_truncated"), true);
+        }
+    }
+
+    return ChangeObj;
+}
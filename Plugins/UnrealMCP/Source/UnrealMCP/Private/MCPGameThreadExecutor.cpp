@@ -0,0 +1,186 @@
+#include "MCPGameThreadExecutor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Executor Tick"), STAT_MCP_ExecutorTick, STATGROUP_UnrealMCP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MCP Executor Jobs"), STAT_MCP_ExecutorJobs, STATGROUP_UnrealMCP);
+
+TSharedPtr<FJsonObject> FMCPSlicedCommand::RunInline()
+{
+    for (int32 Index = 0; Index < Total; ++Index)
+    {
+        ProcessItem(Index);
+    }
+    if (EndSlice)
+    {
+        EndSlice();
+    }
+    return Finish(Total, false);
+}
+
+FMCPSlicedCommand FMCPSlicedCommand::FromResult(const TSharedPtr<FJsonObject>& Result)
+{
+    FMCPSlicedCommand Command;
+    Command.Finish = [Result](int32, bool) { return Result; };
+    return Command;
+}
+
+FMCPGameThreadExecutor::FMCPGameThreadExecutor()
+{
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FMCPGameThreadExecutor::Tick));
+}
+
+FMCPGameThreadExecutor::~FMCPGameThreadExecutor()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    CancelAll();
+}
+
+void FMCPGameThreadExecutor::Enqueue(const FString& Name, FMCPSlicedCommand&& Command, FMCPRequestHandlePtr Handle,
+    TUniqueFunction<void(TSharedPtr<FJsonObject>)> OnFinished)
+{
+    check(IsInGameThread());
+
+    TUniquePtr<FJob> Job = MakeUnique<FJob>();
+    Job->Name = Name;
+    Job->Command = MoveTemp(Command);
+    Job->Handle = MoveTemp(Handle);
+    Job->OnFinished = MoveTemp(OnFinished);
+
+    // Small commands finish right here with no extra frame of latency
+    const double Now = FPlatformTime::Seconds();
+    if (AdvanceJob(*Job, Now + FrameBudgetSeconds))
+    {
+        FinishJob(*Job);
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCPGameThreadExecutor: '%s' continues over several frames (%d/%d items done)"),
+        *Job->Name, Job->NextIndex, Job->Command.Total);
+
+    ReportProgress(*Job, Now);
+    Jobs.Add(MoveTemp(Job));
+}
+
+void FMCPGameThreadExecutor::CancelAll()
+{
+    // Detach first - OnFinished must not see a half-modified job list
+    TArray<TUniquePtr<FJob>> Cancelled = MoveTemp(Jobs);
+    Jobs.Reset();
+
+    for (TUniquePtr<FJob>& Job : Cancelled)
+    {
+        if (Job->Handle.IsValid())
+        {
+            Job->Handle->bCancelled = true;
+        }
+        FinishJob(*Job);
+    }
+}
+
+bool FMCPGameThreadExecutor::Tick(float DeltaTime)
+{
+    SET_DWORD_STAT(STAT_MCP_ExecutorJobs, Jobs.Num());
+
+    if (Jobs.Num() == 0)
+    {
+        return true;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ExecutorTick);
+
+    const double Deadline = FPlatformTime::Seconds() + FrameBudgetSeconds;
+
+    for (int32 Index = 0; Index < Jobs.Num();)
+    {
+        const double Now = FPlatformTime::Seconds();
+        if (Now >= Deadline)
+        {
+            break;
+        }
+
+        // Split what is left of the budget evenly between the jobs not yet serviced
+        const double JobDeadline = Now + (Deadline - Now) / (Jobs.Num() - Index);
+
+        FJob& Job = *Jobs[Index];
+        if (AdvanceJob(Job, JobDeadline))
+        {
+            TUniquePtr<FJob> Finished = MoveTemp(Jobs[Index]);
+            Jobs.RemoveAt(Index);
+            FinishJob(*Finished);
+            continue;
+        }
+
+        ReportProgress(Job, FPlatformTime::Seconds());
+        ++Index;
+    }
+
+    // Rotate so an overrunning first job cannot starve the rest
+    if (Jobs.Num() > 1)
+    {
+        TUniquePtr<FJob> First = MoveTemp(Jobs[0]);
+        Jobs.RemoveAt(0);
+        Jobs.Add(MoveTemp(First));
+    }
+
+    return true;
+}
+
+bool FMCPGameThreadExecutor::AdvanceJob(FJob& Job, double Deadline)
+{
+    // Whatever the command opened for this run of items is closed before the editor runs again
+    ON_SCOPE_EXIT
+    {
+        if (Job.Command.EndSlice)
+        {
+            Job.Command.EndSlice();
+        }
+    };
+
+    while (Job.NextIndex < Job.Command.Total)
+    {
+        if (Job.IsCancelled())
+        {
+            return true;
+        }
+
+        const int32 SliceEnd = FMath::Min(Job.NextIndex + ItemsPerClockCheck, Job.Command.Total);
+        for (; Job.NextIndex < SliceEnd; ++Job.NextIndex)
+        {
+            Job.Command.ProcessItem(Job.NextIndex);
+        }
+
+        if (FPlatformTime::Seconds() >= Deadline)
+        {
+            return Job.NextIndex >= Job.Command.Total;
+        }
+    }
+
+    return true;
+}
+
+void FMCPGameThreadExecutor::FinishJob(FJob& Job)
+{
+    const bool bCancelled = Job.IsCancelled() && Job.NextIndex < Job.Command.Total;
+    if (bCancelled)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPGameThreadExecutor: '%s' cancelled after %d/%d items"),
+            *Job.Name, Job.NextIndex, Job.Command.Total);
+    }
+
+    TSharedPtr<FJsonObject> Result = Job.Command.Finish(Job.NextIndex, bCancelled);
+    Job.OnFinished(Result);
+}
+
+void FMCPGameThreadExecutor::ReportProgress(FJob& Job, double Now)
+{
+    if (!Job.Handle.IsValid() || !Job.Handle->OnProgress || Now - Job.LastProgressTime < ProgressIntervalSeconds)
+    {
+        return;
+    }
+
+    Job.LastProgressTime = Now;
+    Job.Handle->OnProgress(Job.NextIndex, Job.Command.Total);
+}
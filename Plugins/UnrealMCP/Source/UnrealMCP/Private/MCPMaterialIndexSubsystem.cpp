@@ -0,0 +1,318 @@
+// File: MCPMaterialIndexSubsystem.cpp
+// Purpose: Sorted, incrementally maintained material index for get_available_materials
+
+#include "MCPMaterialIndexSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Materials/MaterialInterface.h"
+#include "Modules/ModuleManager.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Material Index Query"), STAT_MCP_MaterialIndexQuery, STATGROUP_UnrealMCP);
+DECLARE_CYCLE_STAT(TEXT("MCP Material Index Build"), STAT_MCP_MaterialIndexBuild, STATGROUP_UnrealMCP);
+DECLARE_MEMORY_STAT(TEXT("MCP Material Index"), STAT_MCP_MaterialIndexMemory, STATGROUP_UnrealMCP);
+
+void UMCPMaterialIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddUObject(this, &UMCPMaterialIndexSubsystem::HandleAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddUObject(this, &UMCPMaterialIndexSubsystem::HandleAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddUObject(this, &UMCPMaterialIndexSubsystem::HandleAssetRenamed);
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddUObject(this, &UMCPMaterialIndexSubsystem::HandleAssetAdded);
+
+    // Building before the initial scan finishes would only index part of the content
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddUObject(this, &UMCPMaterialIndexSubsystem::HandleFilesLoaded);
+    }
+    else
+    {
+        StartBuild();
+    }
+}
+
+void UMCPMaterialIndexSubsystem::Deinitialize()
+{
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+
+    // A build still running on the worker is ignored when it completes
+    ++CurrentBuildId;
+    bBuilding = false;
+    bReady = false;
+    Entries.Empty();
+    PendingEvents.Empty();
+    SET_MEMORY_STAT(STAT_MCP_MaterialIndexMemory, 0);
+
+    Super::Deinitialize();
+}
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void UMCPMaterialIndexSubsystem::StartBuild()
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    // Resolve the class hierarchy here so the worker runs a plain class filter
+    const FTopLevelAssetPath MaterialInterfacePath = UMaterialInterface::StaticClass()->GetClassPathName();
+    MaterialClasses.Reset();
+    MaterialClasses.Add(MaterialInterfacePath);
+    AssetRegistry.GetDerivedClassNames({ MaterialInterfacePath }, {}, MaterialClasses);
+
+    FARFilter Filter;
+    Filter.ClassPaths = MaterialClasses.Array();
+    // Enumerating in-memory assets walks UObjects, which is game thread only.
+    // Unsaved materials reach the index through the add/update events bound
+    // in Initialize, replayed over the result in FinishBuild.
+    Filter.bIncludeOnlyOnDiskAssets = true;
+
+    bBuilding = true;
+    PendingEvents.Reset();
+    const uint32 BuildId = ++CurrentBuildId;
+
+    // Every mount point, engine content included - queries pick the paths they want
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<UMCPMaterialIndexSubsystem>(this), BuildId, Filter = MoveTemp(Filter)]()
+        {
+            TArray<FAssetData> Assets;
+            IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, BuildId, Assets = MoveTemp(Assets)]() mutable
+                {
+                    if (UMCPMaterialIndexSubsystem* This = WeakThis.Get())
+                    {
+                        This->FinishBuild(BuildId, MoveTemp(Assets));
+                    }
+                });
+        });
+}
+
+void UMCPMaterialIndexSubsystem::FinishBuild(uint32 BuildId, TArray<FAssetData>&& Assets)
+{
+    if (BuildId != CurrentBuildId)
+    {
+        return;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_MaterialIndexBuild);
+
+    Entries.Reset(Assets.Num());
+    for (FAssetData& AssetData : Assets)
+    {
+        FEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.ObjectPath = AssetData.GetObjectPathString();
+        Entry.LowerName = AssetData.AssetName.ToString().ToLower();
+        Entry.AssetData = MoveTemp(AssetData);
+    }
+    Entries.Sort([](const FEntry& A, const FEntry& B) { return A.ObjectPath < B.ObjectPath; });
+
+    // Changes made while the worker was reading; each is idempotent, so one the
+    // worker already saw is harmless
+    for (const FPendingEvent& Event : PendingEvents)
+    {
+        if (Event.bRemoved)
+        {
+            Remove(Event.AssetData.GetObjectPathString());
+            continue;
+        }
+        if (!Event.OldObjectPath.IsEmpty())
+        {
+            Remove(Event.OldObjectPath);
+        }
+        AddOrUpdate(Event.AssetData);
+    }
+    PendingEvents.Empty();
+
+    bBuilding = false;
+    bReady = true;
+    SET_MEMORY_STAT(STAT_MCP_MaterialIndexMemory, GetAllocatedSize());
+
+    UE_LOG(LogTemp, Display, TEXT("MCPMaterialIndex: Indexed %d materials"), Entries.Num());
+}
+
+// ============================================================================
+// MAINTENANCE
+// ============================================================================
+
+bool UMCPMaterialIndexSubsystem::IsMaterialClass(const FAssetData& AssetData) const
+{
+    return MaterialClasses.Contains(AssetData.AssetClassPath);
+}
+
+int32 UMCPMaterialIndexSubsystem::LowerBound(const FString& Path) const
+{
+    return Algo::LowerBoundBy(Entries, Path, &FEntry::ObjectPath);
+}
+
+void UMCPMaterialIndexSubsystem::AddOrUpdate(const FAssetData& AssetData)
+{
+    FString ObjectPath = AssetData.GetObjectPathString();
+    const int32 Index = LowerBound(ObjectPath);
+
+    FEntry* Entry = nullptr;
+    if (Entries.IsValidIndex(Index) && Entries[Index].ObjectPath == ObjectPath)
+    {
+        Entry = &Entries[Index];
+    }
+    else
+    {
+        Entry = &Entries.InsertDefaulted_GetRef(Index);
+        Entry->ObjectPath = MoveTemp(ObjectPath);
+    }
+
+    Entry->LowerName = AssetData.AssetName.ToString().ToLower();
+    Entry->AssetData = AssetData;
+}
+
+void UMCPMaterialIndexSubsystem::Remove(const FString& ObjectPath)
+{
+    const int32 Index = LowerBound(ObjectPath);
+    if (Entries.IsValidIndex(Index) && Entries[Index].ObjectPath == ObjectPath)
+    {
+        Entries.RemoveAt(Index, 1, EAllowShrinking::No);
+    }
+}
+
+void UMCPMaterialIndexSubsystem::HandleFilesLoaded()
+{
+    FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+    FilesLoadedHandle.Reset();
+    StartBuild();
+}
+
+void UMCPMaterialIndexSubsystem::HandleAssetAdded(const FAssetData& AssetData)
+{
+    // Before the build starts, the build itself will pick the asset up
+    if ((!bReady && !bBuilding) || !IsMaterialClass(AssetData))
+    {
+        return;
+    }
+
+    if (bBuilding)
+    {
+        PendingEvents.Add({ AssetData, FString(), false });
+        return;
+    }
+    AddOrUpdate(AssetData);
+}
+
+void UMCPMaterialIndexSubsystem::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if ((!bReady && !bBuilding) || !IsMaterialClass(AssetData))
+    {
+        return;
+    }
+
+    if (bBuilding)
+    {
+        PendingEvents.Add({ AssetData, FString(), true });
+        return;
+    }
+    Remove(AssetData.GetObjectPathString());
+}
+
+void UMCPMaterialIndexSubsystem::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if ((!bReady && !bBuilding) || !IsMaterialClass(AssetData))
+    {
+        return;
+    }
+
+    if (bBuilding)
+    {
+        PendingEvents.Add({ AssetData, OldObjectPath, false });
+        return;
+    }
+    Remove(OldObjectPath);
+    AddOrUpdate(AssetData);
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+void UMCPMaterialIndexSubsystem::Query(const FMCPMaterialQuery& Query, TArray<FAssetData>& OutAssets, FString& OutNextCursor) const
+{
+    OutAssets.Reset();
+    OutNextCursor.Reset();
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_MaterialIndexQuery);
+
+    // Each prefix is a contiguous run of the sorted entries. Engine content is a
+    // second run unless one prefix already contains the other
+    static const FString EnginePath = TEXT("/Engine/");
+    TArray<FString, TInlineAllocator<2>> Prefixes;
+    Prefixes.Add(Query.SearchPath);
+    if (Query.bIncludeEngine && !EnginePath.StartsWith(Query.SearchPath))
+    {
+        if (Query.SearchPath.StartsWith(EnginePath))
+        {
+            Prefixes[0] = EnginePath;
+        }
+        else
+        {
+            Prefixes.Add(EnginePath);
+        }
+    }
+    Prefixes.Sort();
+
+    const FString LowerNameFilter = Query.NameFilter.ToLower();
+
+    // One extra match tells whether another page follows
+    const int32 Limit = Query.PageSize > 0 ? Query.PageSize + 1 : MAX_int32;
+
+    for (const FString& Prefix : Prefixes)
+    {
+        int32 Index = LowerBound(Prefix);
+
+        // Pages resume after the last path already returned
+        if (!Query.Cursor.IsEmpty())
+        {
+            int32 CursorIndex = LowerBound(Query.Cursor);
+            if (Entries.IsValidIndex(CursorIndex) && Entries[CursorIndex].ObjectPath == Query.Cursor)
+            {
+                ++CursorIndex;
+            }
+            Index = FMath::Max(Index, CursorIndex);
+        }
+
+        for (; Index < Entries.Num() && Entries[Index].ObjectPath.StartsWith(Prefix); ++Index)
+        {
+            const FEntry& Entry = Entries[Index];
+            if (!LowerNameFilter.IsEmpty() && !Entry.LowerName.Contains(LowerNameFilter, ESearchCase::CaseSensitive))
+            {
+                continue;
+            }
+
+            OutAssets.Add(Entry.AssetData);
+            if (OutAssets.Num() == Limit)
+            {
+                OutAssets.Pop(EAllowShrinking::No);
+                OutNextCursor = OutAssets.Last().GetObjectPathString();
+                return;
+            }
+        }
+    }
+}
+
+SIZE_T UMCPMaterialIndexSubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = Entries.GetAllocatedSize() + MaterialClasses.GetAllocatedSize() + PendingEvents.GetAllocatedSize();
+    for (const FEntry& Entry : Entries)
+    {
+        Size += Entry.ObjectPath.GetAllocatedSize() + Entry.LowerName.GetAllocatedSize();
+    }
+    return Size;
+}
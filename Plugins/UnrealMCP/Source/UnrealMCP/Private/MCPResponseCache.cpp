@@ -0,0 +1,395 @@
+// File: MCPResponseCache.cpp
+// Purpose: Generation-checked cache of serialized query responses
+
+#include "MCPResponseCache.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("MCP Response Cache Hits"), STAT_MCP_ResponseCacheHits, STATGROUP_UnrealMCP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MCP Response Cache Misses"), STAT_MCP_ResponseCacheMisses, STATGROUP_UnrealMCP);
+DECLARE_MEMORY_STAT(TEXT("MCP Response Cache"), STAT_MCP_ResponseCacheMemory, STATGROUP_UnrealMCP);
+
+FMCPResponseCache::FMCPResponseCache()
+{
+    // World generation: anything that can change actors, components or Blueprints in
+    // the editor world. Coarse within it - a spurious miss only costs one handler run
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPResponseCache::HandleActorEvent);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPResponseCache::HandleActorEvent);
+        ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPResponseCache::HandleActorEvent);
+    }
+    if (GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMCPResponseCache::HandleWorldEvent);
+    }
+
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPResponseCache::HandleActorEvent);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPResponseCache::HandleObjectPropertyChanged);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FMCPResponseCache::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FMCPResponseCache::HandleLevelChanged);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPResponseCache::HandleWorldCleanup);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPResponseCache::HandleWorldEvent);
+
+    // Asset generation: the asset registry's view of content
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPResponseCache::HandleAssetEvent);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPResponseCache::HandleAssetEvent);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPResponseCache::HandleAssetRenamed);
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FMCPResponseCache::HandleAssetEvent);
+    FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FMCPResponseCache::HandleAssetsChanged);
+}
+
+FMCPResponseCache::~FMCPResponseCache()
+{
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    }
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+    // The registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+    }
+
+    SET_MEMORY_STAT(STAT_MCP_ResponseCacheMemory, 0);
+}
+
+// ============================================================================
+// EVENTS
+// ============================================================================
+
+bool FMCPResponseCache::IsTrackedWorld(const UWorld* World)
+{
+    return World && GEditor && World == GEditor->GetEditorWorldContext().World();
+}
+
+void FMCPResponseCache::HandleActorEvent(AActor* Actor)
+{
+    if (Actor && IsTrackedWorld(Actor->GetWorld()))
+    {
+        ++WorldGeneration;
+    }
+}
+
+void FMCPResponseCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    // Component edits (materials, transforms) count against the owning actor, as in the snapshot
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        HandleActorEvent(Actor);
+    }
+    else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+    {
+        // Blueprint component templates have no world but feed get_blueprint_material_info
+        if (Component->IsTemplate())
+        {
+            ++WorldGeneration;
+        }
+        else
+        {
+            HandleActorEvent(Component->GetOwner());
+        }
+    }
+}
+
+void FMCPResponseCache::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+    if (IsTrackedWorld(World))
+    {
+        ++WorldGeneration;
+    }
+}
+
+void FMCPResponseCache::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (IsTrackedWorld(World))
+    {
+        ++WorldGeneration;
+    }
+}
+
+// ============================================================================
+// KEYS
+// ============================================================================
+
+bool FMCPResponseCache::IsCacheableCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_available_materials")
+        || CommandType == TEXT("get_blueprint_material_info")
+        || CommandType == TEXT("get_actors_in_level")
+        || CommandType == TEXT("find_actors_by_name")
+        || CommandType == TEXT("get_actor_material_info");
+}
+
+FMCPResponseCache::EDependency FMCPResponseCache::GetDependencies(const FString& CommandType)
+{
+    // Material listings only reflect the asset registry
+    if (CommandType == TEXT("get_available_materials"))
+    {
+        return EDependency::Assets;
+    }
+    // Actor lists only reflect the level
+    if (CommandType == TEXT("get_actors_in_level") || CommandType == TEXT("find_actors_by_name"))
+    {
+        return EDependency::World;
+    }
+    // Material info names assets that can be renamed or deleted under the actor or Blueprint
+    return EDependency::World | EDependency::Assets;
+}
+
+FString FMCPResponseCache::MakeKey(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    FString Key = CommandType;
+    Key.AppendChar(TEXT('|'));
+    if (Params.IsValid())
+    {
+        AppendCanonical(MakeShared<FJsonValueObject>(Params), Key);
+    }
+    return Key;
+}
+
+void FMCPResponseCache::AppendCanonical(const TSharedPtr<FJsonValue>& Value, FString& Out)
+{
+    auto AppendString = [&Out](const FString& String)
+    {
+        Out.AppendChar(TEXT('"'));
+        Out.Append(String.ReplaceCharWithEscapedChar());
+        Out.AppendChar(TEXT('"'));
+    };
+
+    if (!Value.IsValid())
+    {
+        Out.Append(TEXT("null"));
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+        AppendString(Value->AsString());
+        break;
+
+    case EJson::Number:
+        Out.Append(FString::SanitizeFloat(Value->AsNumber()));
+        break;
+
+    case EJson::Boolean:
+        Out.Append(Value->AsBool() ? TEXT("true") : TEXT("false"));
+        break;
+
+    case EJson::Array:
+    {
+        Out.AppendChar(TEXT('['));
+        const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+        for (int32 Index = 0; Index < Array.Num(); ++Index)
+        {
+            if (Index > 0)
+            {
+                Out.AppendChar(TEXT(','));
+            }
+            AppendCanonical(Array[Index], Out);
+        }
+        Out.AppendChar(TEXT(']'));
+        break;
+    }
+
+    case EJson::Object:
+    {
+        // Sorted keys - clients serialize the same params in different orders
+        const TSharedPtr<FJsonObject> Object = Value->AsObject();
+        TArray<FString> Keys;
+        Object->Values.GetKeys(Keys);
+        Keys.Sort();
+
+        Out.AppendChar(TEXT('{'));
+        for (int32 Index = 0; Index < Keys.Num(); ++Index)
+        {
+            if (Index > 0)
+            {
+                Out.AppendChar(TEXT(','));
+            }
+            AppendString(Keys[Index]);
+            Out.AppendChar(TEXT(':'));
+            AppendCanonical(Object->Values[Keys[Index]], Out);
+        }
+        Out.AppendChar(TEXT('}'));
+        break;
+    }
+
+    default:
+        Out.Append(TEXT("null"));
+        break;
+    }
+}
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+FMCPResponseCache::FGenerations FMCPResponseCache::GetGenerations() const
+{
+    FGenerations Generations;
+    Generations.World = WorldGeneration.Load();
+    Generations.Assets = AssetGeneration.Load();
+    return Generations;
+}
+
+bool FMCPResponseCache::IsCurrent(const FEntry& Entry) const
+{
+    if (EnumHasAnyFlags(Entry.Dependencies, EDependency::World) && Entry.Generations.World != WorldGeneration.Load())
+    {
+        return false;
+    }
+    if (EnumHasAnyFlags(Entry.Dependencies, EDependency::Assets) && Entry.Generations.Assets != AssetGeneration.Load())
+    {
+        return false;
+    }
+    return true;
+}
+
+SIZE_T FMCPResponseCache::GetEntryBytes(const FString& Key, const FEntry& Entry)
+{
+    return Key.GetAllocatedSize() + Entry.Response.GetAllocatedSize() + sizeof(FEntry);
+}
+
+bool FMCPResponseCache::Find(const FString& Key, FString& OutResponse)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FEntry* Entry = Entries.Find(Key);
+    if (Entry && !IsCurrent(*Entry))
+    {
+        ++NumStale;
+        RemoveLocked(Key);
+        Entry = nullptr;
+    }
+
+    if (!Entry)
+    {
+        ++NumMisses;
+        INC_DWORD_STAT(STAT_MCP_ResponseCacheMisses);
+        return false;
+    }
+
+    ++NumHits;
+    INC_DWORD_STAT(STAT_MCP_ResponseCacheHits);
+    Entry->LastUsed = ++UseCounter;
+    OutResponse = Entry->Response;
+    return true;
+}
+
+void FMCPResponseCache::Store(const FString& Key, const FString& CommandType, const FGenerations& Generations, const FString& Response)
+{
+    FEntry NewEntry;
+    NewEntry.Generations = Generations;
+    NewEntry.Dependencies = GetDependencies(CommandType);
+
+    // Changed while the command ran - the response may already be stale
+    if (!IsCurrent(NewEntry))
+    {
+        return;
+    }
+
+    NewEntry.Response = Response;
+    const SIZE_T EntryBytes = GetEntryBytes(Key, NewEntry);
+    if (EntryBytes > MaxBytes / 4)
+    {
+        // One huge listing would push out everything else
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    RemoveLocked(Key);
+    EvictLocked(EntryBytes);
+
+    NewEntry.LastUsed = ++UseCounter;
+    Entries.Add(Key, MoveTemp(NewEntry));
+    TotalBytes += EntryBytes;
+    SET_MEMORY_STAT(STAT_MCP_ResponseCacheMemory, TotalBytes);
+}
+
+void FMCPResponseCache::RemoveLocked(const FString& Key)
+{
+    if (const FEntry* Entry = Entries.Find(Key))
+    {
+        TotalBytes -= GetEntryBytes(Key, *Entry);
+        Entries.Remove(Key);
+    }
+}
+
+void FMCPResponseCache::EvictLocked(SIZE_T IncomingBytes)
+{
+    while (Entries.Num() > 0 && (Entries.Num() >= MaxEntries || TotalBytes + IncomingBytes > MaxBytes))
+    {
+        // Stale entries first, then the least recently used; a linear scan is fine at this size
+        const FString* Victim = nullptr;
+        uint64 VictimLastUsed = MAX_uint64;
+        for (const TPair<FString, FEntry>& Pair : Entries)
+        {
+            if (!IsCurrent(Pair.Value))
+            {
+                Victim = &Pair.Key;
+                break;
+            }
+            if (Pair.Value.LastUsed < VictimLastUsed)
+            {
+                Victim = &Pair.Key;
+                VictimLastUsed = Pair.Value.LastUsed;
+            }
+        }
+
+        const FString VictimKey = *Victim;
+        RemoveLocked(VictimKey);
+        ++NumEvictions;
+    }
+}
+
+TSharedPtr<FJsonObject> FMCPResponseCache::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const uint64 NumLookups = NumHits + NumMisses;
+
+    TSharedPtr<FJsonObject> StatsObj = MakeShared<FJsonObject>();
+    StatsObj->SetNumberField(TEXT("hits"), static_cast<double>(NumHits));
+    StatsObj->SetNumberField(TEXT("misses"), static_cast<double>(NumMisses));
+    StatsObj->SetNumberField(TEXT("hit_rate"), NumLookups > 0 ? static_cast<double>(NumHits) / NumLookups : 0.0);
+    StatsObj->SetNumberField(TEXT("stale"), static_cast<double>(NumStale));
+    StatsObj->SetNumberField(TEXT("evictions"), static_cast<double>(NumEvictions));
+    StatsObj->SetNumberField(TEXT("entries"), Entries.Num());
+    StatsObj->SetNumberField(TEXT("bytes"), static_cast<double>(TotalBytes));
+    StatsObj->SetNumberField(TEXT("world_generation"), static_cast<double>(WorldGeneration.Load()));
+    StatsObj->SetNumberField(TEXT("asset_generation"), static_cast<double>(AssetGeneration.Load()));
+    return StatsObj;
+}
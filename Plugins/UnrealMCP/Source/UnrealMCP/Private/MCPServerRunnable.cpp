@@ -7,13 +7,88 @@
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
-#include "JsonObjectConverter.h"
-#include "Misc/ScopeLock.h"
-#include "HAL/PlatformTime.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "EpicUnrealMCPStats.h"
+#include "MCPSocketPoller.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP Parse Request"), STAT_MCP_ParseRequest, STATGROUP_UnrealMCP);
+DECLARE_CYCLE_STAT(TEXT("MCP Send Response"), STAT_MCP_SendResponse, STATGROUP_UnrealMCP);
+
+FMCPCompletionQueue::FMCPCompletionQueue()
+    : bWakePending(false)
+{
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    WakeAddress = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+    WakeAddress->SetLoopbackAddress();
+    WakeAddress->SetPort(0);
+
+    WakeSocket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("UnrealMCPServerWake"), FNetworkProtocolTypes::IPv4);
+    if (WakeSocket && WakeSocket->SetNonBlocking(true) && WakeSocket->Bind(*WakeAddress))
+    {
+        // Bound to an ephemeral port - read it back so wake-ups are sent to the socket itself
+        WakeSocket->GetAddress(*WakeAddress);
+        return;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to create wake socket - completions wait for the next poll timeout"));
+    if (WakeSocket)
+    {
+        SocketSubsystem->DestroySocket(WakeSocket);
+        WakeSocket = nullptr;
+    }
+}
+
+FMCPCompletionQueue::~FMCPCompletionQueue()
+{
+    if (WakeSocket)
+    {
+        WakeSocket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(WakeSocket);
+    }
+}
+
+void FMCPCompletionQueue::Enqueue(FMCPCompletedRequest&& Completed)
+{
+    Queue.Enqueue(MoveTemp(Completed));
+    Wake();
+}
+
+void FMCPCompletionQueue::Wake()
+{
+    if (WakeSocket && !bWakePending.Exchange(true))
+    {
+        const uint8 WakeByte = 0;
+        int32 BytesSent = 0;
+        WakeSocket->SendTo(&WakeByte, 1, BytesSent, *WakeAddress);
+    }
+}
+
+// Datagrams are read before the flag is cleared: a producer that finds the flag
+// still set has enqueued before the caller drains the queue, and one that finds
+// it clear sends a fresh datagram, so no completion is left without a wake-up
+void FMCPCompletionQueue::ConsumeWake()
+{
+    if (!WakeSocket)
+    {
+        return;
+    }
+
+    uint8 Scratch[64];
+    int32 BytesRead = 0;
+    while (WakeSocket->Recv(Scratch, sizeof(Scratch), BytesRead) && BytesRead > 0)
+    {
+    }
+    bWakePending = false;
+}
 
 FMCPServerRunnable::FMCPServerRunnable(UEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
-    : Bridge(InBridge)
+    : Completions(MakeShared<FMCPCompletionQueue, ESPMode::ThreadSafe>())
+    , TotalInFlight(0)
+    , Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
+    , Poller(MakeUnique<FMCPSocketPoller>())
+    , NextConnectionId(1)
     , bRunning(true)
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Created server runnable"));
@@ -21,133 +96,54 @@ FMCPServerRunnable::FMCPServerRunnable(UEpicUnrealMCPBridge* InBridge, TSharedPt
 
 FMCPServerRunnable::~FMCPServerRunnable()
 {
-    // Note: We don't delete the sockets here as they're owned by the bridge
+    // Note: The listener socket is owned by the bridge; client sockets are closed when Run exits
 }
 
 bool FMCPServerRunnable::Init()
 {
+    RecvScratch.SetNumUninitialized(RecvChunkSize);
     return true;
 }
 
 uint32 FMCPServerRunnable::Run()
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread starting..."));
-    
+
     while (bRunning)
     {
-        // UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Waiting for client connection..."));
-        
-        bool bPending = false;
-        if (ListenerSocket->HasPendingConnection(bPending) && bPending)
+        bool bDidWork = AcceptPendingConnections();
+        bDidWork |= DrainCompletions();
+
+        for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
         {
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection pending, accepting..."));
-            
-            ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
-            if (ClientSocket.IsValid())
-            {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection accepted"));
-                
-                // Set socket options to improve connection stability
-                ClientSocket->SetNoDelay(true);
-                int32 SocketBufferSize = 65536;  // 64KB buffer
-                ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
-                ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
-                
-                uint8 Buffer[8192];
-                while (bRunning)
-                {
-                    int32 BytesRead = 0;
-                    if (ClientSocket->Recv(Buffer, sizeof(Buffer) - 1, BytesRead))
-                    {
-                        if (BytesRead == 0)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
-                            break;
-                        }
-
-                        // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
-
-                        // Parse JSON
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
-                        
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
-                        {
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
-                            {
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
-                                
-                                // Log response for debugging
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-                                
-                                // Send response
-                                int32 BytesSent = 0;
-                                if (!ClientSocket->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent))
-                                {
-                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
-                                }
-                                else {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"), BytesSent);
-                                }
-                            }
-                            else
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
-                            }
-                        }
-                        else
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
-                        }
-                    }
-                    else
-                    {
-                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                        // Don't break the connection for WouldBlock error, which is normal for non-blocking sockets
-                        bool bShouldBreak = true;
-                        
-                        // Check for "would block" error which isn't a real error for non-blocking sockets
-                        if (LastError == SE_EWOULDBLOCK) 
-                        {
-                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Socket would block, continuing..."));
-                            bShouldBreak = false;
-                            // Small sleep to prevent tight loop when no data
-                            FPlatformProcess::Sleep(0.01f);
-                        }
-                        // Check for other transient errors we might want to tolerate
-                        else if (LastError == SE_EINTR) // Interrupted system call
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Socket read interrupted, continuing..."));
-                            bShouldBreak = false;
-                        }
-                        else 
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
-                        }
-                        
-                        if (bShouldBreak)
-                        {
-                            break;
-                        }
-                    }
-                }
-            }
-            else
+            FMCPClientConnection& Connection = *Connections[Index];
+
+            bDidWork |= FlushSend(Connection);
+            bDidWork |= ReadAvailable(Connection);
+            bDidWork |= ProcessFrames(Connection);
+            bDidWork |= DispatchRequests(Connection);
+            bDidWork |= FlushSend(Connection);
+
+            if (Connection.bClosed)
             {
-                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
+                CloseConnection(Connection);
+                Connections.RemoveAtSwap(Index);
             }
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.1f);
+
+        // Only block once a full sweep found nothing to do
+        if (!bDidWork)
+        {
+            WaitForActivity();
+        }
+    }
+
+    for (TUniquePtr<FMCPClientConnection>& Connection : Connections)
+    {
+        CloseConnection(*Connection);
     }
-    
+    Connections.Reset();
+
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread stopping"));
     return 0;
 }
@@ -155,164 +151,606 @@ uint32 FMCPServerRunnable::Run()
 void FMCPServerRunnable::Stop()
 {
     bRunning = false;
+    Completions->Wake();
 }
 
 void FMCPServerRunnable::Exit()
 {
 }
 
-void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSocket)
+// Accept every queued connection, refusing any beyond MaxConnections
+bool FMCPServerRunnable::AcceptPendingConnections()
 {
-    if (!InClientSocket.IsValid())
+    bool bProgress = false;
+    bool bPending = false;
+
+    while (ListenerSocket->HasPendingConnection(bPending) && bPending)
     {
-        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Invalid client socket passed to HandleClientConnection"));
-        return;
+        FSocket* NewSocket = ListenerSocket->Accept(TEXT("MCPClient"));
+        if (!NewSocket)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
+            break;
+        }
+
+        bProgress = true;
+
+        if (Connections.Num() >= MaxConnections)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Refusing client - %d connections already open"), Connections.Num());
+            NewSocket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(NewSocket);
+            continue;
+        }
+
+        // Accepted sockets do not inherit non-blocking mode on every platform
+        NewSocket->SetNonBlocking(true);
+        NewSocket->SetNoDelay(true);
+        int32 SocketBufferSize = 65536;  // 64KB buffer
+        NewSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
+        NewSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
+
+        TUniquePtr<FMCPClientConnection> Connection = MakeUnique<FMCPClientConnection>();
+        Connection->Socket = NewSocket;
+        Connection->Id = NextConnectionId++;
+
+        FMCPClientChannelPtr Channel = MakeShared<FMCPClientChannel, ESPMode::ThreadSafe>();
+        Channel->ConnectionId = Connection->Id;
+        Channel->Send = [Completions = Completions, ChannelPtr = Channel.Get()](FString&& Line)
+        {
+            if (!ChannelPtr->IsOpen())
+            {
+                return;
+            }
+
+            FMCPCompletedRequest Notification;
+            Notification.ConnectionId = ChannelPtr->ConnectionId;
+            Notification.Response = MoveTemp(Line);
+            Notification.bFinal = false;
+            Completions->Enqueue(MoveTemp(Notification));
+        };
+        Connection->Channel = MoveTemp(Channel);
+
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client %u connected (%d open)"),
+            Connection->Id, Connections.Num() + 1);
+
+        Connections.Add(MoveTemp(Connection));
     }
 
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting to handle client connection"));
-    
-    // Set socket options for better connection stability
-    InClientSocket->SetNonBlocking(false);
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Set socket to blocking mode"));
-    
-    // Properly read full message with timeout
-    const int32 MaxBufferSize = 4096;
-    uint8 Buffer[MaxBufferSize];
-    FString MessageBuffer;
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting message receive loop"));
-    
-    while (bRunning && InClientSocket.IsValid())
-    {
-        // Log socket state
-        bool bIsConnected = InClientSocket->GetConnectionState() == SCS_Connected;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Socket state - Connected: %s"), 
-               bIsConnected ? TEXT("true") : TEXT("false"));
-        
-        // Log pending data status before receive
-        uint32 PendingDataSize = 0;
-        bool HasPendingData = InClientSocket->HasPendingData(PendingDataSize);
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Before Recv - HasPendingData=%s, Size=%d"), 
-               HasPendingData ? TEXT("true") : TEXT("false"), PendingDataSize);
-        
-        // Try to receive data with timeout
+    return bProgress;
+}
+
+// Drain whatever the socket has into the connection's receive buffer
+bool FMCPServerRunnable::ReadAvailable(FMCPClientConnection& Connection)
+{
+    bool bProgress = false;
+
+    while (WantsRead(Connection))
+    {
         int32 BytesRead = 0;
-        bool bReadSuccess = false;
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Attempting to receive data..."));
-        bReadSuccess = InClientSocket->Recv(Buffer, MaxBufferSize - 1, BytesRead, ESocketReceiveFlags::None);
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Recv attempt complete - Success=%s, BytesRead=%d"), 
-               bReadSuccess ? TEXT("true") : TEXT("false"), BytesRead);
-        
-        if (BytesRead > 0)
+        if (!Connection.Socket->Recv(RecvScratch.GetData(), RecvChunkSize, BytesRead))
         {
-            // Log raw data for debugging
-            FString HexData;
-            for (int32 i = 0; i < FMath::Min(BytesRead, 50); ++i)
+            const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+            if (LastError != SE_EWOULDBLOCK && LastError != SE_EINTR)
             {
-                HexData += FString::Printf(TEXT("%02X "), Buffer[i]);
+                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client %u disconnected (error %d)"),
+                    Connection.Id, (int32)LastError);
+                Connection.bClosed = true;
             }
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Raw data (first 50 bytes hex): %s%s"), 
-                   *HexData, BytesRead > 50 ? TEXT("...") : TEXT(""));
-            
-            // Convert and log received data
-            Buffer[BytesRead] = 0; // Null terminate
-            FString ReceivedData = UTF8_TO_TCHAR(Buffer);
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received data as string: '%s'"), *ReceivedData);
-            
-            // Append to message buffer
-            MessageBuffer.Append(ReceivedData);
-            
-            // Process complete messages (messages are terminated with newline)
-            if (MessageBuffer.Contains(TEXT("\n")))
+            break;
+        }
+
+        // Non-blocking stream sockets report "would block" as success with zero bytes
+        if (BytesRead <= 0)
+        {
+            break;
+        }
+
+        Connection.RecvBuffer.Append(RecvScratch.GetData(), BytesRead);
+        bProgress = true;
+
+        if (BytesRead < RecvChunkSize)
+        {
+            break;
+        }
+    }
+
+    return bProgress;
+}
+
+// Backpressure: stop reading while the client is not draining responses or
+// already has a frame's worth of unprocessed requests; TCP flow control then
+// slows the client down instead of the server buffering without bound
+bool FMCPServerRunnable::WantsRead(const FMCPClientConnection& Connection) const
+{
+    return !Connection.bClosed
+        && !Connection.bCloseAfterFlush
+        && Connection.GetPendingSendBytes() < MaxPendingSendBytes
+        && Connection.RecvBuffer.Num() < MaxFrameBytes;
+}
+
+// Split the receive buffer into complete JSON objects and queue them as requests
+bool FMCPServerRunnable::ProcessFrames(FMCPClientConnection& Connection)
+{
+    bool bProgress = false;
+    int32 FramesThisSweep = 0;
+
+    while (!Connection.bClosed
+        && !Connection.bCloseAfterFlush
+        && FramesThisSweep < MaxFramesPerSweep
+        && Connection.PendingRequests.Num() < MaxQueuedRequestsPerConnection
+        && Connection.GetPendingSendBytes() < MaxPendingSendBytes)
+    {
+        const uint8* Data = Connection.RecvBuffer.GetData();
+        const int32 NumBytes = Connection.RecvBuffer.Num();
+        int32 FrameEnd = INDEX_NONE;
+
+        // Resume where the previous scan stopped so a large request arriving in
+        // many chunks is scanned once, not once per chunk
+        for (int32 Index = Connection.ScanOffset; Index < NumBytes; ++Index)
+        {
+            const uint8 Byte = Data[Index];
+
+            if (Connection.FrameStart == INDEX_NONE)
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Newline detected in buffer, processing messages"));
-                
-                TArray<FString> Messages;
-                MessageBuffer.ParseIntoArray(Messages, TEXT("\n"), true);
-                
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Found %d message(s) in buffer"), Messages.Num());
-                
-                // Process all complete messages
-                for (int32 i = 0; i < Messages.Num() - 1; ++i)
+                if (Byte == '{')
+                {
+                    Connection.FrameStart = Index;
+                    Connection.Depth = 1;
+                    Connection.bInString = false;
+                    Connection.bEscape = false;
+                }
+                else if (Byte != ' ' && Byte != '\t' && Byte != '\r' && Byte != '\n')
                 {
-                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message %d: '%s'"), 
-                           i + 1, *Messages[i]);
-                    ProcessMessage(InClientSocket, Messages[i]);
+                    QueueErrorResponse(Connection, TEXT("Expected a JSON object"));
+                    Connection.bCloseAfterFlush = true;
+                    return true;
                 }
-                
-                // Keep any incomplete message in the buffer
-                MessageBuffer = Messages.Last();
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Remaining buffer after processing: %s"), 
-                       *MessageBuffer);
+                continue;
+            }
+
+            if (Connection.bInString)
+            {
+                if (Connection.bEscape)
+                {
+                    Connection.bEscape = false;
+                }
+                else if (Byte == '\\')
+                {
+                    Connection.bEscape = true;
+                }
+                else if (Byte == '"')
+                {
+                    Connection.bInString = false;
+                }
+            }
+            else if (Byte == '"')
+            {
+                Connection.bInString = true;
+            }
+            else if (Byte == '{')
+            {
+                ++Connection.Depth;
+            }
+            else if (Byte == '}' && --Connection.Depth == 0)
+            {
+                FrameEnd = Index + 1;
+                break;
+            }
+        }
+
+        if (FrameEnd == INDEX_NONE)
+        {
+            // Incomplete - drop anything before the frame and wait for more bytes
+            if (Connection.FrameStart == INDEX_NONE)
+            {
+                Connection.RecvBuffer.Reset();
+                Connection.ScanOffset = 0;
             }
             else
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: No complete message yet (no newline detected)"));
+                if (Connection.FrameStart > 0)
+                {
+                    Connection.RecvBuffer.RemoveAt(0, Connection.FrameStart, EAllowShrinking::No);
+                    Connection.FrameStart = 0;
+                }
+                Connection.ScanOffset = Connection.RecvBuffer.Num();
+
+                if (Connection.RecvBuffer.Num() >= MaxFrameBytes)
+                {
+                    QueueErrorResponse(Connection, FString::Printf(TEXT("Request exceeds %d bytes"), MaxFrameBytes));
+                    Connection.bCloseAfterFlush = true;
+                    bProgress = true;
+                }
             }
+            break;
         }
-        else if (!bReadSuccess)
+
+        HandleFrame(Connection, Data + Connection.FrameStart, FrameEnd - Connection.FrameStart);
+
+        Connection.RecvBuffer.RemoveAt(0, FrameEnd, EAllowShrinking::No);
+        Connection.ScanOffset = 0;
+        Connection.FrameStart = INDEX_NONE;
+        Connection.Depth = 0;
+
+        ++FramesThisSweep;
+        bProgress = true;
+    }
+
+    return bProgress;
+}
+
+// Hand queued requests to the game thread while the connection has free slots
+bool FMCPServerRunnable::DispatchRequests(FMCPClientConnection& Connection)
+{
+    bool bProgress = false;
+
+    while (!Connection.bClosed
+        && Connection.PendingRequests.Num() > 0
+        && Connection.InFlight < MaxInFlightPerConnection
+        && !Connection.bUntaggedInFlight)
+    {
+        FMCPPendingRequest& Request = Connection.PendingRequests[0];
+        const bool bTagged = !Request.IdPrefix.IsEmpty();
+
+        // An untagged response can only be matched by order, so it waits for
+        // everything ahead of it and holds back everything behind it
+        if (!bTagged && Connection.InFlight > 0)
         {
-            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Connection closed or error occurred - Last error: %d"), 
-                   (int32)ISocketSubsystem::Get()->GetLastErrorCode());
             break;
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.01f);
+
+        ++Connection.InFlight;
+        ++TotalInFlight;
+        Connection.bUntaggedInFlight = !bTagged;
+
+        // HandleFrame refuses tagged ids already in flight, so this never replaces a live handle
+        Connection.ActiveRequests.Add(Request.IdPrefix, Request.Handle);
+
+        // Only tagged clients can tell a progress line from the response
+        if (bTagged)
+        {
+            Request.Handle->OnProgress = [Channel = Connection.Channel, IdPrefix = Request.IdPrefix](int32 Done, int32 Total)
+            {
+                Channel->Send(FString::Printf(TEXT("%s\"status\":\"progress\",\"done\":%d,\"total\":%d}"), *IdPrefix, Done, Total));
+            };
+        }
+
+        Bridge->ExecuteCommandAsync(Request.CommandType, Request.Params,
+            [Completions = Completions, ConnectionId = Connection.Id, IdPrefix = MoveTemp(Request.IdPrefix)](FString&& Response) mutable
+            {
+                FMCPCompletedRequest Completed;
+                Completed.ConnectionId = ConnectionId;
+                Completed.IdPrefix = MoveTemp(IdPrefix);
+                Completed.Response = MoveTemp(Response);
+                Completions->Enqueue(MoveTemp(Completed));
+            },
+            MoveTemp(Request.Handle));
+
+        Connection.PendingRequests.RemoveAt(0, 1, EAllowShrinking::No);
+        bProgress = true;
+    }
+
+    return bProgress;
+}
+
+// Route responses finished on the game thread back to their connections
+bool FMCPServerRunnable::DrainCompletions()
+{
+    bool bProgress = false;
+    FMCPCompletedRequest Completed;
+
+    Completions->ConsumeWake();
+    while (Completions->Dequeue(Completed))
+    {
+        bProgress = true;
+        if (Completed.bFinal)
+        {
+            --TotalInFlight;
+        }
+
+        TUniquePtr<FMCPClientConnection>* Found = Connections.FindByPredicate(
+            [&Completed](const TUniquePtr<FMCPClientConnection>& Connection) { return Connection->Id == Completed.ConnectionId; });
+        if (!Found || (*Found)->bClosed)
+        {
+            // Client went away while its command was running
+            continue;
+        }
+
+        FMCPClientConnection& Connection = **Found;
+        if (!Completed.bFinal)
+        {
+            // Notifications are best-effort: a client that stops reading loses them
+            // rather than growing the send buffer without bound
+            if (Connection.GetPendingSendBytes() >= MaxPendingSendBytes)
+            {
+                Connection.bNotificationsDropped = true;
+            }
+            else
+            {
+                QueueResponse(Connection, Completed.Response);
+            }
+            continue;
+        }
+
+        --Connection.InFlight;
+        Connection.ActiveRequests.Remove(Completed.IdPrefix);
+
+        if (Completed.IdPrefix.IsEmpty())
+        {
+            Connection.bUntaggedInFlight = false;
+            QueueResponse(Connection, Completed.Response);
+        }
+        else if (Completed.Response.StartsWith(TEXT("{")))
+        {
+            // Splice the id in as the first field rather than re-parsing the response
+            QueueResponse(Connection, Completed.IdPrefix + Completed.Response.RightChop(1));
+        }
+        else
+        {
+            QueueResponse(Connection, Completed.Response);
+        }
+    }
+
+    return bProgress;
+}
+
+// Write as much of the pending response bytes as the socket will take
+bool FMCPServerRunnable::FlushSend(FMCPClientConnection& Connection)
+{
+    if (Connection.bClosed)
+    {
+        return false;
+    }
+
+    const int32 PendingBytes = Connection.GetPendingSendBytes();
+    if (PendingBytes == 0)
+    {
+        if (Connection.bCloseAfterFlush)
+        {
+            Connection.bClosed = true;
+        }
+        return false;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_SendResponse);
+
+    int32 BytesSent = 0;
+    if (!Connection.Socket->Send(Connection.SendBuffer.GetData() + Connection.SendOffset, PendingBytes, BytesSent))
+    {
+        const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+        if (LastError != SE_EWOULDBLOCK && LastError != SE_EINTR)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send to client %u (error %d)"),
+                Connection.Id, (int32)LastError);
+            Connection.bClosed = true;
+        }
+        return false;
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Exited message receive loop"));
+
+    Connection.SendOffset += BytesSent;
+
+    // Caught up after dropping notifications - tell the client its mirror is stale
+    if (Connection.bNotificationsDropped && Connection.GetPendingSendBytes() < MaxPendingSendBytes / 2)
+    {
+        Connection.bNotificationsDropped = false;
+        QueueResponse(Connection, TEXT("{\"event\":\"resync\",\"reason\":\"overflow\"}"));
+    }
+
+    if (Connection.GetPendingSendBytes() == 0)
+    {
+        Connection.SendBuffer.Reset();
+        Connection.SendOffset = 0;
+
+        if (Connection.bCloseAfterFlush)
+        {
+            Connection.bClosed = true;
+        }
+    }
+    else if (Connection.SendOffset >= RecvChunkSize)
+    {
+        // Partial send - compact occasionally so the buffer does not creep
+        Connection.SendBuffer.RemoveAt(0, Connection.SendOffset, EAllowShrinking::No);
+        Connection.SendOffset = 0;
+    }
+
+    return BytesSent > 0;
 }
 
-void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message)
+void FMCPServerRunnable::HandleFrame(FMCPClientConnection& Connection, const uint8* Data, int32 Length)
 {
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message: %s"), *Message);
-    
-    // Parse message as JSON
-    TSharedPtr<FJsonObject> JsonMessage;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse message as JSON"));
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data), Length);
+    const FString Message(Converted.Length(), Converted.Get());
+
+    UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Client %u request: %s"), Connection.Id, *Message);
+
+    // Parse JSON
+    TSharedPtr<FJsonObject> JsonObject;
+    bool bParsed = false;
+    {
+        UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_ParseRequest);
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+        bParsed = FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid();
+    }
+
+    if (!bParsed)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from client %u"), Connection.Id);
+        QueueErrorResponse(Connection, TEXT("Invalid JSON request"));
         return;
     }
-    
-    // Extract command type and parameters using MCP protocol format
+
+    // "type" is what the Python server sends; "command" is the MCP-style spelling
     FString CommandType;
-    TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject());
-    
-    if (!JsonMessage->TryGetStringField(TEXT("command"), CommandType))
+    if (!JsonObject->TryGetStringField(TEXT("type"), CommandType)
+        && !JsonObject->TryGetStringField(TEXT("command"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+        QueueErrorResponse(Connection, TEXT("Missing 'type' field"));
+        return;
+    }
+
+    // An "id" of any JSON type is echoed back verbatim; serialize it once here
+    // as the opening of the response object
+    FString IdPrefix = MakeIdPrefix(JsonObject->TryGetField(TEXT("id")));
+
+    // Parameters are optional
+    const TSharedPtr<FJsonObject>* ParamsField = nullptr;
+    TSharedPtr<FJsonObject> Params = JsonObject->TryGetObjectField(TEXT("params"), ParamsField) && ParamsField
+        ? *ParamsField
+        : MakeShared<FJsonObject>();
+
+    if (CommandType == TEXT("cancel"))
+    {
+        HandleCancel(Connection, Params, IdPrefix);
+        return;
+    }
+
+    // Responses, progress and cancellation are all matched by id, so an id that
+    // is still queued or running on this connection cannot be reused yet
+    if (!IdPrefix.IsEmpty()
+        && (Connection.ActiveRequests.Contains(IdPrefix)
+            || Connection.PendingRequests.ContainsByPredicate([&IdPrefix](const FMCPPendingRequest& Pending) { return Pending.IdPrefix == IdPrefix; })))
     {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Message missing 'command' field"));
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client %u reused an in-flight request id"), Connection.Id);
+        QueueErrorResponse(Connection, TEXT("Duplicate request id - a request with this id is already in flight"), IdPrefix);
         return;
     }
-    
-    // Parameters are optional in MCP protocol
-    if (JsonMessage->HasField(TEXT("params")))
+
+    FMCPPendingRequest& Request = Connection.PendingRequests.AddDefaulted_GetRef();
+    Request.CommandType = MoveTemp(CommandType);
+    Request.Params = MoveTemp(Params);
+    Request.IdPrefix = MoveTemp(IdPrefix);
+    Request.Handle = MakeShared<FMCPRequestHandle, ESPMode::ThreadSafe>();
+    Request.Handle->Channel = Connection.Channel;
+}
+
+FString FMCPServerRunnable::MakeIdPrefix(const TSharedPtr<FJsonValue>& IdValue)
+{
+    FString IdPrefix;
+    if (!IdValue.IsValid() || IdValue->IsNull())
+    {
+        return IdPrefix;
+    }
+
+    TSharedRef<FJsonObject> IdObject = MakeShared<FJsonObject>();
+    IdObject->SetField(TEXT("id"), IdValue);
+
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&IdPrefix);
+    FJsonSerializer::Serialize(IdObject, Writer);
+
+    IdPrefix.LeftChopInline(1, EAllowShrinking::No);
+    IdPrefix += TEXT(",");
+    return IdPrefix;
+}
+
+// Requests still queued here are dropped with a "Cancelled" error; ones already
+// on the game thread are flagged and answer with whatever they finished
+void FMCPServerRunnable::HandleCancel(FMCPClientConnection& Connection, const TSharedPtr<FJsonObject>& Params, const FString& IdPrefix)
+{
+    const FString TargetPrefix = MakeIdPrefix(Params->TryGetField(TEXT("id")));
+    if (TargetPrefix.IsEmpty())
+    {
+        QueueErrorResponse(Connection, TEXT("Missing 'id' parameter"), IdPrefix);
+        return;
+    }
+
+    bool bFound = false;
+    const int32 PendingIndex = Connection.PendingRequests.IndexOfByPredicate(
+        [&TargetPrefix](const FMCPPendingRequest& Request) { return Request.IdPrefix == TargetPrefix; });
+
+    if (PendingIndex != INDEX_NONE)
     {
-        TSharedPtr<FJsonValue> ParamsValue = JsonMessage->TryGetField(TEXT("params"));
-        if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
+        Connection.PendingRequests.RemoveAt(PendingIndex);
+        QueueErrorResponse(Connection, TEXT("Cancelled"), TargetPrefix);
+        bFound = true;
+    }
+    else if (FMCPRequestHandlePtr* Active = Connection.ActiveRequests.Find(TargetPrefix))
+    {
+        (*Active)->bCancelled = true;
+        bFound = true;
+    }
+
+    const FString Response = FString::Printf(TEXT("{\"status\":\"success\",\"result\":{\"cancelled\":%s}}"),
+        bFound ? TEXT("true") : TEXT("false"));
+    QueueResponse(Connection, IdPrefix.IsEmpty() ? Response : IdPrefix + Response.RightChop(1));
+}
+
+// Responses are newline-terminated so line-based clients can frame them too
+void FMCPServerRunnable::QueueResponse(FMCPClientConnection& Connection, const FString& Response)
+{
+    UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Client %u response: %s"), Connection.Id, *Response);
+
+    const FTCHARToUTF8 Utf8(*Response);
+    Connection.SendBuffer.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    Connection.SendBuffer.Add('\n');
+}
+
+void FMCPServerRunnable::QueueErrorResponse(FMCPClientConnection& Connection, const FString& ErrorMessage, const FString& IdPrefix)
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    // Condensed so the reply stays on a single line
+    FString Response;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Response);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    QueueResponse(Connection, IdPrefix.IsEmpty() ? Response : IdPrefix + Response.RightChop(1));
+}
+
+// One readiness wait over the listener (new connections), every client (data
+// to read, or room to write a pending response) and the completion queue's
+// wake socket (a command finished on the game thread)
+void FMCPServerRunnable::WaitForActivity()
+{
+    Poller->Reset(ListenerSocket.Get());
+    Poller->Add(ListenerSocket.Get(), true, false);
+    Poller->Add(Completions->GetWakeSocket(), true, false);
+
+    for (const TUniquePtr<FMCPClientConnection>& Connection : Connections)
+    {
+        if (!Connection->bClosed)
         {
-            Params = ParamsValue->AsObject();
+            Poller->Add(Connection->Socket, WantsRead(*Connection), Connection->GetPendingSendBytes() > 0);
         }
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-    
-    // Execute command
-    FString Response = Bridge->ExecuteCommand(CommandType, Params);
-    
-    // Send response with newline terminator
-    Response += TEXT("\n");
-    int32 BytesSent = 0;
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-    
-    if (!Client->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent))
+
+    // Without a wake socket nothing signals a completion, and without native
+    // polling only the listener is watched - either way, keep the wait short
+    // while there is anything besides a new connection to wait for
+    const bool bOnlyListener = Connections.Num() == 0 && TotalInFlight == 0;
+    const bool bCanBlock = Poller->WaitsOnAllSockets() ? (Completions->GetWakeSocket() || TotalInFlight == 0) : bOnlyListener;
+    Poller->Wait(bCanBlock ? MaxWaitMs : 1);
+}
+
+void FMCPServerRunnable::CloseConnection(FMCPClientConnection& Connection)
+{
+    if (!Connection.Socket)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Closing client %u"), Connection.Id);
+
+    // Nobody is left to read the results - stop sliced commands at their next slice
+    for (TPair<FString, FMCPRequestHandlePtr>& Active : Connection.ActiveRequests)
+    {
+        Active.Value->bCancelled = true;
+    }
+    Connection.ActiveRequests.Reset();
+    Connection.PendingRequests.Reset();
+
+    // Subscriptions holding the channel drop it on their next flush
+    if (Connection.Channel.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response"));
+        Connection.Channel->bClosed = true;
     }
-} 
\ No newline at end of file
+
+    Connection.Socket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Connection.Socket);
+    Connection.Socket = nullptr;
+}
@@ -0,0 +1,117 @@
+// File: MCPSocketPoller.cpp
+// Purpose: Native multi-socket poll for BSD socket platforms, FSocket::Wait elsewhere
+
+#include "MCPSocketPoller.h"
+#include "Sockets.h"
+#include "SocketTypes.h"
+
+#if PLATFORM_HAS_BSD_SOCKETS
+// Engine-private header - see MCPSocketPoller.h
+#include "BSDSockets/SocketsBSD.h"
+#if !PLATFORM_WINDOWS
+#include <poll.h>
+#endif
+#endif
+
+struct FMCPSocketPoller::FNativeFds
+{
+#if PLATFORM_HAS_BSD_SOCKETS
+#if PLATFORM_WINDOWS
+    using FPollFd = WSAPOLLFD;
+    static int32 Poll(FPollFd* Fds, int32 NumFds, int32 TimeoutMs) { return WSAPoll(Fds, NumFds, TimeoutMs); }
+#else
+    using FPollFd = pollfd;
+    static int32 Poll(FPollFd* Fds, int32 NumFds, int32 TimeoutMs) { return poll(Fds, NumFds, TimeoutMs); }
+#endif
+
+    TArray<FPollFd> Fds;
+#endif
+};
+
+namespace
+{
+#if PLATFORM_HAS_BSD_SOCKETS
+    // Every server socket comes from PLATFORM_SOCKETSUBSYSTEM, which on these
+    // platforms is FSocketSubsystemBSD; its sockets are FSocketBSD and report
+    // an IP protocol. Anything else (a platform or online subsystem socket)
+    // must not be cast.
+    bool IsBSDSocket(const FSocket* Socket)
+    {
+        const FName Protocol = Socket->GetProtocol();
+        return Protocol == FNetworkProtocolTypes::IPv4 || Protocol == FNetworkProtocolTypes::IPv6;
+    }
+#endif
+}
+
+FMCPSocketPoller::FMCPSocketPoller()
+    : NativeFds(MakeUnique<FNativeFds>())
+    , FallbackSocket(nullptr)
+    , bNativeWait(PLATFORM_HAS_BSD_SOCKETS != 0)
+{
+}
+
+FMCPSocketPoller::~FMCPSocketPoller()
+{
+}
+
+void FMCPSocketPoller::Reset(FSocket* InFallbackSocket)
+{
+    FallbackSocket = InFallbackSocket;
+#if PLATFORM_HAS_BSD_SOCKETS
+    NativeFds->Fds.Reset();
+    bNativeWait = true;
+#endif
+}
+
+void FMCPSocketPoller::Add(FSocket* Socket, bool bRead, bool bWrite)
+{
+    if (!Socket || (!bRead && !bWrite))
+    {
+        return;
+    }
+
+#if PLATFORM_HAS_BSD_SOCKETS
+    if (!bNativeWait)
+    {
+        return;
+    }
+
+    if (!IsBSDSocket(Socket))
+    {
+        static bool bWarned = false;
+        if (!bWarned)
+        {
+            bWarned = true;
+            UE_LOG(LogTemp, Warning, TEXT("MCPSocketPoller: Socket '%s' is not a BSD socket - waiting on the listener only"),
+                *Socket->GetDescription());
+        }
+        bNativeWait = false;
+        return;
+    }
+
+    FNativeFds::FPollFd& Fd = NativeFds->Fds.AddZeroed_GetRef();
+    Fd.fd = static_cast<FSocketBSD*>(Socket)->GetNativeSocket();
+    Fd.events = static_cast<decltype(Fd.events)>((bRead ? POLLIN : 0) | (bWrite ? POLLOUT : 0));
+#endif
+}
+
+void FMCPSocketPoller::Wait(int32 TimeoutMs)
+{
+#if PLATFORM_HAS_BSD_SOCKETS
+    if (bNativeWait)
+    {
+        FNativeFds::Poll(NativeFds->Fds.GetData(), NativeFds->Fds.Num(), TimeoutMs);
+        return;
+    }
+#endif
+
+    if (FallbackSocket)
+    {
+        // Returns as soon as a client connects; otherwise blocks for the whole timeout
+        FallbackSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(TimeoutMs));
+    }
+    else
+    {
+        FPlatformProcess::Sleep(TimeoutMs / 1000.0f);
+    }
+}
@@ -0,0 +1,44 @@
+// File: MCPSocketPoller.h
+// Purpose: One readiness wait over every socket the MCP server thread owns
+//
+// FSocket::Wait only waits on one socket. Where the platform socket subsystem
+// is the engine's BSD implementation, the poller takes the native handle out
+// of each FSocketBSD and waits on all of them with one poll()/WSAPoll call.
+// FSocketBSD is engine-private (Source/Runtime/Sockets/Private, added in
+// UnrealMCP.Build.cs), so this pair of files is the only code that includes
+// it, and a socket is only cast after its protocol confirms it is a BSD one.
+// On other platforms, or when a socket fails that check, Wait falls back to
+// FSocket::Wait on the single fallback socket (the listener).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSocket;
+
+struct FMCPSocketPoller
+{
+	FMCPSocketPoller();
+	~FMCPSocketPoller();
+
+	// Start a new wait set; FallbackSocket is what Wait blocks on without native polling
+	void Reset(FSocket* InFallbackSocket);
+
+	// Add a socket to the wait set
+	void Add(FSocket* Socket, bool bRead, bool bWrite);
+
+	// Block until a socket in the set is ready or TimeoutMs elapses
+	void Wait(int32 TimeoutMs);
+
+	// False when the wait set degraded to the fallback socket only - callers
+	// with other sockets to watch should then wait with a short timeout
+	bool WaitsOnAllSockets() const { return bNativeWait; }
+
+private:
+	// Platform pollfd array, reused every wait so polling does not allocate
+	struct FNativeFds;
+	TUniquePtr<FNativeFds> NativeFds;
+
+	FSocket* FallbackSocket;
+	bool bNativeWait;
+};
@@ -0,0 +1,771 @@
+// File: MCPWorldSnapshot.cpp
+// Purpose: Per-frame world snapshot for answering read-only queries off the game thread
+
+#include "MCPWorldSnapshot.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "Algo/Sort.h"
+#include "Commands/EpicUnrealMCPEditorCommands.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "EpicUnrealMCPStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("MCP World Snapshot Refresh"), STAT_MCP_SnapshotRefresh, STATGROUP_UnrealMCP);
+DECLARE_CYCLE_STAT(TEXT("MCP World Snapshot Query"), STAT_MCP_SnapshotQuery, STATGROUP_UnrealMCP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MCP World Snapshot Actors"), STAT_MCP_SnapshotActors, STATGROUP_UnrealMCP);
+
+// ============================================================================
+// SNAPSHOT
+// ============================================================================
+
+int32 FMCPWorldSnapshot::FindClass(const FString& ClassName) const
+{
+    if (!Classes.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    const bool bIsPath = ClassName.Contains(TEXT("/"));
+    const FString ShortName = !bIsPath && ClassName.Len() > 1 && ClassName[0] == TEXT('A') && FChar::IsUpper(ClassName[1])
+        ? ClassName.RightChop(1) : FString();
+
+    int32 PrefixedMatch = INDEX_NONE;
+    for (int32 Index = 0; Index < Classes->Num(); ++Index)
+    {
+        const FMCPClassSnapshot& Class = (*Classes)[Index];
+        if (bIsPath)
+        {
+            if (Class.Path == ClassName)
+            {
+                return Index;
+            }
+        }
+        else if (Class.Name == *ClassName)
+        {
+            return Index;
+        }
+        else if (!ShortName.IsEmpty() && Class.Name == *ShortName)
+        {
+            // Accept the C++ spelling, e.g. AStaticMeshActor, unless a class really has the prefixed name
+            PrefixedMatch = Index;
+        }
+    }
+    return PrefixedMatch;
+}
+
+bool FMCPWorldSnapshot::IsChildOf(int32 ClassIndex, int32 BaseIndex) const
+{
+    while (ClassIndex != INDEX_NONE)
+    {
+        if (ClassIndex == BaseIndex)
+        {
+            return true;
+        }
+        ClassIndex = (*Classes)[ClassIndex].Parent;
+    }
+    return false;
+}
+
+const FMCPClassSnapshot* FMCPWorldSnapshot::GetClass(int32 ClassIndex) const
+{
+    return Classes.IsValid() && Classes->IsValidIndex(ClassIndex) ? &(*Classes)[ClassIndex] : nullptr;
+}
+
+// ============================================================================
+// CACHE LIFECYCLE
+// ============================================================================
+
+FMCPWorldSnapshotCache::FMCPWorldSnapshotCache()
+{
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPWorldSnapshotCache::HandleActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPWorldSnapshotCache::HandleActorDeleted);
+        ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPWorldSnapshotCache::HandleActorChanged);
+    }
+
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPWorldSnapshotCache::HandleActorChanged);
+    ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddRaw(this, &FMCPWorldSnapshotCache::HandleObjectRenamed);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPWorldSnapshotCache::HandleObjectPropertyChanged);
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FMCPWorldSnapshotCache::HandleObjectsReplaced);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FMCPWorldSnapshotCache::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FMCPWorldSnapshotCache::HandleLevelChanged);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPWorldSnapshotCache::HandleWorldCleanup);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPWorldSnapshotCache::HandleUndoRedo);
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FMCPWorldSnapshotCache::Tick));
+}
+
+FMCPWorldSnapshotCache::~FMCPWorldSnapshotCache()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    }
+
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+}
+
+bool FMCPWorldSnapshotCache::IsSnapshotCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_actors_in_level")
+        || CommandType == TEXT("find_actors_by_name")
+        || CommandType == TEXT("get_actor_material_info");
+}
+
+bool FMCPWorldSnapshotCache::IsReadOnlyCommand(const FString& CommandType)
+{
+    return IsSnapshotCommand(CommandType)
+        || CommandType == TEXT("ping")
+        || CommandType == TEXT("get_available_materials")
+        || CommandType == TEXT("get_blueprint_material_info")
+        || CommandType == TEXT("get_response_cache_stats")
+        || CommandType == TEXT("subscribe")
+        || CommandType == TEXT("unsubscribe");
+}
+
+FMCPWorldSnapshotPtr FMCPWorldSnapshotCache::GetSnapshot() const
+{
+    FReadScopeLock ReadLock(PublishedLock);
+    return Published;
+}
+
+void FMCPWorldSnapshotCache::MarkWorldChanged()
+{
+    check(IsInGameThread());
+    bNeedsRebuild = true;
+    bDirty = true;
+}
+
+// ============================================================================
+// QUERIES (any thread)
+// ============================================================================
+
+bool FMCPWorldSnapshotCache::TryExecute(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TSharedPtr<FJsonObject>& OutResult)
+{
+    if (!IsSnapshotCommand(CommandType) || !Params.IsValid())
+    {
+        return false;
+    }
+
+    // Dirty is checked before loading the snapshot: Publish stores the snapshot before
+    // clearing it, so a clean flag guarantees a snapshot at least that recent
+    if (bDirty)
+    {
+        bRefreshRequested = true;
+        return false;
+    }
+
+    FMCPWorldSnapshotPtr Snapshot = GetSnapshot();
+    if (!Snapshot.IsValid())
+    {
+        bRefreshRequested = true;
+        return false;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_SnapshotQuery);
+
+    bool bFallBack = false;
+    if (CommandType == TEXT("get_actors_in_level"))
+    {
+        OutResult = QueryActorsInLevel(*Snapshot, Params, bFallBack);
+    }
+    else if (CommandType == TEXT("find_actors_by_name"))
+    {
+        OutResult = QueryActorsByName(*Snapshot, Params, bFallBack);
+    }
+    else
+    {
+        OutResult = QueryActorMaterialInfo(*Snapshot, Params, bFallBack);
+    }
+
+    if (bFallBack)
+    {
+        OutResult.Reset();
+        return false;
+    }
+
+    if (!OutResult->HasField(TEXT("success")))
+    {
+        OutResult->SetNumberField(TEXT("snapshot_frame"), static_cast<double>(Snapshot->Frame));
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> FMCPWorldSnapshotCache::QueryActorsInLevel(const FMCPWorldSnapshot& Snapshot,
+    const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const
+{
+    // Same parameters as BeginGetActorsInLevel
+    int32 ClassIndex = INDEX_NONE;
+    FString ClassName;
+    if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+    {
+        ClassIndex = Snapshot.FindClass(ClassName);
+        if (ClassIndex == INDEX_NONE)
+        {
+            // No actor of that class - the game thread tells an empty result from an unknown class
+            bOutFallBack = true;
+            return nullptr;
+        }
+    }
+
+    FName Tag = NAME_None;
+    FString TagString;
+    if (Params->TryGetStringField(TEXT("tag"), TagString) && !TagString.IsEmpty())
+    {
+        Tag = *TagString;
+    }
+
+    TOptional<FBox> Bounds;
+    const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("bounds"), BoundsObj) && BoundsObj)
+    {
+        Bounds = FBox(
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min")),
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max")));
+    }
+
+    EMCPActorFields Fields = EMCPActorFields::Default;
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray)
+    {
+        FString UnknownField;
+        if (!FEpicUnrealMCPCommonUtils::ParseActorFields(*FieldsArray, Fields, UnknownField))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown field: %s"), *UnknownField));
+        }
+    }
+
+    int32 PageSize = 0;
+    if (Params->TryGetNumberField(TEXT("page_size"), PageSize))
+    {
+        PageSize = FMath::Clamp(PageSize, 1, FEpicUnrealMCPEditorCommands::MaxActorPageSize);
+    }
+
+    FString CursorString;
+    Params->TryGetStringField(TEXT("cursor"), CursorString);
+    const FName Cursor = CursorString.IsEmpty() ? NAME_None : FName(*CursorString);
+
+    TArray<const FMCPActorSnapshot*> Matches;
+    for (const FMCPActorSnapshotRef& Actor : Snapshot.Actors)
+    {
+        if (ClassIndex != INDEX_NONE && !Snapshot.IsChildOf(Actor->ClassIndex, ClassIndex))
+        {
+            continue;
+        }
+        if (Tag != NAME_None && !Actor->Tags.Contains(Tag))
+        {
+            continue;
+        }
+        if (Bounds.IsSet() && !Bounds->IsInsideOrOn(Actor->Location))
+        {
+            continue;
+        }
+        if (PageSize > 0 && !Cursor.IsNone() && !Cursor.LexicalLess(Actor->Name))
+        {
+            continue;
+        }
+        Matches.Add(&Actor.Get());
+    }
+
+    FString NextCursor;
+    if (PageSize > 0)
+    {
+        // Same order as the game-thread path, so a cursor from either resumes correctly in the other
+        Algo::Sort(Matches, [](const FMCPActorSnapshot* A, const FMCPActorSnapshot* B) { return A->Name.LexicalLess(B->Name); });
+
+        if (Matches.Num() > PageSize)
+        {
+            Matches.SetNum(PageSize, EAllowShrinking::No);
+            NextCursor = Matches.Last()->Name.ToString();
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    ActorArray.Reserve(Matches.Num());
+    for (const FMCPActorSnapshot* Actor : Matches)
+    {
+        ActorArray.Add(MakeShared<FJsonValueObject>(ActorToJson(Snapshot, *Actor, Fields)));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    if (PageSize > 0)
+    {
+        ResultObj->SetNumberField(TEXT("count"), ActorArray.Num());
+        ResultObj->SetBoolField(TEXT("has_more"), !NextCursor.IsEmpty());
+        if (!NextCursor.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("next_cursor"), NextCursor);
+        }
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FMCPWorldSnapshotCache::QueryActorsByName(const FMCPWorldSnapshot& Snapshot,
+    const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const
+{
+    FString Pattern;
+    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+    }
+
+    // Index statistics and unknown options are the handler's business
+    bool bIndexStats = false;
+    FString MatchString = TEXT("substring");
+    FString SearchString = TEXT("name");
+    Params->TryGetStringField(TEXT("match"), MatchString);
+    Params->TryGetStringField(TEXT("search"), SearchString);
+    if ((Params->TryGetBoolField(TEXT("index_stats"), bIndexStats) && bIndexStats)
+        || (MatchString != TEXT("substring") && MatchString != TEXT("prefix") && MatchString != TEXT("glob"))
+        || (SearchString != TEXT("name") && SearchString != TEXT("label") && SearchString != TEXT("both")))
+    {
+        bOutFallBack = true;
+        return nullptr;
+    }
+
+    const bool bSearchName = SearchString != TEXT("label");
+    const bool bSearchLabel = SearchString != TEXT("name");
+
+    // Case-insensitive, like the name index
+    auto MatchesText = [&Pattern, &MatchString](const FString& Text)
+    {
+        if (MatchString == TEXT("prefix"))
+        {
+            return Text.StartsWith(Pattern);
+        }
+        if (MatchString == TEXT("glob"))
+        {
+            return Text.MatchesWildcard(Pattern);
+        }
+        return Text.Contains(Pattern);
+    };
+
+    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+    for (const FMCPActorSnapshotRef& Actor : Snapshot.Actors)
+    {
+        if ((bSearchName && MatchesText(Actor->Name.ToString())) || (bSearchLabel && MatchesText(Actor->Label)))
+        {
+            MatchingActors.Add(MakeShared<FJsonValueObject>(ActorToJson(Snapshot, *Actor, EMCPActorFields::Default)));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FMCPWorldSnapshotCache::QueryActorMaterialInfo(const FMCPWorldSnapshot& Snapshot,
+    const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const
+{
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    // FName lookup ignores case; the handler has always matched names exactly
+    const int32* ActorIndex = Snapshot.ActorByName.Find(FName(*ActorName, FNAME_Find));
+    if (!ActorIndex || Snapshot.Actors[*ActorIndex]->Name.ToString() != ActorName)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+    }
+
+    const FMCPActorSnapshot& Actor = *Snapshot.Actors[*ActorIndex];
+
+    TArray<TSharedPtr<FJsonValue>> MaterialSlots;
+    MaterialSlots.Reserve(Actor.MaterialSlots.Num());
+    for (const FMCPMaterialSlotSnapshot& Slot : Actor.MaterialSlots)
+    {
+        TSharedPtr<FJsonObject> SlotInfo = MakeShared<FJsonObject>();
+        SlotInfo->SetNumberField(TEXT("slot"), Slot.Slot);
+        SlotInfo->SetStringField(TEXT("component"), Slot.Component);
+        SlotInfo->SetStringField(TEXT("material_name"), Slot.MaterialName);
+        SlotInfo->SetStringField(TEXT("material_path"), Slot.MaterialPath);
+        SlotInfo->SetStringField(TEXT("material_class"), Slot.MaterialClass);
+        MaterialSlots.Add(MakeShared<FJsonValueObject>(SlotInfo));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("actor_name"), ActorName);
+    ResultObj->SetArrayField(TEXT("material_slots"), MaterialSlots);
+    ResultObj->SetNumberField(TEXT("total_slots"), MaterialSlots.Num());
+    return ResultObj;
+}
+
+// Mirrors FEpicUnrealMCPCommonUtils::ActorToProjectedJson
+TSharedPtr<FJsonObject> FMCPWorldSnapshotCache::ActorToJson(const FMCPWorldSnapshot& Snapshot, const FMCPActorSnapshot& Actor, EMCPActorFields Fields)
+{
+    auto MakeTriple = [](double A, double B, double C)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(3);
+        Array.Add(MakeShared<FJsonValueNumber>(A));
+        Array.Add(MakeShared<FJsonValueNumber>(B));
+        Array.Add(MakeShared<FJsonValueNumber>(C));
+        return Array;
+    };
+
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        ActorObject->SetStringField(TEXT("name"), Actor.Name.ToString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        const FMCPClassSnapshot* Class = Snapshot.GetClass(Actor.ClassIndex);
+        ActorObject->SetStringField(TEXT("class"), Class ? Class->Name.ToString() : FString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        ActorObject->SetArrayField(TEXT("location"), MakeTriple(Actor.Location.X, Actor.Location.Y, Actor.Location.Z));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        ActorObject->SetArrayField(TEXT("rotation"), MakeTriple(Actor.Rotation.Pitch, Actor.Rotation.Yaw, Actor.Rotation.Roll));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        ActorObject->SetArrayField(TEXT("scale"), MakeTriple(Actor.Scale.X, Actor.Scale.Y, Actor.Scale.Z));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Label))
+    {
+        ActorObject->SetStringField(TEXT("label"), Actor.Label);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Folder))
+    {
+        ActorObject->SetStringField(TEXT("folder"), Actor.Folder);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Tags))
+    {
+        TArray<TSharedPtr<FJsonValue>> TagArray;
+        TagArray.Reserve(Actor.Tags.Num());
+        for (const FName& Tag : Actor.Tags)
+        {
+            TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        ActorObject->SetArrayField(TEXT("tags"), TagArray);
+    }
+
+    return ActorObject;
+}
+
+// ============================================================================
+// BUILDING (game thread)
+// ============================================================================
+
+bool FMCPWorldSnapshotCache::Tick(float DeltaTime)
+{
+    if (!bRefreshRequested.Exchange(false) || !bDirty)
+    {
+        return true;
+    }
+
+    UNREALMCP_SCOPE_CYCLE_COUNTER(STAT_MCP_SnapshotRefresh);
+
+    // Events are only tracked once a client has asked for a snapshot
+    bActive = true;
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return true;
+    }
+
+    if (bNeedsRebuild || BuiltWorld.Get() != World)
+    {
+        Rebuild(World);
+    }
+    else
+    {
+        for (const TWeakObjectPtr<AActor>& DirtyActor : DirtyActors)
+        {
+            if (AActor* Actor = DirtyActor.Get())
+            {
+                UpdateActor(Actor);
+            }
+        }
+        DirtyActors.Reset();
+    }
+
+    Publish();
+    return true;
+}
+
+void FMCPWorldSnapshotCache::Rebuild(UWorld* World)
+{
+    BuiltWorld = World;
+    bNeedsRebuild = false;
+
+    Actors.Reset();
+    ActorKeys.Reset();
+    IndexByActor.Reset();
+    ActorByName.Reset();
+    DirtyActors.Reset();
+    Classes.Reset();
+    ClassByKey.Reset();
+    PublishedClasses.Reset();
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        UpdateActor(*It);
+    }
+}
+
+void FMCPWorldSnapshotCache::UpdateActor(AActor* Actor)
+{
+    FMCPActorSnapshotRef Snapshot = CaptureActor(Actor);
+
+    if (const int32* Existing = IndexByActor.Find(Actor))
+    {
+        // Renamed since the last capture
+        const FName OldName = Actors[*Existing]->Name;
+        if (OldName != Snapshot->Name)
+        {
+            ActorByName.Remove(OldName);
+            ActorByName.Add(Snapshot->Name, *Existing);
+        }
+        Actors[*Existing] = MoveTemp(Snapshot);
+        return;
+    }
+
+    const int32 Index = Actors.Num();
+    ActorByName.Add(Snapshot->Name, Index);
+    Actors.Add(MoveTemp(Snapshot));
+    ActorKeys.Add(Actor);
+    IndexByActor.Add(Actor, Index);
+}
+
+void FMCPWorldSnapshotCache::RemoveActor(AActor* Actor)
+{
+    int32 Index = INDEX_NONE;
+    if (!IndexByActor.RemoveAndCopyValue(Actor, Index))
+    {
+        return;
+    }
+
+    ActorByName.Remove(Actors[Index]->Name);
+
+    // Swap the last actor into the hole
+    const int32 LastIndex = Actors.Num() - 1;
+    if (Index != LastIndex)
+    {
+        IndexByActor[ActorKeys[LastIndex]] = Index;
+        ActorByName[Actors[LastIndex]->Name] = Index;
+    }
+    Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    ActorKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+FMCPActorSnapshotRef FMCPWorldSnapshotCache::CaptureActor(AActor* Actor)
+{
+    TSharedRef<FMCPActorSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FMCPActorSnapshot, ESPMode::ThreadSafe>();
+    Snapshot->Name = Actor->GetFName();
+    Snapshot->Label = Actor->GetActorLabel();
+    Snapshot->ClassIndex = FindOrAddClass(Actor->GetClass());
+    Snapshot->Location = Actor->GetActorLocation();
+    Snapshot->Rotation = Actor->GetActorRotation();
+    Snapshot->Scale = Actor->GetActorScale3D();
+    Snapshot->Folder = Actor->GetFolderPath().ToString();
+    Snapshot->Tags = Actor->Tags;
+
+    // Same slots get_actor_material_info reports
+    TArray<UStaticMeshComponent*> MeshComponents;
+    Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+    for (UStaticMeshComponent* MeshComp : MeshComponents)
+    {
+        if (!MeshComp)
+        {
+            continue;
+        }
+
+        for (int32 SlotIndex = 0; SlotIndex < MeshComp->GetNumMaterials(); ++SlotIndex)
+        {
+            FMCPMaterialSlotSnapshot& Slot = Snapshot->MaterialSlots.AddDefaulted_GetRef();
+            Slot.Component = MeshComp->GetName();
+            Slot.Slot = SlotIndex;
+
+            UMaterialInterface* Material = MeshComp->GetMaterial(SlotIndex);
+            if (Material)
+            {
+                Slot.MaterialName = Material->GetName();
+                Slot.MaterialPath = Material->GetPathName();
+                Slot.MaterialClass = Material->GetClass()->GetName();
+            }
+            else
+            {
+                Slot.MaterialName = TEXT("None");
+            }
+        }
+    }
+
+    return Snapshot;
+}
+
+int32 FMCPWorldSnapshotCache::FindOrAddClass(UClass* Class)
+{
+    if (!Class)
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = ClassByKey.Find(Class))
+    {
+        return *Existing;
+    }
+
+    // Parents first, stopping at AActor, so IsChildOf can walk up by index
+    const int32 Parent = Class == AActor::StaticClass() ? INDEX_NONE : FindOrAddClass(Class->GetSuperClass());
+
+    FMCPClassSnapshot& Entry = Classes.AddDefaulted_GetRef();
+    Entry.Name = Class->GetFName();
+    Entry.Path = Class->GetPathName();
+    Entry.Parent = Parent;
+
+    const int32 Index = Classes.Num() - 1;
+    ClassByKey.Add(Class, Index);
+    PublishedClasses.Reset();
+    return Index;
+}
+
+void FMCPWorldSnapshotCache::Publish()
+{
+    // The class table only changes when a new class appears, so snapshots usually share it
+    if (!PublishedClasses.IsValid())
+    {
+        PublishedClasses = MakeShared<TArray<FMCPClassSnapshot>, ESPMode::ThreadSafe>(Classes);
+    }
+
+    // Copies references only - actors that did not change are shared with the previous snapshot
+    TSharedRef<FMCPWorldSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FMCPWorldSnapshot, ESPMode::ThreadSafe>();
+    Snapshot->Frame = GFrameCounter;
+    Snapshot->Actors = Actors;
+    Snapshot->ActorByName = ActorByName;
+    Snapshot->Classes = PublishedClasses;
+
+    {
+        FWriteScopeLock WriteLock(PublishedLock);
+        Published = Snapshot;
+    }
+    bDirty = false;
+
+    SET_DWORD_STAT(STAT_MCP_SnapshotActors, Actors.Num());
+}
+
+bool FMCPWorldSnapshotCache::IsTrackedActor(const AActor* Actor) const
+{
+    return bActive && !bNeedsRebuild && Actor && Actor->GetWorld() == BuiltWorld.Get();
+}
+
+void FMCPWorldSnapshotCache::MarkActorDirty(AActor* Actor)
+{
+    if (IsTrackedActor(Actor))
+    {
+        DirtyActors.Add(Actor);
+        bDirty = true;
+    }
+}
+
+// ============================================================================
+// EVENTS
+// ============================================================================
+
+void FMCPWorldSnapshotCache::HandleActorAdded(AActor* Actor)
+{
+    MarkActorDirty(Actor);
+}
+
+void FMCPWorldSnapshotCache::HandleActorDeleted(AActor* Actor)
+{
+    if (IsTrackedActor(Actor))
+    {
+        DirtyActors.Remove(Actor);
+        RemoveActor(Actor);
+        bDirty = true;
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleActorChanged(AActor* Actor)
+{
+    MarkActorDirty(Actor);
+}
+
+void FMCPWorldSnapshotCache::HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName)
+{
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        MarkActorDirty(Actor);
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    // Component edits (materials, transforms) change the owning actor's entry
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        MarkActorDirty(Actor);
+    }
+    else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+    {
+        MarkActorDirty(Component->GetOwner());
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+    // Blueprint compiles reinstance placed actors; the old object leaves the level without a delete event
+    for (const TPair<UObject*, UObject*>& Replacement : ReplacementMap)
+    {
+        AActor* OldActor = Cast<AActor>(Replacement.Key);
+        if (IsTrackedActor(OldActor))
+        {
+            DirtyActors.Remove(OldActor);
+            RemoveActor(OldActor);
+            bDirty = true;
+        }
+        MarkActorDirty(Cast<AActor>(Replacement.Value));
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+    if (World == BuiltWorld.Get())
+    {
+        MarkWorldChanged();
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (World == BuiltWorld.Get())
+    {
+        MarkWorldChanged();
+    }
+}
+
+void FMCPWorldSnapshotCache::HandleUndoRedo()
+{
+    MarkWorldChanged();
+}
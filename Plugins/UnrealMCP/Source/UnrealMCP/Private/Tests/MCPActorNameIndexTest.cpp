@@ -0,0 +1,165 @@
+#include "Misc/AutomationTest.h"
+#include "MCPActorNameIndexSubsystem.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPNameIndexTest
+{
+    struct FQuery
+    {
+        const TCHAR* Pattern;
+        EMCPNameMatch Match;
+        EMCPNameFields Fields;
+    };
+
+    // Substring, prefix and glob over names and labels, plus a pattern too short
+    // for a trigram and one that matches nothing
+    static const FQuery Queries[] =
+    {
+        { TEXT("crate"),       EMCPNameMatch::Substring, EMCPNameFields::Name },
+        { TEXT("RREL_01"),     EMCPNameMatch::Substring, EMCPNameFields::Name },
+        { TEXT("to"),          EMCPNameMatch::Substring, EMCPNameFields::Name },
+        { TEXT("torch_00"),    EMCPNameMatch::Prefix,    EMCPNameFields::Name },
+        { TEXT("crate_*7"),    EMCPNameMatch::Glob,      EMCPNameFields::Name },
+        { TEXT("b?rrel_1*"),   EMCPNameMatch::Glob,      EMCPNameFields::Name },
+        { TEXT("large"),       EMCPNameMatch::Substring, EMCPNameFields::Label },
+        { TEXT("prop"),        EMCPNameMatch::Prefix,    EMCPNameFields::Both },
+        { TEXT("renamed"),     EMCPNameMatch::Substring, EMCPNameFields::Both },
+        { TEXT("zzz"),         EMCPNameMatch::Substring, EMCPNameFields::Both },
+    };
+
+    // What find_actors_by_name did before the index: every actor, every call
+    static TSet<AActor*> LinearScan(UWorld* World, const FQuery& Query)
+    {
+        const FString Pattern(Query.Pattern);
+        auto Test = [&Pattern, &Query](const FString& Text)
+        {
+            switch (Query.Match)
+            {
+            case EMCPNameMatch::Prefix:
+                return Text.StartsWith(Pattern);
+            case EMCPNameMatch::Glob:
+                return Text.MatchesWildcard(Pattern);
+            default:
+                return Text.Contains(Pattern);
+            }
+        };
+
+        TSet<AActor*> Found;
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if ((EnumHasAnyFlags(Query.Fields, EMCPNameFields::Name) && Test(It->GetName()))
+                || (EnumHasAnyFlags(Query.Fields, EMCPNameFields::Label) && Test(It->GetActorLabel())))
+            {
+                Found.Add(*It);
+            }
+        }
+        return Found;
+    }
+}
+
+// The trigram index must return exactly what a linear scan does - as a set,
+// since its order differs - through spawns, relabels, renames, deletions that
+// leave dead postings behind, and the compaction that reclaims them
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPActorNameIndexTest,
+    "UnrealMCP.ActorNameIndex.MatchesLinearScan",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPActorNameIndexTest::RunTest(const FString& Parameters)
+{
+    using namespace MCPNameIndexTest;
+
+    static constexpr int32 NumPerKind = 1000;
+    static constexpr int32 NumRelabeled = 50;
+    static constexpr int32 NumRenamed = 20;
+    static constexpr int32 NumSurvivors = 500;
+
+    UMCPActorNameIndexSubsystem* NameIndex = GEditor ? GEditor->GetEditorSubsystem<UMCPActorNameIndexSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Actor name index subsystem"), NameIndex))
+    {
+        return false;
+    }
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("MCPActorNameIndexTestWorld"));
+    FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Editor);
+    Context.SetCurrentWorld(World);
+
+    auto CompareAll = [this, NameIndex, World](const TCHAR* Phase)
+    {
+        TArray<AActor*> IndexResult;
+        for (const FQuery& Query : Queries)
+        {
+            NameIndex->FindActors(World, Query.Pattern, Query.Match, Query.Fields, IndexResult);
+            const TSet<AActor*> Expected = LinearScan(World, Query);
+            const TSet<AActor*> Found(IndexResult);
+
+            const FString What = FString::Printf(TEXT("%s: '%s'"), Phase, Query.Pattern);
+            TestEqual(What + TEXT(" has no duplicates"), Found.Num(), IndexResult.Num());
+            TestEqual(What + TEXT(" match count"), Found.Num(), Expected.Num());
+            TestTrue(What + TEXT(" same actors"), Found.Difference(Expected).Num() == 0 && Expected.Difference(Found).Num() == 0);
+        }
+    };
+
+    TArray<AActor*> Actors;
+    const TCHAR* Kinds[] = { TEXT("Crate"), TEXT("Barrel"), TEXT("Torch") };
+    for (int32 Index = 0; Index < NumPerKind; ++Index)
+    {
+        for (const TCHAR* Kind : Kinds)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.Name = *FString::Printf(TEXT("%s_%04d"), Kind, Index);
+            AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+            Actor->SetActorLabel(FString::Printf(TEXT("Prop %s %s"), Kind, Index % 10 == 0 ? TEXT("Large") : TEXT("Small")));
+            Actors.Add(Actor);
+        }
+    }
+
+    CompareAll(TEXT("Fresh index"));
+
+    for (int32 Index = 0; Index < NumRelabeled; ++Index)
+    {
+        Actors[Index * 7]->SetActorLabel(FString::Printf(TEXT("Large Relabeled %d"), Index));
+    }
+    for (int32 Index = 0; Index < NumRenamed; ++Index)
+    {
+        Actors[Index * 11 + 3]->Rename(*FString::Printf(TEXT("Renamed_%d"), Index));
+    }
+
+    CompareAll(TEXT("After relabel and rename"));
+    TestTrue(TEXT("Relabels and renames leave dead entries"), NameIndex->GetNumDeadEntries() > 0);
+
+    // Delete from the front until only NumSurvivors remain; dead entries then
+    // outnumber live ones and the next query compacts the index
+    const int32 NumToDelete = Actors.Num() - NumSurvivors;
+    for (int32 Index = 0; Index < NumToDelete; ++Index)
+    {
+        World->EditorDestroyActor(Actors[Index], false);
+
+        if (Index == NumToDelete / 4)
+        {
+            CompareAll(TEXT("With dead postings"));
+            TestTrue(TEXT("Deletions leave dead entries before compaction"), NameIndex->GetNumDeadEntries() > 0);
+        }
+    }
+
+    CompareAll(TEXT("After compaction"));
+    TestEqual(TEXT("Compaction reclaimed every dead entry"), NameIndex->GetNumDeadEntries(), 0);
+
+    int32 NumLive = 0;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        ++NumLive;
+    }
+    TestEqual(TEXT("Indexed actors after compaction"), NameIndex->GetNumIndexedActors(), NumLive);
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,127 @@
+#include "Misc/AutomationTest.h"
+#include "MCPChangeFeedSubsystem.h"
+#include "Editor.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Two subscriptions - every event, and removals only - while actors are
+// spawned and deleted in the editor level for a few hundred frames. Every
+// change must arrive exactly once per matching subscription, and the feed's
+// own memory must stop growing once the first frames have sized its buffers.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPChangeFeedSoakTest,
+    "UnrealMCP.ChangeFeed.Soak",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPChangeFeedSoakTest::RunTest(const FString& Parameters)
+{
+    static constexpr int32 WarmupRounds = 20;
+    static constexpr int32 MeasuredRounds = 300;
+    static constexpr int32 ActorsPerRound = 50;
+    static constexpr float FrameDelta = 1.0f / 60.0f;
+
+    UMCPChangeFeedSubsystem* ChangeFeed = GEditor ? GEditor->GetEditorSubsystem<UMCPChangeFeedSubsystem>() : nullptr;
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!TestNotNull(TEXT("Change feed subsystem"), ChangeFeed) || !TestNotNull(TEXT("Editor world"), World))
+    {
+        return false;
+    }
+
+    // Stands in for a client connection; lines are parsed after the run
+    TArray<FString> Lines;
+    FMCPClientChannelPtr Channel = MakeShared<FMCPClientChannel, ESPMode::ThreadSafe>();
+    Channel->Send = [&Lines](FString&& Line) { Lines.Add(MoveTemp(Line)); };
+
+    auto Subscribe = [this, ChangeFeed, &Channel](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> Result = ChangeFeed->HandleCommand(TEXT("subscribe"), Params, Channel);
+        double SubscriptionId = 0.0;
+        TestTrue(TEXT("Subscribed"), Result.IsValid() && Result->TryGetNumberField(TEXT("subscription"), SubscriptionId));
+        return static_cast<int32>(SubscriptionId);
+    };
+
+    const int32 AllEventsId = Subscribe(MakeShared<FJsonObject>());
+
+    TSharedPtr<FJsonObject> RemovedOnly = MakeShared<FJsonObject>();
+    RemovedOnly->SetArrayField(TEXT("events"), { MakeShared<FJsonValueString>(TEXT("removed")) });
+    const int32 RemovedOnlyId = Subscribe(RemovedOnly);
+
+    // Each round spawns a fresh set of actors and deletes the previous round's
+    TArray<AActor*> Live;
+    int32 NextActor = 0;
+    auto RunRound = [World, &Live, &NextActor]()
+    {
+        TArray<AActor*> Spawned;
+        for (int32 Index = 0; Index < ActorsPerRound; ++Index)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.Name = *FString::Printf(TEXT("MCPChangeFeedSoak_%06d"), NextActor++);
+            Spawned.Add(World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams));
+        }
+
+        for (AActor* Actor : Live)
+        {
+            World->EditorDestroyActor(Actor, false);
+        }
+        Live = MoveTemp(Spawned);
+
+        // The feed flushes on the core ticker
+        FTSTicker::GetCoreTicker().Tick(FrameDelta);
+    };
+
+    for (int32 Round = 0; Round < WarmupRounds; ++Round)
+    {
+        RunRound();
+    }
+    const SIZE_T WarmSize = ChangeFeed->GetAllocatedSize();
+
+    for (int32 Round = 0; Round < MeasuredRounds; ++Round)
+    {
+        RunRound();
+    }
+    const SIZE_T FinalSize = ChangeFeed->GetAllocatedSize();
+
+    for (AActor* Actor : Live)
+    {
+        World->EditorDestroyActor(Actor, false);
+    }
+    FTSTicker::GetCoreTicker().Tick(FrameDelta);
+
+    // Closing the channel drops both subscriptions on the next flush
+    Channel->bClosed = true;
+    FTSTicker::GetCoreTicker().Tick(FrameDelta);
+
+    TMap<int32, int32> ChangesBySubscription;
+    for (const FString& Line : Lines)
+    {
+        TSharedPtr<FJsonObject> Event;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+        if (!TestTrue(TEXT("Event line is a JSON object"), FJsonSerializer::Deserialize(Reader, Event) && Event.IsValid()))
+        {
+            continue;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Changes = nullptr;
+        TestTrue(TEXT("Event lists changes"), Event->TryGetArrayField(TEXT("changes"), Changes));
+        ChangesBySubscription.FindOrAdd(static_cast<int32>(Event->GetNumberField(TEXT("subscription")))) += Changes ? Changes->Num() : 0;
+    }
+
+    const int32 TotalSpawned = (WarmupRounds + MeasuredRounds) * ActorsPerRound;
+    TestEqual(TEXT("Changes seen by the all-events subscription"), ChangesBySubscription.FindRef(AllEventsId), TotalSpawned * 2);
+    TestEqual(TEXT("Changes seen by the removed-only subscription"), ChangesBySubscription.FindRef(RemovedOnlyId), TotalSpawned);
+    TestEqual(TEXT("Subscriptions after the channel closed"), ChangeFeed->GetNumSubscriptions(), 0);
+
+    AddInfo(FString::Printf(TEXT("%d event lines | feed memory %llu bytes after warm-up, %llu after %d more rounds"),
+        Lines.Num(), static_cast<uint64>(WarmSize), static_cast<uint64>(FinalSize), MeasuredRounds));
+    TestTrue(TEXT("Feed memory does not grow in steady state"), FinalSize <= WarmSize);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,172 @@
+#include "Misc/AutomationTest.h"
+#include "Tests/MCPTestClient.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Editor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPLatencyTest
+{
+    static constexpr double TimeoutSeconds = 10.0;
+
+    static bool IsServerRunning()
+    {
+        UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+        return Bridge && Bridge->IsRunning();
+    }
+
+    // Pumps the game thread until Client has NumLines more responses or the timeout passes
+    static bool WaitForLines(FMCPTestClient& Client, TArray<FString>& Lines, int32 NumLines)
+    {
+        const int32 Target = Lines.Num() + NumLines;
+        const double StartTime = FPlatformTime::Seconds();
+        while (Lines.Num() < Target && FPlatformTime::Seconds() - StartTime < TimeoutSeconds)
+        {
+            FMCPTestClient::PumpGameThread();
+            Client.ReadLines(Lines);
+        }
+        return Lines.Num() >= Target;
+    }
+
+    static TSharedPtr<FJsonObject> ParseLine(const FString& Line)
+    {
+        TSharedPtr<FJsonObject> Response;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+        return FJsonSerializer::Deserialize(Reader, Response) ? Response : nullptr;
+    }
+
+    static double Percentile(const TArray<double>& SortedMs, float Fraction)
+    {
+        return SortedMs.Num() > 0 ? SortedMs[FMath::Min(FMath::FloorToInt(SortedMs.Num() * Fraction), SortedMs.Num() - 1)] : 0.0;
+    }
+}
+
+// A second request reusing an id that is still in flight is refused, and the
+// first one still gets its own response
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPServerDuplicateIdTest,
+    "UnrealMCP.Server.DuplicateInFlightId",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPServerDuplicateIdTest::RunTest(const FString& Parameters)
+{
+    using namespace MCPLatencyTest;
+
+    FMCPTestClient Client;
+    if (!TestTrue(TEXT("MCP server is running"), IsServerRunning()) || !TestTrue(TEXT("Client connected"), Client.Connect()))
+    {
+        return false;
+    }
+
+    // The game thread is busy running this test, so the first ping is still in flight when the second arrives
+    Client.Send(TEXT("{\"type\":\"ping\",\"id\":\"dup\"}{\"type\":\"ping\",\"id\":\"dup\"}"));
+
+    TArray<FString> Lines;
+    if (!TestTrue(TEXT("Both requests answered"), WaitForLines(Client, Lines, 2)))
+    {
+        return false;
+    }
+
+    int32 NumSuccess = 0;
+    int32 NumDuplicateErrors = 0;
+    for (const FString& Line : Lines)
+    {
+        TSharedPtr<FJsonObject> Response = ParseLine(Line);
+        if (!TestTrue(TEXT("Response is a JSON object"), Response.IsValid()))
+        {
+            continue;
+        }
+
+        TestEqual(TEXT("Response id"), Response->GetStringField(TEXT("id")), FString(TEXT("dup")));
+        if (Response->GetStringField(TEXT("status")) == TEXT("success"))
+        {
+            ++NumSuccess;
+        }
+        else if (Response->GetStringField(TEXT("error")).StartsWith(TEXT("Duplicate request id")))
+        {
+            ++NumDuplicateErrors;
+        }
+    }
+
+    TestEqual(TEXT("Original request answered"), NumSuccess, 1);
+    TestEqual(TEXT("Duplicate refused"), NumDuplicateErrors, 1);
+
+    // Once answered, the id is free again
+    Client.Send(TEXT("{\"type\":\"ping\",\"id\":\"dup\"}"));
+    if (TestTrue(TEXT("Reused id answered"), WaitForLines(Client, Lines, 1)))
+    {
+        TSharedPtr<FJsonObject> Response = ParseLine(Lines.Last());
+        TestTrue(TEXT("Reused id succeeds"), Response.IsValid() && Response->GetStringField(TEXT("status")) == TEXT("success"));
+    }
+    return true;
+}
+
+// Round-trip latency of a ping through the server thread and the game thread,
+// one request at a time and as a pipelined burst on one connection
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPServerLatencyBenchmark,
+    "UnrealMCP.Server.LatencyBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPServerLatencyBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace MCPLatencyTest;
+
+    static constexpr int32 WarmupRequests = 20;
+    static constexpr int32 SerialRequests = 200;
+    static constexpr int32 BurstRequests = 200;
+
+    // Far above the expected sub-millisecond round trip; catches a return to timed polling
+    static constexpr double MaxMedianMs = 10.0;
+
+    FMCPTestClient Client;
+    if (!TestTrue(TEXT("MCP server is running"), IsServerRunning()) || !TestTrue(TEXT("Client connected"), Client.Connect()))
+    {
+        return false;
+    }
+
+    TArray<FString> Lines;
+    TArray<double> RoundTripMs;
+    RoundTripMs.Reserve(SerialRequests);
+
+    for (int32 Index = 0; Index < WarmupRequests + SerialRequests; ++Index)
+    {
+        const double SendTime = FPlatformTime::Seconds();
+        Client.Send(FString::Printf(TEXT("{\"type\":\"ping\",\"id\":%d}\n"), Index));
+        if (!TestTrue(FString::Printf(TEXT("Ping %d answered"), Index), WaitForLines(Client, Lines, 1)))
+        {
+            return false;
+        }
+
+        if (Index >= WarmupRequests)
+        {
+            RoundTripMs.Add((FPlatformTime::Seconds() - SendTime) * 1000.0);
+        }
+    }
+
+    // Burst: every request written before the first response is read
+    FString Burst;
+    for (int32 Index = 0; Index < BurstRequests; ++Index)
+    {
+        Burst += FString::Printf(TEXT("{\"type\":\"ping\",\"id\":\"burst-%d\"}\n"), Index);
+    }
+
+    const double BurstStart = FPlatformTime::Seconds();
+    Client.Send(Burst);
+    TestTrue(TEXT("Burst answered"), WaitForLines(Client, Lines, BurstRequests));
+    const double BurstMs = (FPlatformTime::Seconds() - BurstStart) * 1000.0;
+
+    RoundTripMs.Sort();
+    const double MedianMs = Percentile(RoundTripMs, 0.5f);
+
+    AddInfo(FString::Printf(TEXT("Serial ping round trip: p50 %.3f ms | p95 %.3f ms | p99 %.3f ms | max %.3f ms"),
+        MedianMs, Percentile(RoundTripMs, 0.95f), Percentile(RoundTripMs, 0.99f), RoundTripMs.Num() > 0 ? RoundTripMs.Last() : 0.0));
+    AddInfo(FString::Printf(TEXT("Pipelined burst: %d pings in %.2f ms (%.0f requests/s)"),
+        BurstRequests, BurstMs, BurstRequests / FMath::Max(BurstMs / 1000.0, 1e-6)));
+
+    TestTrue(FString::Printf(TEXT("Median round trip under %.0f ms"), MaxMedianMs), MedianMs < MaxMedianMs);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,107 @@
+#include "Misc/AutomationTest.h"
+#include "Tests/MCPTestClient.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Editor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Many loopback clients pipelining tagged pings at the running server. Every
+// request must be answered exactly once, with its own id, on the connection it
+// came from. Requests are written in uneven chunks so frames straddle Recv calls.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPServerLoopbackStressTest,
+    "UnrealMCP.Server.LoopbackStress",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPServerLoopbackStressTest::RunTest(const FString& Parameters)
+{
+    // Most of MaxConnections (512), leaving room for tools already connected
+    static constexpr int32 NumClients = 384;
+    static constexpr int32 RequestsPerClient = 32;
+    static constexpr int32 ChunkBytes = 37;
+    static constexpr double TimeoutSeconds = 60.0;
+
+    UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+    if (!TestTrue(TEXT("MCP server is running"), Bridge && Bridge->IsRunning()))
+    {
+        return false;
+    }
+
+    TArray<TUniquePtr<FMCPTestClient>> Clients;
+    for (int32 ClientIndex = 0; ClientIndex < NumClients; ++ClientIndex)
+    {
+        TUniquePtr<FMCPTestClient>& Client = Clients.Add_GetRef(MakeUnique<FMCPTestClient>());
+        if (!TestTrue(FString::Printf(TEXT("Client %d connected"), ClientIndex), Client->Connect()))
+        {
+            return false;
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Ids are unique across clients so a response routed to the wrong connection is caught
+    for (int32 ClientIndex = 0; ClientIndex < NumClients; ++ClientIndex)
+    {
+        FString Requests;
+        for (int32 RequestIndex = 0; RequestIndex < RequestsPerClient; ++RequestIndex)
+        {
+            Requests += FString::Printf(TEXT("{\"type\":\"ping\",\"id\":%d}\n"), ClientIndex * RequestsPerClient + RequestIndex);
+        }
+
+        for (int32 Offset = 0; Offset < Requests.Len(); Offset += ChunkBytes)
+        {
+            if (!TestTrue(TEXT("Request chunk sent"), Clients[ClientIndex]->Send(Requests.Mid(Offset, ChunkBytes))))
+            {
+                return false;
+            }
+        }
+    }
+
+    TArray<TArray<FString>> Responses;
+    Responses.SetNum(NumClients);
+    int32 NumReceived = 0;
+
+    while (NumReceived < NumClients * RequestsPerClient && FPlatformTime::Seconds() - StartTime < TimeoutSeconds)
+    {
+        FMCPTestClient::PumpGameThread();
+        for (int32 ClientIndex = 0; ClientIndex < NumClients; ++ClientIndex)
+        {
+            NumReceived += Clients[ClientIndex]->ReadLines(Responses[ClientIndex]);
+        }
+        FPlatformProcess::Sleep(0.0f);
+    }
+
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    TestEqual(TEXT("Responses received"), NumReceived, NumClients * RequestsPerClient);
+
+    for (int32 ClientIndex = 0; ClientIndex < NumClients; ++ClientIndex)
+    {
+        TSet<int32> SeenIds;
+        for (const FString& Line : Responses[ClientIndex])
+        {
+            TSharedPtr<FJsonObject> Response;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+            if (!TestTrue(TEXT("Response is a JSON object"), FJsonSerializer::Deserialize(Reader, Response) && Response.IsValid()))
+            {
+                continue;
+            }
+
+            const int32 Id = static_cast<int32>(Response->GetNumberField(TEXT("id")));
+            TestEqual(TEXT("Response status"), Response->GetStringField(TEXT("status")), FString(TEXT("success")));
+            TestTrue(FString::Printf(TEXT("Id %d answered on its own connection"), Id), Id / RequestsPerClient == ClientIndex);
+
+            bool bAlreadySeen = false;
+            SeenIds.Add(Id, &bAlreadySeen);
+            TestFalse(FString::Printf(TEXT("Id %d answered once"), Id), bAlreadySeen);
+        }
+        TestEqual(FString::Printf(TEXT("Client %d distinct responses"), ClientIndex), SeenIds.Num(), RequestsPerClient);
+    }
+
+    AddInfo(FString::Printf(TEXT("%d clients x %d requests in %.1f ms (%.0f requests/s)"),
+        NumClients, RequestsPerClient, ElapsedSeconds * 1000.0, NumReceived / FMath::Max(ElapsedSeconds, 1e-6)));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
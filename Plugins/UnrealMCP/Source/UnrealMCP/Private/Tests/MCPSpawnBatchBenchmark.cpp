@@ -0,0 +1,188 @@
+#include "Misc/AutomationTest.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPSpawnBatchBenchmark
+{
+    static UWorld* CreateScratchWorld(const TCHAR* Name)
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, Name);
+        FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Editor);
+        Context.SetCurrentWorld(World);
+        return World;
+    }
+
+    static void DestroyScratchWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    static int32 CountActors(UWorld* World)
+    {
+        int32 Count = 0;
+        for (TActorIterator<AStaticMeshActor> It(World); It; ++It)
+        {
+            ++Count;
+        }
+        return Count;
+    }
+
+    // spawn_actors_batch entries on a grid, scaled so the old path needs its SetActorTransform
+    static TArray<TSharedPtr<FJsonValue>> MakeSpecs(int32 NumActors)
+    {
+        TArray<TSharedPtr<FJsonValue>> Specs;
+        Specs.Reserve(NumActors);
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+            Spec->SetStringField(TEXT("type"), TEXT("StaticMeshActor"));
+            Spec->SetStringField(TEXT("name"), FString::Printf(TEXT("MCPBatchBench_%05d"), Index));
+
+            TArray<TSharedPtr<FJsonValue>> Location;
+            Location.Add(MakeShared<FJsonValueNumber>((Index % 100) * 200.0));
+            Location.Add(MakeShared<FJsonValueNumber>((Index / 100) * 200.0));
+            Location.Add(MakeShared<FJsonValueNumber>(0.0));
+            Spec->SetArrayField(TEXT("location"), Location);
+
+            TArray<TSharedPtr<FJsonValue>> Scale;
+            Scale.Add(MakeShared<FJsonValueNumber>(0.5));
+            Scale.Add(MakeShared<FJsonValueNumber>(0.5));
+            Scale.Add(MakeShared<FJsonValueNumber>(2.0));
+            Spec->SetArrayField(TEXT("scale"), Scale);
+
+            Specs.Add(MakeShared<FJsonValueObject>(Spec));
+        }
+        return Specs;
+    }
+
+    // What spawn_actors_batch did per entry before the typed path: a scan of every
+    // actor for a duplicate name, an immediate spawn and a SetActorTransform for
+    // the scale, and the result serialized to a string and parsed back for its status
+    static bool OldSpawnOne(UWorld* World, const TSharedPtr<FJsonObject>& Params)
+    {
+        FString ActorName;
+        Params->TryGetStringField(TEXT("name"), ActorName);
+        const FVector Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("location"));
+        const FVector Scale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale"));
+
+        TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+        const bool bNameTaken = AllActors.ContainsByPredicate([&ActorName](const AActor* Actor)
+        {
+            return Actor && Actor->GetName() == ActorName;
+        });
+
+        AStaticMeshActor* NewActor = nullptr;
+        if (!bNameTaken)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.Name = *ActorName;
+            NewActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        }
+
+        if (NewActor)
+        {
+            FTransform Transform = NewActor->GetTransform();
+            Transform.SetScale3D(Scale);
+            NewActor->SetActorTransform(Transform);
+
+            Response->SetStringField(TEXT("status"), TEXT("success"));
+            Response->SetObjectField(TEXT("result"), FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true));
+        }
+        else
+        {
+            Response->SetStringField(TEXT("status"), TEXT("error"));
+            Response->SetStringField(TEXT("error"), TEXT("Failed to create actor"));
+        }
+
+        FString Serialized;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+        FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+        TSharedPtr<FJsonObject> Parsed;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Serialized);
+        return FJsonSerializer::Deserialize(Reader, Parsed) && Parsed->GetStringField(TEXT("status")) == TEXT("success");
+    }
+}
+
+// 10k spawn_actors_batch entries through the per-entry spawn_actor round trip the
+// batch used to make and through today's typed, deferred path, each into its own
+// empty editor world. The new path runs inline (one slice), so it must be a
+// single undo step, and one undo must remove every actor it spawned.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPSpawnBatchBenchmark,
+    "UnrealMCP.SpawnActorsBatch.Benchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPSpawnBatchBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace MCPSpawnBatchBenchmark;
+
+    static constexpr int32 NumActors = 10000;
+
+    if (!TestNotNull(TEXT("Editor"), GEditor))
+    {
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>> Specs = MakeSpecs(NumActors);
+
+    // Old path
+    UWorld* OldWorld = CreateScratchWorld(TEXT("MCPSpawnBatchOldPath"));
+    int32 OldSuccessCount = 0;
+    const double OldStart = FPlatformTime::Seconds();
+    for (const TSharedPtr<FJsonValue>& Spec : Specs)
+    {
+        OldSuccessCount += OldSpawnOne(OldWorld, Spec->AsObject()) ? 1 : 0;
+    }
+    const double OldSeconds = FPlatformTime::Seconds() - OldStart;
+    TestEqual(TEXT("Old path spawned every actor"), OldSuccessCount, NumActors);
+    DestroyScratchWorld(OldWorld);
+
+    // New path
+    UWorld* NewWorld = CreateScratchWorld(TEXT("MCPSpawnBatchNewPath"));
+    TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetArrayField(TEXT("actors"), Specs);
+
+    const double NewStart = FPlatformTime::Seconds();
+    TSharedPtr<FJsonObject> Response = UEpicUnrealMCPBridge::BeginSpawnActorsBatch(NewWorld, Params).RunInline();
+    const double NewSeconds = FPlatformTime::Seconds() - NewStart;
+
+    TestEqual(TEXT("New path spawned every actor"), static_cast<int32>(Response->GetNumberField(TEXT("success_count"))), NumActors);
+    TestEqual(TEXT("Actors in the new path's world"), CountActors(NewWorld), NumActors);
+    TestEqual(TEXT("Inline batch is one undo step"), static_cast<int32>(Response->GetNumberField(TEXT("undo_steps"))), 1);
+
+    GEditor->UndoTransaction();
+    TestEqual(TEXT("One undo removes the whole batch"), CountActors(NewWorld), 0);
+
+    // The undo buffer would keep the scratch world's actors alive
+    GEditor->ResetTransaction(NSLOCTEXT("UnrealMCP", "SpawnBatchBenchmark", "MCP spawn batch benchmark"));
+    DestroyScratchWorld(NewWorld);
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    AddInfo(FString::Printf(TEXT("Old path: %d actors in %.1f ms (%.1f us/actor)"),
+        NumActors, OldSeconds * 1000.0, OldSeconds * 1e6 / NumActors));
+    AddInfo(FString::Printf(TEXT("New path: %d actors in %.1f ms (%.1f us/actor, %.1fx faster)"),
+        NumActors, NewSeconds * 1000.0, NewSeconds * 1e6 / NumActors, OldSeconds / FMath::Max(NewSeconds, 1e-6)));
+
+    TestTrue(TEXT("New path is faster than the old one"), NewSeconds < OldSeconds);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
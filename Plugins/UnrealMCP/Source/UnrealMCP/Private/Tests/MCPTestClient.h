@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Async/TaskGraphInterfaces.h"
+
+/**
+ * Loopback client for automation tests that talk to the running MCP server.
+ * Sends raw request bytes and splits whatever comes back into response lines.
+ * Tests run on the game thread, which is also where commands execute, so
+ * anything waiting for a response must keep pumping it - see PumpGameThread.
+ */
+class FMCPTestClient
+{
+public:
+	// Where UEpicUnrealMCPBridge listens
+	static constexpr uint16 ServerPort = 55557;
+
+	FMCPTestClient() = default;
+	~FMCPTestClient() { Close(); }
+
+	FMCPTestClient(const FMCPTestClient&) = delete;
+	FMCPTestClient& operator=(const FMCPTestClient&) = delete;
+
+	bool Connect()
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MCPTestClient"), false);
+		if (!Socket)
+		{
+			return false;
+		}
+
+		Socket->SetNoDelay(true);
+		if (!Socket->Connect(*FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), ServerPort).ToInternetAddr()))
+		{
+			Close();
+			return false;
+		}
+
+		Socket->SetNonBlocking(true);
+		return true;
+	}
+
+	void Close()
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+	}
+
+	bool IsConnected() const { return Socket != nullptr; }
+
+	// Blocks until every byte is written
+	bool Send(const FString& Request)
+	{
+		const FTCHARToUTF8 Utf8(*Request);
+		const uint8* Data = reinterpret_cast<const uint8*>(Utf8.Get());
+		int32 Remaining = Utf8.Length();
+
+		while (Socket && Remaining > 0)
+		{
+			int32 BytesSent = 0;
+			if (!Socket->Send(Data, Remaining, BytesSent))
+			{
+				if (ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() != SE_EWOULDBLOCK)
+				{
+					return false;
+				}
+				Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromMilliseconds(10.0));
+				continue;
+			}
+			Data += BytesSent;
+			Remaining -= BytesSent;
+		}
+		return Remaining == 0;
+	}
+
+	// Appends every complete response line received so far; returns how many were added
+	int32 ReadLines(TArray<FString>& OutLines)
+	{
+		if (!Socket)
+		{
+			return 0;
+		}
+
+		uint8 Chunk[16 * 1024];
+		int32 BytesRead = 0;
+		while (Socket->Recv(Chunk, sizeof(Chunk), BytesRead) && BytesRead > 0)
+		{
+			Pending.Append(Chunk, BytesRead);
+		}
+
+		int32 NumAdded = 0;
+		int32 LineStart = 0;
+		for (int32 Index = 0; Index < Pending.Num(); ++Index)
+		{
+			if (Pending[Index] == '\n')
+			{
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Pending.GetData() + LineStart), Index - LineStart);
+				OutLines.Emplace(Converted.Length(), Converted.Get());
+				LineStart = Index + 1;
+				++NumAdded;
+			}
+		}
+		Pending.RemoveAt(0, LineStart, EAllowShrinking::No);
+		return NumAdded;
+	}
+
+	// Runs commands queued on the game thread while a test waits on the server
+	static void PumpGameThread()
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+private:
+	FSocket* Socket = nullptr;
+	TArray<uint8> Pending;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
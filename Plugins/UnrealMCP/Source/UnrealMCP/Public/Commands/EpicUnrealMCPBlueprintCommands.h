@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "MCPGameThreadExecutor.h"
+
+class UMCPMaterialIndexSubsystem;
 
 /**
  * Handler class for Blueprint-related MCP commands
@@ -14,7 +17,14 @@ public:
     // Handle blueprint commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Commands that can run a slice per frame on the executor; others are wrapped as already finished
+    static bool IsSlicedCommand(const FString& CommandType);
+    FMCPSlicedCommand BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
 private:
+    // Upper bound on get_available_materials' page_size
+    static constexpr int32 MaxMaterialPageSize = 5000;
+
     // Specific blueprint command handlers (only used functions)
     TSharedPtr<FJsonObject> HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params);
@@ -26,6 +36,9 @@ private:
     
     // Material management functions
     TSharedPtr<FJsonObject> HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params);
+    FMCPSlicedCommand BeginGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params);
+    static TSharedPtr<FJsonObject> QueryMaterialIndex(const UMCPMaterialIndexSubsystem& MaterialIndex,
+        const TSharedPtr<FJsonObject>& Params, const FString& SearchPath, bool bIncludeEngineMaterials);
     TSharedPtr<FJsonObject> HandleApplyMaterialToActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleApplyMaterialToBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetActorMaterialInfo(const TSharedPtr<FJsonObject>& Params);
@@ -17,6 +17,22 @@ class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
 
+// Fields an actor query can return; Default is what get_actors_in_level has always sent
+enum class EMCPActorFields : uint32
+{
+    None     = 0,
+    Name     = 1 << 0,
+    Class    = 1 << 1,
+    Location = 1 << 2,
+    Rotation = 1 << 3,
+    Scale    = 1 << 4,
+    Label    = 1 << 5,
+    Folder   = 1 << 6,
+    Tags     = 1 << 7,
+    Default  = Name | Class | Location | Rotation | Scale
+};
+ENUM_CLASS_FLAGS(EMCPActorFields);
+
 /**
  * Common utilities for EpicUnrealMCP commands
  */
@@ -35,6 +51,9 @@ public:
     // Actor utilities
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+    static TSharedPtr<FJsonObject> ActorToProjectedJson(AActor* Actor, EMCPActorFields Fields);
+    // Parse a "fields" array of names; false (with the offending name) on an unknown field
+    static bool ParseActorFields(const TArray<TSharedPtr<FJsonValue>>& FieldNames, EMCPActorFields& OutFields, FString& OutUnknown);
     
     // Blueprint utilities
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
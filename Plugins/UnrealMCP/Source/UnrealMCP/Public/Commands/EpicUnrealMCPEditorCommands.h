@@ -2,6 +2,24 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "MCPGameThreadExecutor.h"
+
+class AActor;
+class UWorld;
+class UStaticMesh;
+
+/**
+ * Parsed form of a spawn_actor request, so a batch validates every entry once
+ * up front and then spawns without touching JSON
+ */
+struct FMCPActorSpawnSpec
+{
+    FName Name;
+    UClass* ActorClass = nullptr;
+    FTransform Transform;
+    FString StaticMeshPath;
+    FName FolderPath;
+};
 
 /**
  * Handler class for Editor-related MCP commands
@@ -15,9 +33,29 @@ public:
     // Handle editor commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Commands that can run a slice per frame on the executor; others are wrapped as already finished
+    static bool IsSlicedCommand(const FString& CommandType);
+    FMCPSlicedCommand BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    // Typed spawning shared by spawn_actor and spawn_actors_batch
+    static bool ParseSpawnSpec(const TSharedPtr<FJsonObject>& Params, FMCPActorSpawnSpec& OutSpec, FString& OutError);
+    static void CollectActorNames(UWorld* World, TSet<FName>& OutNames);
+
+    // Deferred spawn: mesh and full transform are applied before construction finishes,
+    // so components register once. Mesh may be null; the caller resolves it so batches can cache loads
+    static AActor* SpawnFromSpec(UWorld* World, const FMCPActorSpawnSpec& Spec, UStaticMesh* Mesh);
+
+    // Resolve a class name or path from a request to an actor class; null if unknown or not an actor
+    static UClass* FindActorClass(const FString& ClassName);
+
+    // Upper bound on get_actors_in_level's page_size
+    static constexpr int32 MaxActorPageSize = 5000;
+
 private:
+
     // Actor manipulation commands
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
+    FMCPSlicedCommand BeginGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
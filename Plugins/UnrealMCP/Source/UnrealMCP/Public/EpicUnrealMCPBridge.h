@@ -10,6 +10,9 @@
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "MCPGameThreadExecutor.h"
+#include "MCPWorldSnapshot.h"
+#include "MCPResponseCache.h"
 #include "EpicUnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -33,18 +36,33 @@ public:
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
 
-	// Command execution - main entry point for all MCP commands
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	// Command execution - main entry point for all MCP commands, called from the server thread.
+	// Queues the command on the game thread and calls OnComplete there with the serialized
+	// response. Read-only queries that the world snapshot can answer complete immediately on
+	// the calling thread instead. Handle, if given, carries cancellation and progress for
+	// commands that run across several frames
+	void ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+		TUniqueFunction<void(FString&&)> OnComplete, FMCPRequestHandlePtr Handle = nullptr);
+
+	// spawn_actors_batch into World (the editor world for requests). Each slice the
+	// executor runs is one undo step; the response reports the count as "undo_steps"
+	static FMCPSlicedCommand BeginSpawnActorsBatch(UWorld* World, const TSharedPtr<FJsonObject>& Params);
 
 private:
-	// Batch spawning support - spawns multiple actors in one call
-	FString SpawnActorsBatch(const TSharedPtr<FJsonObject>& Params);
+	// Runs on the game thread - routes CommandType to its handler. Handle is null for in-process calls
+	FString ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPRequestHandlePtr& Handle);
+
+	// Commands the executor can spread across frames; false if CommandType is not one of them
+	bool BeginSlicedCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPSlicedCommand& OutCommand);
+	TSharedPtr<FJsonObject> MakeCommandResponse(const TSharedPtr<FJsonObject>& ResultJson);
+
+	// Invalidate cached responses after a command that may have changed the level
+	void NotifyWorldModified();
 
-	// Helper functions for JSON and spawning
+	// Helper functions for JSON
 	FString CreateErrorResponse(const FString& ErrorMessage);
 	FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& ResultData);
 	FString SerializeJsonObject(const TSharedPtr<FJsonObject>& JsonObject);
-	FString SpawnActor(const TSharedPtr<FJsonObject>& Params);
 
 	// Server state
 	bool bIsRunning;
@@ -59,4 +77,13 @@ private:
 	// Command handlers - delegate to specialized command classes
 	TSharedPtr<FEpicUnrealMCPEditorCommands> EditorCommands;
 	TSharedPtr<FEpicUnrealMCPBlueprintCommands> BlueprintCommands;
+
+	// Runs sliced commands within a per-frame budget
+	TSharedPtr<FMCPGameThreadExecutor> Executor;
+
+	// Answers read-only queries off the game thread
+	TSharedPtr<FMCPWorldSnapshotCache> Snapshots;
+
+	// Serialized responses of repeated queries
+	TSharedPtr<FMCPResponseCache> ResponseCache;
 };
\ No newline at end of file
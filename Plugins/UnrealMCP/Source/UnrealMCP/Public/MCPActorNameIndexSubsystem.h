@@ -0,0 +1,113 @@
+// File: MCPActorNameIndexSubsystem.h
+// Purpose: Incrementally maintained trigram index over actor names and labels
+//
+// find_actors_by_name used to build every actor's name string and scan them all
+// on each call. This index follows actor add, delete, rename and relabel events
+// in the editor world, so a query only has to verify the actors that share the
+// pattern's rarest trigram. Names and labels are stored lowercased, matching the
+// case-insensitive Contains the command has always used.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MCPActorNameIndexSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+enum class EMCPNameMatch : uint8
+{
+	Substring,
+	Prefix,
+	Glob		// * and ? wildcards
+};
+
+enum class EMCPNameFields : uint8
+{
+	Name	= 1 << 0,
+	Label	= 1 << 1,
+	Both	= Name | Label
+};
+ENUM_CLASS_FLAGS(EMCPNameFields);
+
+UCLASS()
+class UNREALMCP_API UMCPActorNameIndexSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Actors in World whose name and/or label match Pattern, case-insensitively.
+	// Builds the index on first use or after the world changed.
+	// Results come in index order - level order at the last rebuild, then actors
+	// in the order they were added or renamed since. That is not the level order
+	// the old linear scan returned, and it changes as the level is edited; callers
+	// that need a stable order must sort
+	void FindActors(UWorld* World, const FString& Pattern, EMCPNameMatch Match, EMCPNameFields Fields, TArray<AActor*>& OutActors);
+
+	int32 GetNumIndexedActors() const { return EntryByActor.Num(); }
+	int32 GetNumTrigrams() const { return Postings.Num(); }
+
+	// Removed or re-added entries still referenced by postings, until the next compaction
+	int32 GetNumDeadEntries() const { return NumDeadEntries; }
+
+	// Heap used by the index itself, walked on demand
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FString Name;
+		FString Label;
+		bool bLive = false;
+	};
+
+	void EnsureIndexed(UWorld* World);
+	void Rebuild(UWorld* World);
+	void Reset();
+
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+
+	// Postings are only appended to; dead entries are skipped and reclaimed by the next rebuild
+	void AddPostings(int32 EntryIndex);
+	bool MatchesEntry(const FEntry& Entry, const FString& LowerPattern, EMCPNameMatch Match, EMCPNameFields Fields) const;
+
+	static uint64 PackTrigram(const TCHAR* Chars);
+
+	// Engine and editor events
+	void HandleActorAdded(AActor* Actor);
+	void HandleActorDeleted(AActor* Actor);
+	void HandleActorLabelChanged(AActor* Actor);
+	void HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName);
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void HandleUndoRedo();
+
+	// Rebuild once dead entries outnumber live ones
+	static constexpr int32 MinEntriesForCompaction = 1024;
+
+	TWeakObjectPtr<UWorld> IndexedWorld;
+	bool bNeedsRebuild = true;
+
+	TArray<FEntry> Entries;
+	int32 NumDeadEntries = 0;
+	TMap<TObjectKey<AActor>, int32> EntryByActor;
+	TMap<uint64, TArray<int32>> Postings;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle ObjectRenamedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle UndoRedoHandle;
+};
@@ -0,0 +1,125 @@
+// File: MCPChangeFeedSubsystem.h
+// Purpose: Push actor changes in the editor world to subscribed MCP clients
+//
+// Clients that mirror the level used to poll get_actors_in_level to notice
+// edits. A subscription instead receives one "changes" event per frame listing
+// the actors that were added, removed, moved or edited, filtered by class, path
+// and event kind. Changes are coalesced per actor within a frame, and nothing
+// is recorded while no client is subscribed.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "UObject/ObjectKey.h"
+#include "MCPGameThreadExecutor.h"
+#include "MCPChangeFeedSubsystem.generated.h"
+
+class AActor;
+struct FPropertyChangedEvent;
+
+enum class EMCPChangeKind : uint8
+{
+	None		= 0,
+	Added		= 1 << 0,
+	Removed		= 1 << 1,
+	Transform	= 1 << 2,
+	Property	= 1 << 3,
+	All			= Added | Removed | Transform | Property
+};
+ENUM_CLASS_FLAGS(EMCPChangeKind);
+
+UCLASS()
+class UNREALMCP_API UMCPChangeFeedSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// subscribe / unsubscribe; Channel is where events for a new subscription are sent
+	static bool IsChangeFeedCommand(const FString& CommandType);
+	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPClientChannelPtr& Channel);
+
+	int32 GetNumSubscriptions() const { return Subscriptions.Num(); }
+
+	// Heap held by subscriptions, pending changes and the flush scratch buffers
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FSubscription
+	{
+		int32 Id = 0;
+		FMCPClientChannelPtr Channel;
+		TArray<TWeakObjectPtr<UClass>> Classes;		// Empty matches every class
+		FString PathPrefix;
+		EMCPChangeKind Events = EMCPChangeKind::All;
+	};
+
+	// Everything that happened to one actor this frame. Identity is captured at
+	// the first event so a removal can still be reported once the actor is gone
+	struct FPendingChange
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UClass> Class;
+		FString Name;
+		FString Path;
+		EMCPChangeKind Kinds = EMCPChangeKind::None;
+		TArray<FName> Properties;
+		bool bPropertiesTruncated = false;
+	};
+
+	// One subscription's event line under construction: comma-separated serialized changes
+	struct FEventBatch
+	{
+		FString Changes;
+		int32 NumChanges = 0;
+	};
+
+	TSharedPtr<FJsonObject> HandleSubscribe(const TSharedPtr<FJsonObject>& Params, const FMCPClientChannelPtr& Channel);
+	TSharedPtr<FJsonObject> HandleUnsubscribe(const TSharedPtr<FJsonObject>& Params, const FMCPClientChannelPtr& Channel);
+
+	// Returns null when the actor is outside the editor world or nobody is listening
+	FPendingChange* FindOrAddChange(AActor* Actor);
+	void RecordChange(AActor* Actor, EMCPChangeKind Kind, FName PropertyName = NAME_None);
+
+	bool Tick(float DeltaTime);
+	void PruneClosedSubscriptions();
+	void SendChanges();
+	static void SendBatch(const FSubscription& Subscription, FEventBatch& Batch);
+	static bool Matches(const FSubscription& Subscription, const FPendingChange& Change);
+	static TSharedPtr<FJsonObject> ChangeToJson(const FPendingChange& Change, EMCPChangeKind Kinds);
+
+	// Engine and editor events
+	void HandleActorAdded(AActor* Actor);
+	void HandleActorDeleted(AActor* Actor);
+	void HandleActorMoved(AActor* Actor);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+
+	// Changes per event line, so a mass edit does not become one huge line
+	static constexpr int32 MaxChangesPerEvent = 256;
+
+	// Properties listed per actor; beyond this the change is flagged as truncated
+	static constexpr int32 MaxPropertiesPerChange = 32;
+
+	TArray<FSubscription> Subscriptions;
+	int32 NextSubscriptionId = 1;
+
+	TMap<TObjectKey<AActor>, FPendingChange> PendingChanges;
+
+	// Flush scratch, kept between frames: a batch per subscription, and the change
+	// being flushed serialized once for each distinct event mask that wants it
+	static constexpr int32 NumKindMasks = static_cast<int32>(EMCPChangeKind::All) + 1;
+	TArray<FEventBatch> Batches;
+	FString SerializedByKinds[NumKindMasks];
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PropertyChangedHandle;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * One client connection as seen from the game thread: lets work that outlives a
+ * single request (progress, subscriptions) write lines to the client, and tells
+ * it when the client has gone.
+ */
+struct FMCPClientChannel
+{
+	uint32 ConnectionId = 0;
+	TAtomic<bool> bClosed { false };
+
+	// Queue a complete JSON line for the client; safe from any thread, dropped once closed
+	TFunction<void(FString&&)> Send;
+
+	bool IsOpen() const { return !bClosed.Load(EMemoryOrder::Relaxed); }
+};
+
+using FMCPClientChannelPtr = TSharedPtr<FMCPClientChannel, ESPMode::ThreadSafe>;
+
+/**
+ * Shared between the server thread and the game thread for one request.
+ * The server thread sets bCancelled; whatever runs the command polls it.
+ */
+struct FMCPRequestHandle
+{
+	TAtomic<bool> bCancelled { false };
+
+	// Called on the game thread as a sliced command advances; unset when the client cannot receive notifications
+	TFunction<void(int32 Done, int32 Total)> OnProgress;
+
+	// The connection the request arrived on; null for requests made in-process
+	FMCPClientChannelPtr Channel;
+
+	bool IsCancelled() const { return bCancelled.Load(EMemoryOrder::Relaxed); }
+};
+
+using FMCPRequestHandlePtr = TSharedPtr<FMCPRequestHandle, ESPMode::ThreadSafe>;
+
+/**
+ * A command split into Total independent items. ProcessItem is called for
+ * 0..Total-1, spread over as many frames as the budget requires; Finish then
+ * builds the result from however many items were processed. EndSlice, if set,
+ * runs after each frame's run of items, before the editor gets control back -
+ * the place to close anything (e.g. a transaction) that must not span frames.
+ */
+struct UNREALMCP_API FMCPSlicedCommand
+{
+	int32 Total = 0;
+	TFunction<void(int32 Index)> ProcessItem;
+	TFunction<void()> EndSlice;
+	TFunction<TSharedPtr<FJsonObject>(int32 NumProcessed, bool bCancelled)> Finish;
+
+	// Process every item now and return the result - the synchronous path
+	TSharedPtr<FJsonObject> RunInline();
+
+	// A command with nothing to process that just returns Result
+	static FMCPSlicedCommand FromResult(const TSharedPtr<FJsonObject>& Result);
+};
+
+/**
+ * Runs sliced commands on the game thread within a per-frame time budget so
+ * large batches do not freeze the editor. The budget is shared evenly between
+ * queued commands, so a small one queued behind a huge one still completes
+ * within a frame or two.
+ */
+class UNREALMCP_API FMCPGameThreadExecutor
+{
+public:
+	FMCPGameThreadExecutor();
+	~FMCPGameThreadExecutor();
+
+	// Game thread only. Starts the command immediately and, if it does not fit
+	// in this frame's budget, continues it on later frames. OnFinished receives
+	// Finish's result once the command completes or is cancelled.
+	void Enqueue(const FString& Name, FMCPSlicedCommand&& Command, FMCPRequestHandlePtr Handle,
+		TUniqueFunction<void(TSharedPtr<FJsonObject>)> OnFinished);
+
+	// Finish every queued command now as cancelled - used on shutdown
+	void CancelAll();
+
+	int32 GetNumJobs() const { return Jobs.Num(); }
+
+private:
+	struct FJob
+	{
+		FString Name;
+		FMCPSlicedCommand Command;
+		FMCPRequestHandlePtr Handle;
+		TUniqueFunction<void(TSharedPtr<FJsonObject>)> OnFinished;
+		int32 NextIndex = 0;
+		double LastProgressTime = 0.0;
+
+		bool IsCancelled() const { return Handle.IsValid() && Handle->IsCancelled(); }
+	};
+
+	bool Tick(float DeltaTime);
+
+	// Returns true once the job is complete or cancelled
+	bool AdvanceJob(FJob& Job, double Deadline);
+	void FinishJob(FJob& Job);
+	void ReportProgress(FJob& Job, double Now);
+
+	// Game-thread time per frame across all jobs
+	static constexpr double FrameBudgetSeconds = 0.008;
+
+	// Items processed between clock reads
+	static constexpr int32 ItemsPerClockCheck = 8;
+
+	// Minimum gap between progress notifications for one job
+	static constexpr double ProgressIntervalSeconds = 0.1;
+
+	TArray<TUniquePtr<FJob>> Jobs;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,100 @@
+// File: MCPMaterialIndexSubsystem.h
+// Purpose: In-memory index of material assets for get_available_materials
+//
+// get_available_materials used to query the asset registry and then list and
+// load the same content again through UEditorAssetLibrary on every call. This
+// index is filled once from the asset registry on a worker thread after the
+// initial scan, then follows asset add, remove, rename and update events.
+// Entries are kept sorted by object path, so a search path is a contiguous
+// range and pages resume from the last path returned. Engine content is
+// indexed alongside game content and filtered per query.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "AssetRegistry/AssetData.h"
+#include "MCPMaterialIndexSubsystem.generated.h"
+
+struct FMCPMaterialQuery
+{
+	// Normalized package path prefix, e.g. /Game/Materials/
+	FString SearchPath;
+	bool bIncludeEngine = true;
+
+	// Case-insensitive substring of the asset name; empty matches all
+	FString NameFilter;
+
+	// 0 returns everything; otherwise at most this many, after Cursor
+	int32 PageSize = 0;
+	FString Cursor;
+};
+
+UCLASS()
+class UNREALMCP_API UMCPMaterialIndexSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// False until the first build has finished; callers fall back to querying the registry
+	bool IsReady() const { return bReady; }
+
+	// Matching materials in object path order. OutNextCursor is set when more remain
+	void Query(const FMCPMaterialQuery& Query, TArray<FAssetData>& OutAssets, FString& OutNextCursor) const;
+
+	int32 GetNumMaterials() const { return Entries.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FEntry
+	{
+		FString ObjectPath;
+		FString LowerName;
+		FAssetData AssetData;
+	};
+
+	void StartBuild();
+	void FinishBuild(uint32 BuildId, TArray<FAssetData>&& Assets);
+
+	bool IsMaterialClass(const FAssetData& AssetData) const;
+	void AddOrUpdate(const FAssetData& AssetData);
+	void Remove(const FString& ObjectPath);
+
+	// Index of the first entry whose path is not less than Path
+	int32 LowerBound(const FString& Path) const;
+
+	// Asset registry events
+	void HandleFilesLoaded();
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	// Sorted by ObjectPath
+	TArray<FEntry> Entries;
+
+	// UMaterialInterface and every class derived from it, resolved when the build starts
+	TSet<FTopLevelAssetPath> MaterialClasses;
+
+	bool bReady = false;
+	bool bBuilding = false;
+	uint32 CurrentBuildId = 0;
+
+	// Events that arrive while the worker is reading the registry, replayed on top of its result
+	struct FPendingEvent
+	{
+		FAssetData AssetData;
+		FString OldObjectPath;
+		bool bRemoved = false;
+	};
+	TArray<FPendingEvent> PendingEvents;
+
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+};
@@ -0,0 +1,126 @@
+// File: MCPResponseCache.h
+// Purpose: Serialized responses of idempotent queries, reused until the world or assets change
+//
+// Tools ask the same questions over and over - the same material search, the
+// same actor list. The cache keys a response on the command name plus its
+// params in canonical form (keys sorted, so field order does not matter) and
+// stores the exact bytes that were sent. Each entry remembers the world and
+// asset generations it was computed at; any editor event that could change the
+// answer bumps a generation, and an entry from an older generation is a miss.
+// World events only count when they touch the editor world, so PIE and preview
+// scenes ticking in the background do not empty the cache.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FAssetData;
+struct FPropertyChangedEvent;
+
+class UNREALMCP_API FMCPResponseCache
+{
+public:
+	// Generations a response was computed at; captured before the command runs
+	struct FGenerations
+	{
+		uint64 World = 0;
+		uint64 Assets = 0;
+	};
+
+	FMCPResponseCache();
+	~FMCPResponseCache();
+
+	static bool IsCacheableCommand(const FString& CommandType);
+
+	// Command name plus params with object keys sorted, so equivalent requests share an entry
+	static FString MakeKey(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	// Any thread
+	FGenerations GetGenerations() const;
+	bool Find(const FString& Key, FString& OutResponse);
+	void Store(const FString& Key, const FString& CommandType, const FGenerations& Generations, const FString& Response);
+
+	// Game thread. Called after any command that may have modified the world
+	void NotifyWorldModified() { ++WorldGeneration; }
+
+	// Hit/miss counters and current size, for get_response_cache_stats
+	TSharedPtr<FJsonObject> GetStats() const;
+
+private:
+	enum class EDependency : uint8
+	{
+		World	= 1 << 0,
+		Assets	= 1 << 1
+	};
+	FRIEND_ENUM_CLASS_FLAGS(EDependency);
+
+	struct FEntry
+	{
+		FString Response;
+		FGenerations Generations;
+		EDependency Dependencies = EDependency::World;
+		uint64 LastUsed = 0;
+	};
+
+	static EDependency GetDependencies(const FString& CommandType);
+	static void AppendCanonical(const TSharedPtr<FJsonValue>& Value, FString& Out);
+
+	bool IsCurrent(const FEntry& Entry) const;
+	static SIZE_T GetEntryBytes(const FString& Key, const FEntry& Entry);
+	void EvictLocked(SIZE_T IncomingBytes);
+	void RemoveLocked(const FString& Key);
+
+	// The editor world the cached actor queries read; events from other worlds
+	// (PIE, preview scenes, thumbnails) cannot change their answers
+	static bool IsTrackedWorld(const UWorld* World);
+
+	// Engine and editor events
+	void HandleWorldEvent() { ++WorldGeneration; }
+	void HandleActorEvent(AActor* Actor);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void HandleAssetEvent(const FAssetData& AssetData) { ++AssetGeneration; }
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath) { ++AssetGeneration; }
+	void HandleAssetsChanged() { ++AssetGeneration; }
+
+	// Least recently used entries go first once either limit is reached
+	static constexpr int32 MaxEntries = 512;
+	static constexpr SIZE_T MaxBytes = 16 * 1024 * 1024;
+
+	TAtomic<uint64> WorldGeneration { 1 };
+	TAtomic<uint64> AssetGeneration { 1 };
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FEntry> Entries;
+	SIZE_T TotalBytes = 0;
+	uint64 UseCounter = 0;
+
+	uint64 NumHits = 0;
+	uint64 NumMisses = 0;
+	uint64 NumStale = 0;
+	uint64 NumEvictions = 0;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle UndoRedoHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
+
+ENUM_CLASS_FLAGS(FMCPResponseCache::EDependency);
@@ -2,13 +2,138 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
+#include "Containers/Queue.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include "MCPGameThreadExecutor.h"
 
 class UEpicUnrealMCPBridge;
+class FJsonObject;
+class FJsonValue;
+class FInternetAddr;
+struct FMCPSocketPoller;
 
 /**
- * Runnable class for the MCP server thread
+ * A parsed request waiting for a dispatch slot on its connection
+ */
+struct FMCPPendingRequest
+{
+	FString CommandType;
+	TSharedPtr<FJsonObject> Params;
+
+	// '{"id":<id>,' spliced in front of the response body; empty for untagged requests
+	FString IdPrefix;
+
+	// Cancellation flag and progress callback shared with the game thread
+	FMCPRequestHandlePtr Handle;
+};
+
+/**
+ * A finished command handed back from the game thread to the server thread
+ */
+struct FMCPCompletedRequest
+{
+	uint32 ConnectionId = 0;
+	FString IdPrefix;
+	FString Response;
+
+	// False for notifications (progress, subscriptions), which are written as-is and leave the request in flight
+	bool bFinal = true;
+};
+
+/**
+ * Completions and notifications from the game thread to the server thread.
+ * Enqueue also wakes the server thread out of its socket wait: a byte sent to
+ * a loopback datagram socket that the server polls alongside its clients, so
+ * a finished command is written out immediately instead of on the next timeout.
+ * Shared, so completions arriving after the runnable is gone are harmless.
+ */
+struct FMCPCompletionQueue
+{
+	FMCPCompletionQueue();
+	~FMCPCompletionQueue();
+
+	// Any thread
+	void Enqueue(FMCPCompletedRequest&& Completed);
+	void Wake();
+
+	// Server thread. ConsumeWake clears the pending wake-up before the queue is drained
+	bool Dequeue(FMCPCompletedRequest& OutCompleted) { return Queue.Dequeue(OutCompleted); }
+	void ConsumeWake();
+	FSocket* GetWakeSocket() const { return WakeSocket; }
+
+private:
+	TQueue<FMCPCompletedRequest, EQueueMode::Mpsc> Queue;
+	FSocket* WakeSocket = nullptr;
+	TSharedPtr<FInternetAddr> WakeAddress;
+
+	// Set once a wake-up byte is in flight, so a burst of completions sends one datagram
+	TAtomic<bool> bWakePending;
+};
+
+/**
+ * One accepted client socket plus its framing state.
+ * Requests are JSON objects, either newline-terminated or simply back to back;
+ * the scanner tracks brace depth (ignoring braces inside strings) so a request
+ * may arrive split across any number of Recv calls.
+ */
+struct FMCPClientConnection
+{
+	FSocket* Socket = nullptr;
+	uint32 Id = 0;
+
+	// Bytes received but not yet consumed as complete frames
+	TArray<uint8> RecvBuffer;
+
+	// Incremental scanner state over RecvBuffer
+	int32 ScanOffset = 0;
+	int32 FrameStart = INDEX_NONE;
+	int32 Depth = 0;
+	bool bInString = false;
+	bool bEscape = false;
+
+	// Responses queued but not yet accepted by the socket
+	TArray<uint8> SendBuffer;
+	int32 SendOffset = 0;
+
+	// Parsed requests not yet sent to the game thread, oldest first
+	TArray<FMCPPendingRequest> PendingRequests;
+
+	// Requests running on (or queued for) the game thread
+	int32 InFlight = 0;
+
+	// Untagged requests run one at a time, in order, so their responses cannot be mismatched
+	bool bUntaggedInFlight = false;
+
+	// In-flight requests by IdPrefix (empty for the untagged one), for cancellation
+	TMap<FString, FMCPRequestHandlePtr> ActiveRequests;
+
+	// Game-thread view of this connection for progress and subscription notifications
+	FMCPClientChannelPtr Channel;
+
+	// Notifications were dropped because the client stopped reading; it is told to resync once it catches up
+	bool bNotificationsDropped = false;
+
+	bool bCloseAfterFlush = false;
+	bool bClosed = false;
+
+	int32 GetPendingSendBytes() const { return SendBuffer.Num() - SendOffset; }
+};
+
+/**
+ * Runnable class for the MCP server thread.
+ * Multiplexes every client on one thread: accept, read, frame, dispatch and
+ * flush are all non-blocking, and the thread only sleeps when a full sweep made
+ * no progress - in one readiness wait over the listener, every client and the
+ * completion queue's wake socket.
+ *
+ * Requests carrying an "id" are pipelined: up to MaxInFlightPerConnection run
+ * at once and each response is written as soon as it completes, tagged with
+ * the same id, so a slow command does not hold back faster ones. Tagged
+ * requests that run over several frames also get {"id":..,"status":"progress"}
+ * lines, and {"type":"cancel","params":{"id":..}} stops one early. An id may
+ * be reused once its response has been written; reusing it while the first
+ * request is still queued or running is answered with an error.
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -22,13 +147,58 @@ public:
 	virtual void Stop() override;
 	virtual void Exit() override;
 
+	// Listen backlog the bridge should use so bursts of connects are not refused
+	static constexpr int32 ListenBacklog = 128;
+
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	// Each returns true if it made progress (so the loop should not wait)
+	bool AcceptPendingConnections();
+	bool ReadAvailable(FMCPClientConnection& Connection);
+	bool ProcessFrames(FMCPClientConnection& Connection);
+	bool DispatchRequests(FMCPClientConnection& Connection);
+	bool DrainCompletions();
+	bool FlushSend(FMCPClientConnection& Connection);
+
+	void HandleFrame(FMCPClientConnection& Connection, const uint8* Data, int32 Length);
+	void QueueResponse(FMCPClientConnection& Connection, const FString& Response);
+	void QueueErrorResponse(FMCPClientConnection& Connection, const FString& ErrorMessage, const FString& IdPrefix = FString());
+
+	// Answered on the server thread so it never waits behind the request it targets
+	void HandleCancel(FMCPClientConnection& Connection, const TSharedPtr<FJsonObject>& Params, const FString& IdPrefix);
+
+	// '{"id":<id>,' for a request id, or empty if there is none
+	static FString MakeIdPrefix(const TSharedPtr<FJsonValue>& IdValue);
+
+	// Block until a socket is ready or the game thread finishes a command
+	void WaitForActivity();
+
+	// Whether ReadAvailable would read from this connection right now
+	bool WantsRead(const FMCPClientConnection& Connection) const;
+
+	void CloseConnection(FMCPClientConnection& Connection);
 
 private:
+	// Limits - a client that exceeds them is throttled or dropped, never the server
+	static constexpr int32 MaxConnections = 512;
+	static constexpr int32 RecvChunkSize = 64 * 1024;
+	static constexpr int32 MaxFrameBytes = 16 * 1024 * 1024;
+	static constexpr int32 MaxPendingSendBytes = 8 * 1024 * 1024;
+	static constexpr int32 MaxFramesPerSweep = 8;
+	static constexpr int32 MaxInFlightPerConnection = 8;
+	static constexpr int32 MaxQueuedRequestsPerConnection = 64;
+
+	// Upper bound on one wait, so Stop is noticed even if its wake-up is lost
+	static constexpr int32 MaxWaitMs = 100;
+
+	// Filled on the game thread, drained on the server thread
+	TSharedRef<FMCPCompletionQueue, ESPMode::ThreadSafe> Completions;
+	int32 TotalInFlight;
+
 	UEpicUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
\ No newline at end of file
+	TArray<TUniquePtr<FMCPClientConnection>> Connections;
+	TArray<uint8> RecvScratch;
+	TUniquePtr<FMCPSocketPoller> Poller;
+	uint32 NextConnectionId;
+	TAtomic<bool> bRunning;
+};
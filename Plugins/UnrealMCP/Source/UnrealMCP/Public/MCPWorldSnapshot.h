@@ -0,0 +1,165 @@
+// File: MCPWorldSnapshot.h
+// Purpose: Double-buffered copy of the editor world's queryable actor state
+//
+// Read-only queries (get_actors_in_level, find_actors_by_name,
+// get_actor_material_info) used to queue on the game thread like every other
+// command. The cache keeps a snapshot of each actor's name, class, transform,
+// label, folder, tags and material slots; the game thread builds the next one
+// and publishes it between frames while network threads read the last
+// published one without locking the world. Unchanged actors are shared
+// between consecutive snapshots, so a refresh only re-reads what changed.
+//
+// A snapshot is only used while nothing has changed since it was published -
+// otherwise the query falls back to the game thread and asks for a refresh -
+// so responses are never older than the last command the client saw complete.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FPropertyChangedEvent;
+enum class EMCPActorFields : uint32;
+
+struct FMCPMaterialSlotSnapshot
+{
+	FString Component;
+	int32 Slot = 0;
+	FString MaterialName;
+	FString MaterialPath;
+	FString MaterialClass;
+};
+
+struct FMCPActorSnapshot
+{
+	FName Name;
+	FString Label;
+	int32 ClassIndex = INDEX_NONE;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector Scale = FVector::OneVector;
+	FString Folder;
+	TArray<FName> Tags;
+	TArray<FMCPMaterialSlotSnapshot> MaterialSlots;
+};
+
+// An actor class and its parent, up to AActor
+struct FMCPClassSnapshot
+{
+	FName Name;
+	FString Path;
+	int32 Parent = INDEX_NONE;
+};
+
+using FMCPActorSnapshotRef = TSharedRef<const FMCPActorSnapshot, ESPMode::ThreadSafe>;
+
+// One published, immutable view of the world
+struct FMCPWorldSnapshot
+{
+	uint64 Frame = 0;
+	TArray<FMCPActorSnapshotRef> Actors;
+	TMap<FName, int32> ActorByName;
+	TSharedPtr<const TArray<FMCPClassSnapshot>, ESPMode::ThreadSafe> Classes;
+
+	// Resolve a class the way FindActorClass does, but only among classes with actors in the snapshot
+	int32 FindClass(const FString& ClassName) const;
+	bool IsChildOf(int32 ClassIndex, int32 BaseIndex) const;
+	const FMCPClassSnapshot* GetClass(int32 ClassIndex) const;
+};
+
+using FMCPWorldSnapshotPtr = TSharedPtr<const FMCPWorldSnapshot, ESPMode::ThreadSafe>;
+
+class UNREALMCP_API FMCPWorldSnapshotCache
+{
+public:
+	FMCPWorldSnapshotCache();
+	~FMCPWorldSnapshotCache();
+
+	// Commands TryExecute can answer
+	static bool IsSnapshotCommand(const FString& CommandType);
+
+	// Commands that never modify the world, so running them leaves the snapshot current
+	static bool IsReadOnlyCommand(const FString& CommandType);
+
+	// Any thread. Answers a read-only command from the published snapshot; false if the
+	// command must run on the game thread instead (stale snapshot or unsupported options)
+	bool TryExecute(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TSharedPtr<FJsonObject>& OutResult);
+
+	// Any thread
+	FMCPWorldSnapshotPtr GetSnapshot() const;
+
+private:
+	TSharedPtr<FJsonObject> QueryActorsInLevel(const FMCPWorldSnapshot& Snapshot, const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const;
+	TSharedPtr<FJsonObject> QueryActorsByName(const FMCPWorldSnapshot& Snapshot, const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const;
+	TSharedPtr<FJsonObject> QueryActorMaterialInfo(const FMCPWorldSnapshot& Snapshot, const TSharedPtr<FJsonObject>& Params, bool& bOutFallBack) const;
+
+	static TSharedPtr<FJsonObject> ActorToJson(const FMCPWorldSnapshot& Snapshot, const FMCPActorSnapshot& Actor, EMCPActorFields Fields);
+
+	// Game thread: building the next snapshot
+	bool Tick(float DeltaTime);
+	void Rebuild(UWorld* World);
+	void UpdateActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+	FMCPActorSnapshotRef CaptureActor(AActor* Actor);
+	int32 FindOrAddClass(UClass* Class);
+	void Publish();
+	void MarkActorDirty(AActor* Actor);
+	bool IsTrackedActor(const AActor* Actor) const;
+
+	// The world or its set of levels changed - rebuild before the next snapshot read. Edits
+	// to individual actors, including those made by commands, go through MarkActorDirty
+	void MarkWorldChanged();
+
+	// Engine and editor events
+	void HandleActorAdded(AActor* Actor);
+	void HandleActorDeleted(AActor* Actor);
+	void HandleActorChanged(AActor* Actor);
+	void HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void HandleUndoRedo();
+
+	// Front buffer, read by any thread
+	mutable FRWLock PublishedLock;
+	FMCPWorldSnapshotPtr Published;
+
+	// Something changed since Published was built; readers fall back to the game thread
+	TAtomic<bool> bDirty { true };
+
+	// A reader found the snapshot stale; refresh on the next tick. Nothing is
+	// rebuilt for clients that never run snapshot queries
+	TAtomic<bool> bRefreshRequested { false };
+
+	// Back buffer, game thread only
+	TWeakObjectPtr<UWorld> BuiltWorld;
+	bool bNeedsRebuild = true;
+	bool bActive = false;
+	TArray<FMCPActorSnapshotRef> Actors;
+	TArray<TObjectKey<AActor>> ActorKeys;
+	TMap<TObjectKey<AActor>, int32> IndexByActor;
+	TMap<FName, int32> ActorByName;
+	TSet<TWeakObjectPtr<AActor>> DirtyActors;
+	TArray<FMCPClassSnapshot> Classes;
+	TMap<TObjectKey<UClass>, int32> ClassByKey;
+	TSharedPtr<const TArray<FMCPClassSnapshot>, ESPMode::ThreadSafe> PublishedClasses;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle ObjectRenamedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle UndoRedoHandle;
+};
@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class UnrealMCP : ModuleRules
@@ -18,7 +19,9 @@ public class UnrealMCP : ModuleRules
 
         PrivateIncludePaths.AddRange(
             new string[] {
-				// ... add other private include paths required here ...
+				// Engine-private FSocketBSD, for the native multi-socket poll.
+				// Only MCPSocketPoller.cpp includes it; see MCPSocketPoller.h.
+				Path.Combine(EngineDirectory, "Source/Runtime/Sockets/Private"),
 			}
         );
 
@@ -0,0 +1,211 @@
+// ============================================================================
+// AoEProjectile.cpp
+// Developer: Marcus Daley
+// Date: January 9, 2026
+// Project: WizardJam
+// Purpose:
+// Radius detonation built on one overlap query and one batched damage pass.
+// ============================================================================
+
+#include "Code/Actors/AoEProjectile.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/StatusEffectSubsystem.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/DamageEvents.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+
+DECLARE_CYCLE_STAT(TEXT("AoE Detonate"), STAT_WizardJam_AoEDetonate, STATGROUP_WizardJam);
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+AAoEProjectile::AAoEProjectile()
+    : BlastRadius(400.0f)
+    , MaxTargets(16)
+    , DamageFalloffCurve(nullptr)
+    , MinFalloffScale(0.25f)
+    , bDetonateOnExpire(true)
+    , bHasDetonated(false)
+{
+    VictimObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
+}
+
+// ============================================================================
+// HIT HANDLING
+// ============================================================================
+
+void AAoEProjectile::HandleHit_Implementation(AActor* HitActor, const FHitResult& HitResult)
+{
+    if (bHasDetonated)
+    {
+        return;
+    }
+
+    // Detonate at the projectile rather than the victim's pivot so the
+    // blast is centered where the spell visibly landed
+    Detonate(GetActorLocation());
+
+    SpawnImpactEffect(HitResult.ImpactPoint, HitResult.ImpactNormal);
+    OnProjectileHit.Broadcast(this, HitActor, HitResult);
+
+    Destroy();
+}
+
+void AAoEProjectile::OnLifetimeExpired()
+{
+    if (bDetonateOnExpire && !bHasDetonated)
+    {
+        const FVector Origin = GetActorLocation();
+        Detonate(Origin);
+        SpawnImpactEffect(Origin, -GetActorForwardVector());
+    }
+
+    Super::OnLifetimeExpired();
+}
+
+// ============================================================================
+// DETONATION
+// ============================================================================
+
+int32 AAoEProjectile::Detonate(const FVector& Origin)
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_AoEDetonate);
+
+    UWorld* World = GetWorld();
+    if (!World || bHasDetonated)
+    {
+        return 0;
+    }
+
+    bHasDetonated = true;
+
+    // ------------------------------------------------------------------------
+    // 1. Single overlap query for every candidate in the radius
+    // ------------------------------------------------------------------------
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AoEProjectileDetonate), false, this);
+    if (CachedOwner.IsValid())
+    {
+        QueryParams.AddIgnoredActor(CachedOwner.Get());
+    }
+    if (CachedInstigator.IsValid())
+    {
+        QueryParams.AddIgnoredActor(CachedInstigator.Get());
+    }
+
+    TArray<FOverlapResult> Overlaps;
+    WJ_COUNTER_INC(Traces);
+    World->OverlapMultiByObjectType(
+        Overlaps,
+        Origin,
+        FQuat::Identity,
+        FCollisionObjectQueryParams(VictimObjectTypes),
+        FCollisionShape::MakeSphere(BlastRadius),
+        QueryParams
+    );
+
+    // ------------------------------------------------------------------------
+    // 2. De-duplicate actors, team filter, record distance
+    // ------------------------------------------------------------------------
+
+    struct FAoEVictim
+    {
+        AActor* Actor;
+        float DistanceSq;
+    };
+
+    TArray<FAoEVictim, TInlineAllocator<32>> Victims;
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        AActor* Candidate = Overlap.GetActor();
+        if (!Candidate || Candidate == this || !Candidate->CanBeDamaged())
+        {
+            continue;
+        }
+
+        // Several components of one actor can overlap - keep the actor once
+        const bool bAlreadyAdded = Victims.ContainsByPredicate(
+            [Candidate](const FAoEVictim& Existing) { return Existing.Actor == Candidate; });
+        if (bAlreadyAdded || IsFriendlyActor(Candidate))
+        {
+            continue;
+        }
+
+        Victims.Add({ Candidate, FVector::DistSquared(Origin, Candidate->GetActorLocation()) });
+    }
+
+    // ------------------------------------------------------------------------
+    // 3. Closest first, capped at MaxTargets
+    // ------------------------------------------------------------------------
+
+    Victims.Sort([](const FAoEVictim& A, const FAoEVictim& B) { return A.DistanceSq < B.DistanceSq; });
+    if (Victims.Num() > MaxTargets)
+    {
+        Victims.SetNum(MaxTargets, EAllowShrinking::No);
+    }
+
+    // ------------------------------------------------------------------------
+    // 4. One batched damage pass
+    // ------------------------------------------------------------------------
+
+    AController* InstigatorController = CachedInstigator.IsValid() ? CachedInstigator->GetController() : nullptr;
+    UStatusEffectSubsystem* StatusEffects = World->GetSubsystem<UStatusEffectSubsystem>();
+    const ESpellChannel ElementChannel = UStatusEffectSubsystem::ElementNameToChannel(SpellElement);
+
+    for (const FAoEVictim& Victim : Victims)
+    {
+        const float Distance = FMath::Sqrt(Victim.DistanceSq);
+        float VictimDamage = Damage * GetFalloffScale(Distance / BlastRadius);
+        if (StatusEffects)
+        {
+            VictimDamage *= StatusEffects->GetDamageTakenMultiplier(Victim.Actor);
+        }
+
+        if (VictimDamage <= 0.0f)
+        {
+            continue;
+        }
+
+        const FVector ToVictim = (Victim.Actor->GetActorLocation() - Origin).GetSafeNormal();
+
+        FPointDamageEvent DamageEvent;
+        DamageEvent.Damage = VictimDamage;
+        DamageEvent.ShotDirection = ToVictim;
+        DamageEvent.HitInfo.Location = Origin;
+        DamageEvent.HitInfo.ImpactPoint = Victim.Actor->GetActorLocation();
+        DamageEvent.HitInfo.ImpactNormal = -ToVictim;
+
+        Victim.Actor->TakeDamage(VictimDamage, DamageEvent, InstigatorController, CachedOwner.Get());
+
+        if (StatusEffects && StatusEffectMagnitude > 0.0f)
+        {
+            StatusEffects->ApplyElementalEffect(Victim.Actor, ElementChannel, CachedOwner.Get(), StatusEffectMagnitude);
+        }
+    }
+
+    bDidHitSomething = Victims.Num() > 0;
+
+    WJ_EVENT(AoEDetonated, this, BlastRadius, static_cast<float>(Overlaps.Num()), static_cast<float>(Victims.Num()));
+
+    OnDetonated.Broadcast(this, Victims.Num());
+
+    return Victims.Num();
+}
+
+float AAoEProjectile::GetFalloffScale(float NormalizedDistance) const
+{
+    NormalizedDistance = FMath::Clamp(NormalizedDistance, 0.0f, 1.0f);
+
+    if (DamageFalloffCurve)
+    {
+        return FMath::Max(DamageFalloffCurve->GetFloatValue(NormalizedDistance), 0.0f);
+    }
+
+    return FMath::Lerp(1.0f, MinFalloffScale, NormalizedDistance);
+}
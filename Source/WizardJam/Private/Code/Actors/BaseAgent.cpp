@@ -12,6 +12,8 @@
 
 #include "Code/Actors/BaseAgent.h"
 #include "Code/Utility/AC_HealthComponent.h"
+#include "Code/Utility/AimAssistSubsystem.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -114,14 +116,32 @@ void ABaseAgent::BeginPlay()
         GetCapsuleComponent()->SetGenerateOverlapEvents(true);
     }
 
+    // Make this agent available to player aim assist
+    if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+    {
+        AimAssist->RegisterTarget(this);
+    }
+
     UE_LOG(LogBaseAgent, Display, TEXT("[%s] BaseAgent BeginPlay complete | TeamID: %d | Color: (%.2f, %.2f, %.2f)"),
         *GetName(), TeamID, AgentColor.R, AgentColor.G, AgentColor.B);
 }
 
+void ABaseAgent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+    {
+        AimAssist->UnregisterTarget(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ABaseAgent::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    WJ_COUNT_TICKING_AGENT(GetActorLocation());
+
     // Update attack cooldown
     if (AttackCooldownRemaining > 0.0f)
     {
@@ -171,7 +191,8 @@ bool ABaseAgent::Attack_Implementation(AActor* Target)
     // Play effects
     PlayAttackEffects(Target);
 
-    UE_LOG(LogBaseAgent, Display, TEXT("[%s] Melee attack on %s for %.1f damage"),
+    WJ_EVENT(AgentAttack, this, WJ_EVENT_ID(Target), AttackDamage, 0.0f);
+    UE_LOG(LogBaseAgent, Verbose, TEXT("[%s] Melee attack on %s for %.1f damage"),
         *GetName(), *Target->GetName(), AttackDamage);
 
     // Notify brain that attack completed
@@ -345,6 +366,7 @@ void ABaseAgent::SetupAgentAppearance()
             UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(BaseMaterial, this);
             if (DynMat)
             {
+                WJ_COUNTER_INC(MIDsCreated);
                 MeshComp->SetMaterial(i, DynMat);
                 DynMat->SetVectorParameterValue(MaterialParameterName, AgentColor);
                 DynamicMaterials.Add(DynMat);
@@ -413,6 +435,12 @@ void ABaseAgent::HandleDeath(AActor* HitOwner, AActor* Killer)
     // Update blackboard
     UpdateBlackboardHealth(0.0f);
 
+    // Dead agents are not worth assisting onto during the despawn delay
+    if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+    {
+        AimAssist->UnregisterTarget(this);
+    }
+
     // Agent death handling (animation, ragdoll, etc.) would go here
     // For now, just destroy after delay
     SetLifeSpan(3.0f);
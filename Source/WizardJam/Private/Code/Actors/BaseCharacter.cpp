@@ -27,8 +27,9 @@ DEFINE_LOG_CATEGORY(LogBaseCharacter);
 // All defaults initialized here - never scatter hardcoded values through code
 // ============================================================================
 
-ABaseCharacter::ABaseCharacter()
-    : bCanCollectSpells(true)    // Default: most characters can collect spells
+ABaseCharacter::ABaseCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , bCanCollectSpells(true)    // Default: most characters can collect spells
     , TeamID(0)                   // Default: player team
 {
     PrimaryActorTick.bCanEverTick = true;
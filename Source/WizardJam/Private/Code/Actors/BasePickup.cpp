@@ -6,11 +6,15 @@
 // Project: WizardJam
 
 #include "Code/Actors/BasePickup.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogBasePickup, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogBasePickup, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Pickup Overlap (CanBePickedUp)"), STAT_WizardJam_PickupOverlap, STATGROUP_WizardJam);
 
 ABasePickup::ABasePickup()
     : bUseMesh(true)
@@ -65,11 +69,13 @@ void ABasePickup::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* Ot
     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
     bool bFromSweep, const FHitResult& SweepResult)
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_PickupOverlap);
+
     if (!OtherActor || OtherActor == this) return;
 
     if (CanBePickedUp(OtherActor))
     {
-        UE_LOG(LogBasePickup, Display, TEXT("[%s] Picked up by %s"),
+        UE_LOG(LogBasePickup, Verbose, TEXT("[%s] Picked up by %s"),
             *GetName(), *OtherActor->GetName());
 
         HandlePickup(OtherActor);
@@ -23,6 +23,10 @@
 #include "Code/Actors/BaseProjectile.h"
 #include "Code/Utility/AC_HealthComponent.h"
 #include "Code/Utility/AC_StaminaComponent.h"
+#include "Code/Utility/WizardJamMovementComponent.h"
+#include "Code/Utility/WizardJamStatsSubsystem.h"
+#include "Code/GameMode/WizardJamPlayerController.h"
+#include "Code/UI/WizardJamHUDWidget.h"
 #include "InputActionValue.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -32,8 +36,10 @@ DEFINE_LOG_CATEGORY(LogBasePlayer);
 // CONSTRUCTOR
 // ============================================================================
 
-ABasePlayer::ABasePlayer()
-    : EquippedSpellType(NAME_None)
+ABasePlayer::ABasePlayer(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UWizardJamMovementComponent>(
+        ACharacter::CharacterMovementComponentName))
+    , EquippedSpellType(NAME_None)
     , bAutoEquipFirstSpell(true)
     , bSyncSpellChannelsToTeleport(true)
 {
@@ -141,7 +147,7 @@ void ABasePlayer::BeginPlay()
     // If player has starting spells, equip the first one
     if (SpellCollectionComponent && bAutoEquipFirstSpell)
     {
-        TArray<FName> StartingSpells = SpellCollectionComponent->GetAllSpells();
+        const TSet<FName>& StartingSpells = SpellCollectionComponent->GetSpellSet();
         if (StartingSpells.Num() > 0)
         {
             // Find first spell that's in our spell order
@@ -245,7 +251,7 @@ void ABasePlayer::HandleCycleSpellInput(const FInputActionValue& Value)
 
 void ABasePlayer::HandleSelectSpellSlot(int32 SlotIndex)
 {
-    UE_LOG(LogBasePlayer, Display,
+    UE_LOG(LogBasePlayer, Verbose,
         TEXT("[%s] Select spell slot %d"),
         *GetName(), SlotIndex);
 
@@ -281,7 +287,7 @@ bool ABasePlayer::SetEquippedSpell(FName SpellType)
     // Broadcast change for HUD
     OnEquippedSpellChanged.Broadcast(EquippedSpellType, SlotIndex);
 
-    UE_LOG(LogBasePlayer, Display,
+    UE_LOG(LogBasePlayer, Verbose,
         TEXT("[%s] === SPELL EQUIPPED === '%s' (Slot %d) | Previous: '%s'"),
         *GetName(), *SpellType.ToString(), SlotIndex, *OldSpell.ToString());
 
@@ -642,4 +648,49 @@ void ABasePlayer::Debug_ListSpells()
             bEquipped ? TEXT(" <-- EQUIPPED") : TEXT(""));
     }
     UE_LOG(LogBasePlayer, Warning, TEXT("==================================="));
-}
\ No newline at end of file
+}
+
+void ABasePlayer::Debug_TogglePerfOverlay()
+{
+    AWizardJamPlayerController* PC = Cast<AWizardJamPlayerController>(GetController());
+    UWizardJamHUDWidget* HUD = PC ? PC->GetHUDWidget() : nullptr;
+    if (!HUD)
+    {
+        UE_LOG(LogBasePlayer, Warning, TEXT("[DEBUG] No WizardJam HUD to host the perf overlay"));
+        return;
+    }
+
+    HUD->TogglePerfOverlay();
+}
+
+void ABasePlayer::Debug_CountersCSV(const FString& FileName)
+{
+    UWizardJamStatsSubsystem* Stats = GetWorld() ? GetWorld()->GetSubsystem<UWizardJamStatsSubsystem>() : nullptr;
+    if (!Stats)
+    {
+        UE_LOG(LogBasePlayer, Warning, TEXT("[DEBUG] No WizardJamStatsSubsystem"));
+        return;
+    }
+
+    if (FileName.IsEmpty())
+    {
+        Stats->StopCSVCapture();
+        return;
+    }
+
+    Stats->StartCSVCapture(FileName);
+}
+
+void ABasePlayer::Debug_DumpEvents(int32 Count)
+{
+#if WIZARDJAM_EVENTLOG_ENABLED
+    FWizardJamEventLog::Dump(*GLog, Count);
+#endif
+}
+
+void ABasePlayer::Debug_DumpEventsCSV(const FString& FileName)
+{
+#if WIZARDJAM_EVENTLOG_ENABLED
+    FWizardJamEventLog::DumpToFile(FileName.IsEmpty() ? TEXT("WizardJamEvents.csv") : FileName);
+#endif
+}
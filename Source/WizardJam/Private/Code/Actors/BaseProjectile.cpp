@@ -23,6 +23,8 @@
 // ============================================================================
 
 #include "Code/Actors/BaseProjectile.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
@@ -32,9 +34,12 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "GenericTeamAgentInterface.h"
 #include "Engine/DamageEvents.h"
+#include "Code/Utility/StatusEffectSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogBaseProjectile);
 
+DECLARE_CYCLE_STAT(TEXT("Projectile Overlap"), STAT_WizardJam_ProjectileOverlap, STATGROUP_WizardJam);
+
 // ============================================================================
 // CONSTRUCTOR
 // All default values in initialization list per coding standards
@@ -47,6 +52,7 @@ ABaseProjectile::ABaseProjectile()
     , InitialSpeed(3000.0f)
     , LifetimeSeconds(5.0f)
     , CollisionRadius(15.0f)
+    , StatusEffectMagnitude(1.0f)
     , TrailNiagaraSystem(nullptr)
     , ImpactNiagaraSystem(nullptr)
     , TrailCascadeSystem(nullptr)
@@ -108,6 +114,9 @@ void ABaseProjectile::BeginPlay()
 {
     Super::BeginPlay();
 
+    WJ_COUNTER_INC(LiveProjectiles);
+    WJ_COUNTER_INC(ProjectilesSpawned);
+
     // Bind overlap event
     CollisionSphere->OnComponentBeginOverlap.AddDynamic(
         this, &ABaseProjectile::OnOverlapBegin);
@@ -132,6 +141,7 @@ void ABaseProjectile::BeginPlay()
 void ABaseProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     GetWorld()->GetTimerManager().ClearTimer(LifetimeTimerHandle);
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnProjectileDestroyed.Broadcast(this, bDidHitSomething);
 
     if (CollisionSphere)
@@ -139,6 +149,8 @@ void ABaseProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
         CollisionSphere->OnComponentBeginOverlap.RemoveAll(this);
     }
 
+    WJ_COUNTER_DEC(LiveProjectiles);
+
     Super::EndPlay(EndPlayReason);
 }
 
@@ -211,7 +223,8 @@ void ABaseProjectile::InitializeProjectile(AActor* OwningActor, const FVector& L
         FVector NormalizedDirection = LaunchDirection.GetSafeNormal();
         ProjectileMovement->Velocity = NormalizedDirection * InitialSpeed;
 
-        UE_LOG(LogBaseProjectile, Display,
+        WJ_EVENT(ProjectileLaunched, this, InitialSpeed, WJ_EVENT_ID(OwningActor));
+        UE_LOG(LogBaseProjectile, Verbose,
             TEXT("[%s] Initialized | Owner: %s | Direction: %s | Speed: %.0f"),
             *GetName(),
             OwningActor ? *OwningActor->GetName() : TEXT("None"),
@@ -232,6 +245,8 @@ void ABaseProjectile::OnOverlapBegin(
     bool bFromSweep,
     const FHitResult& SweepResult)
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_ProjectileOverlap);
+
     // Skip invalid or self
     if (!OtherActor || OtherActor == this)
     {
@@ -266,7 +281,8 @@ void ABaseProjectile::OnOverlapBegin(
         HitResult.Normal = HitResult.ImpactNormal;
     }
 
-    UE_LOG(LogBaseProjectile, Display,
+    WJ_EVENT(ProjectileHit, this, WJ_EVENT_ID(OtherActor), HitResult.ImpactPoint.X, HitResult.ImpactPoint.Y);
+    UE_LOG(LogBaseProjectile, Verbose,
         TEXT("[%s] Hit: %s at %s"),
         *GetName(), *OtherActor->GetName(), *HitResult.ImpactPoint.ToString());
 
@@ -292,6 +308,7 @@ void ABaseProjectile::HandleHit_Implementation(AActor* HitActor, const FHitResul
     SpawnImpactEffect(ImpactLocation, ImpactNormal);
 
     // Broadcast hit event
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnProjectileHit.Broadcast(this, HitActor, HitResult);
 
     // Destroy projectile
@@ -305,9 +322,17 @@ void ABaseProjectile::ApplyDamage_Implementation(AActor* HitActor, const FHitRes
         return;
     }
 
+    // Arcane vulnerability scales incoming damage
+    float FinalDamage = Damage;
+    UStatusEffectSubsystem* StatusEffects = GetWorld() ? GetWorld()->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+    if (StatusEffects)
+    {
+        FinalDamage *= StatusEffects->GetDamageTakenMultiplier(HitActor);
+    }
+
     // Create damage event
     FPointDamageEvent DamageEvent;
-    DamageEvent.Damage = Damage;
+    DamageEvent.Damage = FinalDamage;
     DamageEvent.HitInfo = HitResult;
     DamageEvent.ShotDirection = GetActorForwardVector();
 
@@ -320,15 +345,27 @@ void ABaseProjectile::ApplyDamage_Implementation(AActor* HitActor, const FHitRes
 
     // Apply damage
     HitActor->TakeDamage(
-        Damage,
+        FinalDamage,
         DamageEvent,
         InstigatorController,
         CachedOwner.Get()
     );
 
-    UE_LOG(LogBaseProjectile, Display,
+    WJ_EVENT(ProjectileDamage, this, FinalDamage, WJ_EVENT_ID(HitActor));
+    UE_LOG(LogBaseProjectile, Verbose,
         TEXT("[%s] Applied %.1f damage to %s"),
-        *GetName(), Damage, *HitActor->GetName());
+        *GetName(), FinalDamage, *HitActor->GetName());
+
+    // Elemental status effect - applied after damage so vulnerability from
+    // this same hit only affects later hits
+    if (StatusEffects && StatusEffectMagnitude > 0.0f)
+    {
+        StatusEffects->ApplyElementalEffect(
+            HitActor,
+            UStatusEffectSubsystem::ElementNameToChannel(SpellElement),
+            CachedOwner.Get(),
+            StatusEffectMagnitude);
+    }
 }
 
 // ============================================================================
@@ -425,6 +462,7 @@ void ABaseProjectile::ApplyMaterialColor()
 
             if (DynMaterial)
             {
+                WJ_COUNTER_INC(MIDsCreated);
                 DynMaterial->SetVectorParameterValue(FName("Color"), ElementColor);
                 DynMaterial->SetVectorParameterValue(FName("BaseColor"), ElementColor);
                 DynMaterial->SetVectorParameterValue(FName("EmissiveColor"), ElementColor);
@@ -10,6 +10,8 @@
 // - Optional simple AI for quick testing, disable for behavior tree in production
 
 #include "Code/Actors/BatAgent.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
 
 // Engine includes
 #include "Components/SkeletalMeshComponent.h"
@@ -23,7 +25,9 @@
 #include "Code/Utility/AC_HealthComponent.h"
 
 // Logging
-DEFINE_LOG_CATEGORY_STATIC(LogBatAgent, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogBatAgent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Bat AI Chase And Attack"), STAT_WizardJam_BatChaseAndAttack, STATGROUP_WizardJam);
 
 // ============================================================================
 // CONSTRUCTOR
@@ -159,7 +163,8 @@ bool ABatAgent::Attack_Implementation(AActor* Target)
     // Start attack cooldown
     AttackCooldownRemaining = AttackCooldown;
 
-    UE_LOG(LogBatAgent, Display, TEXT("[%s] Fired projectile at %s"),
+    WJ_EVENT(AgentAttack, this, WJ_EVENT_ID(Target), Projectile->GetDamage(), 1.0f);
+    UE_LOG(LogBatAgent, Verbose, TEXT("[%s] Fired projectile at %s"),
         *GetName(), *Target->GetName());
 
     // Play attack effects (sound/particles) - implemented in parent
@@ -178,6 +183,8 @@ bool ABatAgent::Attack_Implementation(AActor* Target)
 
 void ABatAgent::SimpleAI_ChaseAndAttack(float DeltaTime)
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_BatChaseAndAttack);
+
     // SIMPLE TICK-BASED AI:
     // This is a basic AI for quick testing. It's not as sophisticated
     // as a behavior tree, but it works and is easy to understand.
@@ -9,12 +9,13 @@
 // It simply enables AC_BroomComponent on the player, which handles all flight logic.
 
 #include "Code/Actors/BroomActor.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/Utility/AC_BroomComponent.h"
 #include "Code/Utility/AC_SpellCollectionComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/Character.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogBroomActor, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogBroomActor, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // CONSTRUCTOR
@@ -33,10 +34,13 @@ ABroomActor::ABroomActor()
     RootComponent = BroomMesh;
 
     // QueryOnly collision (allows interaction raycast, no physics)
+    // Interactable object type so the player's detection sphere finds it
     BroomMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    BroomMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
+    BroomMesh->SetCollisionObjectType(ECC_Interactable);
     BroomMesh->SetCollisionResponseToAllChannels(ECR_Ignore);
     BroomMesh->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+    BroomMesh->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
+    BroomMesh->SetGenerateOverlapEvents(true);
 }
 
 // ============================================================================
@@ -179,12 +183,12 @@ void ABroomActor::MountPlayer(AActor* Player)
     // World broom actor is just a trigger (like Unity weapon pickup collider).
     // It stays in the world at its original location.
     // AC_BroomComponent handles:
-    //   - Spawning broom visual actor
+    //   - Showing the persistent broom visual actor
     //   - Attaching broom to player's MountSocket
-    //   - Switching movement mode to MOVE_Flying
+    //   - Switching to the broom custom movement mode
     //   - Adding flight input context
     //   - Managing stamina drain
-    //   - Destroying broom on dismount
+    //   - Hiding broom on dismount
 
     // This function exists for interface compatibility but does nothing.
     // Designer workflow: Place this actor in level, configure RequiredChannel.
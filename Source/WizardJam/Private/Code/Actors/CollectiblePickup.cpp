@@ -8,11 +8,12 @@
 // ============================================================================
 
 #include "Code/Actors/CollectiblePickup.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/Utility/AC_SpellCollectionComponent.h"
 #include "GameFramework/Pawn.h"
 #include "GenericTeamAgentInterface.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogCollectible, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogCollectible, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 ACollectiblePickup::ACollectiblePickup()
     : ItemName(FName("Collectible"))
@@ -107,7 +108,7 @@ void ACollectiblePickup::GrantChannels(AActor* OtherActor)
     }
 
     // Filter out invalid channels (NAME_None entries)
-    TArray<FName> ValidChannels;
+    TArray<FName, TInlineAllocator<8>> ValidChannels;
     for (const FName& Channel : GrantsSpellChannels)
     {
         if (Channel != NAME_None)
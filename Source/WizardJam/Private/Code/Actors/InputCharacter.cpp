@@ -29,7 +29,8 @@ DEFINE_LOG_CATEGORY(LogInputCharacter);
 // CONSTRUCTOR
 // ============================================================================
 
-AInputCharacter::AInputCharacter()
+AInputCharacter::AInputCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
 {
     PrimaryActorTick.bCanEverTick = true;
 
@@ -13,6 +13,8 @@
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Code/Actors/BaseProjectile.h"
+#include "Code/Utility/AimAssistSubsystem.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "TimerManager.h"
 
@@ -84,10 +86,26 @@ void AQuidditchGoal::BeginPlay()
     // Apply element color to goal mesh material
     ApplyElementColor();
 
+    // Goals are aim assist targets for throws at the hoop
+    if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+    {
+        AimAssist->RegisterTarget(this);
+    }
+
     UE_LOG(LogQuidditchGoal, Display, TEXT("[%s] Goal ready | Element: '%s' | Team: %d | Points: %d"),
         *GetName(), *GoalElement.ToString(), TeamID, PointsForCorrectElement);
 }
 
+void AQuidditchGoal::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+    {
+        AimAssist->UnregisterTarget(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AQuidditchGoal::OnScoringZoneBeginOverlap(
     UPrimitiveComponent* OverlappedComponent,
     AActor* OtherActor,
@@ -192,6 +210,8 @@ void AQuidditchGoal::ApplyElementColor()
         DynamicMaterial = GoalMesh->CreateDynamicMaterialInstance(0);
         if (DynamicMaterial)
         {
+            WJ_COUNTER_INC(MIDsCreated);
+
             // Set base and emissive colors
             // Material must have these parameter names for this to work
             DynamicMaterial->SetVectorParameterValue(FName("BaseColor"), CurrentColor);
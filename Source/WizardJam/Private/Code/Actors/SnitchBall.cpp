@@ -2,6 +2,7 @@
 
 
 #include "Code/Actors/SnitchBall.h"
+#include "Code/Utility/AimAssistSubsystem.h"
 
 // Sets default values
 ASnitchBall::ASnitchBall()
@@ -15,7 +16,22 @@ ASnitchBall::ASnitchBall()
 void ASnitchBall::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	// The Snitch is a soft-lock target for controller players
+	if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+	{
+		AimAssist->RegisterTarget(this);
+	}
+}
+
+void ASnitchBall::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>())
+	{
+		AimAssist->UnregisterTarget(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -33,6 +33,7 @@
 #include "Code/Actors/SpellCollectible.h"
 #include "Code/Utility/ISpellCollector.h"
 #include "Code/Utility/AC_SpellCollectionComponent.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialInterface.h"
@@ -275,6 +276,21 @@ TArray<FName> ASpellCollectible::GetMissingChannels(AActor* Actor) const
     return Missing;
 }
 
+FName ASpellCollectible::GetFirstMissingChannel(AActor* Actor) const
+{
+    UAC_SpellCollectionComponent* SpellComp = GetCollectorComponent(Actor);
+
+    for (const FName& Channel : RequiredChannels)
+    {
+        if (Channel != NAME_None && (!SpellComp || !SpellComp->HasChannel(Channel)))
+        {
+            return Channel;
+        }
+    }
+
+    return NAME_None;
+}
+
 // ============================================================================
 // PICKUP LOGIC
 // ============================================================================
@@ -340,8 +356,7 @@ bool ASpellCollectible::CanBePickedUp(AActor* OtherActor) const
     // Step 5: Check channel requirements
     if (!MeetsChannelRequirements(OtherActor))
     {
-        TArray<FName> Missing = GetMissingChannels(OtherActor);
-        FName FirstMissing = Missing.Num() > 0 ? Missing[0] : NAME_None;
+        FName FirstMissing = GetFirstMissingChannel(OtherActor);
 
         UE_LOG(LogSpellCollectible, Log,
             TEXT("[%s] '%s' missing required channel '%s'"),
@@ -355,7 +370,7 @@ bool ASpellCollectible::CanBePickedUp(AActor* OtherActor) const
     }
 
     // All checks passed!
-    UE_LOG(LogSpellCollectible, Log,
+    UE_LOG(LogSpellCollectible, Verbose,
         TEXT("[%s] '%s' passed all requirements - pickup allowed"),
         *GetName(), *OtherActor->GetName());
 
@@ -395,7 +410,7 @@ void ASpellCollectible::HandlePickup(AActor* OtherActor)
     // Get team for logging
     int32 TeamID = ISpellCollector::Execute_GetCollectorTeamID(OtherActor);
 
-    UE_LOG(LogSpellCollectible, Display,
+    UE_LOG(LogSpellCollectible, Verbose,
         TEXT("[%s] === SPELL COLLECTED === Type: '%s' | Collector: '%s' (Team %d) | New: %s"),
         *GetName(),
         *SpellTypeName.ToString(),
@@ -420,25 +435,25 @@ void ASpellCollectible::GrantChannelsToCollector(UAC_SpellCollectionComponent* S
         return;
     }
 
-    TArray<FName> Granted;
     for (const FName& Channel : GrantsChannels)
     {
         if (Channel != NAME_None)
         {
             SpellComp->AddChannel(Channel);
-            Granted.Add(Channel);
         }
     }
 
-    if (Granted.Num() > 0)
+    // Channel list is only built when someone is listening
+    if (UE_LOG_ACTIVE(LogSpellCollectible, Verbose))
     {
         FString GrantedStr;
-        for (const FName& Ch : Granted)
+        for (const FName& Channel : GrantsChannels)
         {
+            if (Channel == NAME_None) continue;
             if (!GrantedStr.IsEmpty()) GrantedStr += TEXT(", ");
-            GrantedStr += Ch.ToString();
+            GrantedStr += Channel.ToString();
         }
-        UE_LOG(LogSpellCollectible, Display,
+        UE_LOG(LogSpellCollectible, Verbose,
             TEXT("[%s] Granted channels: [%s]"),
             *GetName(), *GrantedStr);
     }
@@ -551,6 +566,7 @@ bool ASpellCollectible::TryApplyColorToMaterial(UMaterialInterface* BaseMaterial
     {
         return false;
     }
+    WJ_COUNTER_INC(MIDsCreated);
 
     OutWorkingParam = FindWorkingColorParameter(DynMat);
     if (OutWorkingParam == NAME_None)
@@ -0,0 +1,95 @@
+// AoEProjectileTest.cpp
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// 50 detonations into a crowd of 500 pawns must cost exactly one overlap
+// query each, counted through the Traces gameplay counter. Each detonation
+// pass is also timed and the per-detonation cost reported with the result.
+//
+// Run: Session Frontend > Automation, or
+// -ExecCmds="Automation RunTests WizardJam.Combat.AoEProjectile"
+
+#include "Misc/AutomationTest.h"
+#include "Code/Tests/WizardJamTestWorld.h"
+#include "Code/Actors/AoEProjectile.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "GameFramework/DefaultPawn.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WIZARDJAM_COUNTERS_ENABLED
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAoEProjectileOverlapBudgetTest,
+    "WizardJam.Combat.AoEProjectile.OneOverlapPerDetonation",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAoEProjectileOverlapBudgetTest::RunTest(const FString& Parameters)
+{
+    static constexpr int32 NumDetonations = 50;
+    static constexpr int32 GridWidth = 25;
+    static constexpr int32 GridDepth = 20;
+    static constexpr float GridSpacing = 200.0f;
+
+    FWizardJamTestWorld TestWorld;
+
+    // 500 victims on the ground plane
+    for (int32 X = 0; X < GridWidth; ++X)
+    {
+        for (int32 Y = 0; Y < GridDepth; ++Y)
+        {
+            TestWorld.Spawn<ADefaultPawn>(FVector(X * GridSpacing, Y * GridSpacing, 0.0f));
+        }
+    }
+
+    // Projectiles wait well above the crowd so their own overlap never triggers a hit
+    TArray<AAoEProjectile*> Projectiles;
+    for (int32 Index = 0; Index < NumDetonations; ++Index)
+    {
+        AAoEProjectile* Projectile = TestWorld.Spawn<AAoEProjectile>(FVector(Index * 100.0f, 0.0f, 100000.0f));
+        if (!TestNotNull(TEXT("AoE projectile spawned"), Projectile))
+        {
+            return false;
+        }
+        Projectiles.Add(Projectile);
+    }
+
+    const int32 TracesBefore = FWizardJamCounters::Values[static_cast<int32>(EWizardJamCounter::Traces)];
+
+    int32 TotalVictims = 0;
+    TArray<double> DetonationMs;
+    DetonationMs.Reserve(NumDetonations);
+    for (int32 Index = 0; Index < NumDetonations; ++Index)
+    {
+        const FVector Origin((Index % GridWidth) * GridSpacing, (Index / GridWidth) * GridSpacing * 4.0f, 0.0f);
+
+        // Overlap query, victim sort and the batched damage pass
+        const double StartTime = FPlatformTime::Seconds();
+        const int32 Victims = Projectiles[Index]->Detonate(Origin);
+        DetonationMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        TestTrue(FString::Printf(TEXT("Detonation %d damaged someone"), Index), Victims > 0);
+        TotalVictims += Victims;
+    }
+
+    const int32 Traces = FWizardJamCounters::Values[static_cast<int32>(EWizardJamCounter::Traces)] - TracesBefore;
+    TestEqual(TEXT("Overlap queries"), Traces, NumDetonations);
+
+    // A second detonation of the same projectile is a no-op and must not query again
+    Projectiles[0]->Detonate(FVector::ZeroVector);
+    TestEqual(TEXT("Overlap queries after repeat detonation"),
+        FWizardJamCounters::Values[static_cast<int32>(EWizardJamCounter::Traces)] - TracesBefore, NumDetonations);
+
+    double TotalMs = 0.0;
+    for (double Ms : DetonationMs)
+    {
+        TotalMs += Ms;
+    }
+    DetonationMs.Sort();
+
+    AddInfo(FString::Printf(TEXT("%d detonations, %d overlap queries, %d victims"), NumDetonations, Traces, TotalVictims));
+    AddInfo(FString::Printf(TEXT("Per detonation on a %d-pawn field: mean %.3f ms | median %.3f ms | max %.3f ms | total %.2f ms"),
+        GridWidth * GridDepth, TotalMs / NumDetonations, DetonationMs[NumDetonations / 2], DetonationMs.Last(), TotalMs));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WIZARDJAM_COUNTERS_ENABLED
@@ -0,0 +1,96 @@
+// BroomMoveBandwidthTest.cpp
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Upstream bandwidth of one broom flier on a listen server. Every remote
+// flier sends one packed move per ClientNetSendMoveDeltaTime; the move is
+// serialized here with the same net serializer ServerMovePacked uses, with
+// and without the broom stamina field, and the per-flier rate is reported.
+// Broom intents ride in the existing compressed flags byte, so the stamina
+// float must be the only addition. Corrections carry one more float, only
+// when the server actually corrects.
+//
+// Run: Session Frontend > Automation, or
+// -ExecCmds="Automation RunTests WizardJam.Net.BroomMoveBandwidth"
+
+#include "Misc/AutomationTest.h"
+#include "Code/Tests/WizardJamTestWorld.h"
+#include "Code/Utility/WizardJamMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameNetworkManager.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace WizardJamBroomBandwidthTest
+{
+    // A boosting, ascending flier mid-flight
+    static void FillFlyingMove(FCharacterNetworkMoveData& MoveData)
+    {
+        MoveData.TimeStamp = 12.345f;
+        MoveData.Acceleration = FVector(1843.0f, -612.0f, 0.0f);
+        MoveData.Location = FVector(10240.5f, -3312.25f, 1876.0f);
+        MoveData.ControlRotation = FRotator(-12.0f, 73.5f, 0.0f);
+        MoveData.CompressedMoveFlags = FSavedMove_Character::FLAG_Custom_0
+            | FSavedMove_Character::FLAG_Custom_1
+            | FSavedMove_Character::FLAG_Custom_3;
+    }
+
+    static int64 SerializedBits(FCharacterNetworkMoveData& MoveData, UCharacterMovementComponent& MoveComp)
+    {
+        FNetBitWriter Writer(nullptr, 8 * 1024);
+        MoveData.Serialize(MoveComp, Writer, nullptr, FCharacterNetworkMoveData::ENetworkMoveType::NewMove);
+        return Writer.IsError() ? -1 : Writer.GetNumBits();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBroomMoveBandwidthTest,
+    "WizardJam.Net.BroomMoveBandwidth",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBroomMoveBandwidthTest::RunTest(const FString& Parameters)
+{
+    using namespace WizardJamBroomBandwidthTest;
+
+    FWizardJamTestWorld TestWorld;
+
+    ACharacter* Flier = TestWorld.Spawn<ACharacter>(FVector::ZeroVector);
+    if (!TestNotNull(TEXT("Flier spawned"), Flier) || !TestNotNull(TEXT("Flier movement"), Flier->GetCharacterMovement()))
+    {
+        return false;
+    }
+
+    FCharacterNetworkMoveData StockMove;
+    FillFlyingMove(StockMove);
+
+    FWizardJamNetworkMoveData BroomMove;
+    FillFlyingMove(BroomMove);
+    BroomMove.BroomStamina = 63.5f;
+
+    const int64 StockBits = SerializedBits(StockMove, *Flier->GetCharacterMovement());
+    const int64 BroomBits = SerializedBits(BroomMove, *Flier->GetCharacterMovement());
+    if (!TestTrue(TEXT("Moves serialized"), StockBits > 0 && BroomBits > 0))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Broom flight adds only the stamina float to each move"), BroomBits - StockBits, static_cast<int64>(32));
+
+    // Remote clients on a listen server send at most one packed move per send interval
+    const float SendDeltaTime = FMath::Max(GetDefault<AGameNetworkManager>()->ClientNetSendMoveDeltaTime, KINDA_SMALL_NUMBER);
+    const double MovesPerSecond = 1.0 / SendDeltaTime;
+    const double BroomBytesPerSecond = BroomBits / 8.0 * MovesPerSecond;
+    const double StockBytesPerSecond = StockBits / 8.0 * MovesPerSecond;
+
+    AddInfo(FString::Printf(TEXT("Move payload: %lld bits stock, %lld bits flying the broom"), StockBits, BroomBits));
+    AddInfo(FString::Printf(TEXT("Per flier at %.0f moves/s: %.0f B/s upstream (%.0f B/s stock, +%.1f%%)"),
+        MovesPerSecond, BroomBytesPerSecond, StockBytesPerSecond,
+        100.0 * (BroomBytesPerSecond - StockBytesPerSecond) / StockBytesPerSecond));
+    AddInfo(TEXT("Excludes packet and RPC headers, which are the same with or without broom flight"));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,184 @@
+// HUDPaintBudgetTest.cpp
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Counts Slate work per frame for WBP_PlayerHUD, idle versus in combat.
+// The HUD is drawn offscreen with FWidgetRenderer for a fixed number of
+// frames; widget paints are counted through FSlateDebugging::BeginWidgetPaint
+// and prepass work through layout/prepass invalidations (Slate has no
+// per-widget prepass hook - a widget only re-runs prepass after one).
+//
+// Expectations:
+// - Idle: no layout or prepass invalidations at all once the HUD settles
+// - Combat (bars moving every frame): the static layout is cached in an
+//   invalidation panel (from the asset or wrapped at runtime by the HUD),
+//   so fewer widgets paint per frame than the full tree
+//
+// Run: Session Frontend > Automation, or
+// -ExecCmds="Automation RunTests WizardJam.UI.HUD"
+
+#include "Misc/AutomationTest.h"
+#include "Code/Tests/WizardJamTestWorld.h"
+#include "Code/UI/WizardJamHUDWidget.h"
+#include "Code/Utility/AC_HealthComponent.h"
+#include "Code/Utility/AC_StaminaComponent.h"
+#include "Blueprint/WidgetTree.h"
+#include "Debugging/SlateDebugging.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Slate/WidgetRenderer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_SLATE_DEBUGGING
+
+namespace WizardJamHUDTest
+{
+    static constexpr int32 WarmupFrames = 5;
+    static constexpr int32 MeasuredFrames = 60;
+    static constexpr float FrameDelta = 1.0f / 60.0f;
+
+    struct FSlateWorkCounts
+    {
+        int32 Paints = 0;
+        int32 LayoutInvalidations = 0;
+    };
+
+    // Counts Slate paint and prepass-causing invalidations while in scope
+    class FScopedSlateWorkCounter
+    {
+    public:
+        explicit FScopedSlateWorkCounter(FSlateWorkCounts& InCounts)
+            : Counts(InCounts)
+        {
+            PaintHandle = FSlateDebugging::BeginWidgetPaint.AddLambda(
+                [this](const SWidget*, const FPaintArgs&, const FGeometry&, const FSlateRect&, const FSlateWindowElementList&, int32)
+                {
+                    ++Counts.Paints;
+                });
+
+            InvalidateHandle = FSlateDebugging::WidgetInvalidateEvent.AddLambda(
+                [this](const FSlateDebuggingInvalidateArgs& Args)
+                {
+                    if (EnumHasAnyFlags(Args.InvalidateWidgetReason, EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::Prepass))
+                    {
+                        ++Counts.LayoutInvalidations;
+                    }
+                });
+        }
+
+        ~FScopedSlateWorkCounter()
+        {
+            FSlateDebugging::BeginWidgetPaint.Remove(PaintHandle);
+            FSlateDebugging::WidgetInvalidateEvent.Remove(InvalidateHandle);
+        }
+
+    private:
+        FSlateWorkCounts& Counts;
+        FDelegateHandle PaintHandle;
+        FDelegateHandle InvalidateHandle;
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHUDPaintBudgetTest,
+    "WizardJam.UI.HUD.PaintBudgetIdleVsCombat",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHUDPaintBudgetTest::RunTest(const FString& Parameters)
+{
+    using namespace WizardJamHUDTest;
+
+    if (!FSlateApplication::IsInitialized())
+    {
+        AddWarning(TEXT("Slate is not initialized - HUD paint budget not measured"));
+        return true;
+    }
+
+    UClass* HUDClass = LoadClass<UWizardJamHUDWidget>(nullptr, TEXT("/Game/UI/WBP_PlayerHUD.WBP_PlayerHUD_C"));
+    if (!TestNotNull(TEXT("WBP_PlayerHUD derives from UWizardJamHUDWidget"), HUDClass))
+    {
+        return false;
+    }
+
+    FWizardJamTestWorld TestWorld;
+
+    // Pawn with the two components the bars follow
+    ADefaultPawn* Pawn = TestWorld.Spawn<ADefaultPawn>(FVector::ZeroVector);
+    UAC_HealthComponent* Health = NewObject<UAC_HealthComponent>(Pawn);
+    UAC_StaminaComponent* Stamina = NewObject<UAC_StaminaComponent>(Pawn);
+    Health->RegisterComponent();
+    Stamina->RegisterComponent();
+    Health->Initialize(100000.0f);
+    Stamina->Initialize(100.0f);
+
+    APlayerController* PC = TestWorld.Spawn<APlayerController>(FVector::ZeroVector);
+    PC->Possess(Pawn);
+
+    UWizardJamHUDWidget* HUD = CreateWidget<UWizardJamHUDWidget>(PC, HUDClass);
+    if (!TestNotNull(TEXT("HUD widget created"), HUD))
+    {
+        return false;
+    }
+
+    const FVector2D DrawSize(1920.0, 1080.0);
+    TSharedRef<SWidget> HUDSlate = HUD->TakeWidget();
+    FWidgetRenderer Renderer(false, true);
+    UTextureRenderTarget2D* RenderTarget = FWidgetRenderer::CreateTargetFor(DrawSize, TF_Bilinear, false);
+    RenderTarget->AddToRoot();
+
+    auto DrawFrames = [&](int32 NumFrames, TFunctionRef<void()> PerFrame, FSlateWorkCounts* OutCounts)
+    {
+        TOptional<FScopedSlateWorkCounter> Counter;
+        if (OutCounts)
+        {
+            Counter.Emplace(*OutCounts);
+        }
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            PerFrame();
+            TestWorld.Tick(FrameDelta);
+            Renderer.DrawWidget(RenderTarget, HUDSlate, DrawSize, FrameDelta);
+        }
+    };
+
+    // First frame paints the whole tree - the ceiling a cached layout should stay under
+    FSlateWorkCounts FullTree;
+    DrawFrames(1, [] {}, &FullTree);
+    DrawFrames(WarmupFrames, [] {}, nullptr);
+
+    FSlateWorkCounts Idle;
+    DrawFrames(MeasuredFrames, [] {}, &Idle);
+
+    // Combat: damage every frame and a stamina drain, so both bars move
+    Stamina->SetSustainedDrainRate(1.0f);
+    DrawFrames(WarmupFrames, [Health] { Health->ApplyDamage(1.0f); }, nullptr);
+
+    FSlateWorkCounts Combat;
+    DrawFrames(MeasuredFrames, [Health] { Health->ApplyDamage(1.0f); }, &Combat);
+
+    Stamina->SetSustainedDrainRate(0.0f);
+    RenderTarget->RemoveFromRoot();
+
+    const float IdlePaintsPerFrame = static_cast<float>(Idle.Paints) / MeasuredFrames;
+    const float CombatPaintsPerFrame = static_cast<float>(Combat.Paints) / MeasuredFrames;
+
+    AddInfo(FString::Printf(TEXT("Full tree: %d paints | Idle: %.1f paints, %.2f layout invalidations per frame | Combat: %.1f paints, %.2f layout invalidations per frame"),
+        FullTree.Paints,
+        IdlePaintsPerFrame, static_cast<float>(Idle.LayoutInvalidations) / MeasuredFrames,
+        CombatPaintsPerFrame, static_cast<float>(Combat.LayoutInvalidations) / MeasuredFrames));
+
+    TestEqual(TEXT("Idle layout/prepass invalidations"), Idle.LayoutInvalidations, 0);
+    TestTrue(TEXT("Idle paints no more than combat"), IdlePaintsPerFrame <= CombatPaintsPerFrame);
+
+    TestNotNull(TEXT("Static layout is cached"), HUD->WidgetTree->FindWidget(TEXT("StaticLayoutInvalidationBox")));
+    TestNotNull(TEXT("Spell slots are cached"), HUD->WidgetTree->FindWidget(TEXT("SpellSlotInvalidationBox")));
+    TestTrue(TEXT("Combat repaints less than the full tree"), CombatPaintsPerFrame < FullTree.Paints);
+
+    HUD->RemoveFromParent();
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_SLATE_DEBUGGING
@@ -0,0 +1,214 @@
+// HotPathAllocationTest.cpp
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Scripted fight that asserts the aim, fire, hit, pickup and spell-cycle
+// paths make zero game-thread heap allocations per frame once warmed up.
+// Every frame the player refreshes its aim trace, cycles its equipped spell,
+// pulls the trigger, checks a spell collectible's channel requirements and
+// trades damage with an enemy, and the enemy runs into two pickups that
+// turn it away (BasePickup overlap -> CanBePickedUp). Only those calls are
+// counted - the world tick between frames is excluded, it is engine work
+// rather than gameplay code.
+//
+// Most trigger pulls are refused by the fire cooldown and must not allocate.
+// A shot that does fire spawns an actor, which always allocates, so each one
+// is compared with a bare SpawnActor of the same projectile made right after
+// it: the fire path may not allocate anything beyond that spawn.
+//
+// Run: Session Frontend > Automation, or
+// -ExecCmds="Automation RunTests WizardJam.Perf.HotPathAllocations"
+
+#include "Misc/AutomationTest.h"
+#include "Code/Tests/WizardJamTestWorld.h"
+#include "Code/Tests/ScopedAllocationCounter.h"
+#include "Code/Actors/BasePlayer.h"
+#include "Code/Actors/BaseProjectile.h"
+#include "Code/Actors/CollectiblePickup.h"
+#include "Code/Actors/SpellCollectible.h"
+#include "Code/Utility/AC_AimComponent.h"
+#include "Code/Utility/AC_CombatComponent.h"
+#include "Code/Utility/AC_HealthComponent.h"
+#include "Code/Utility/AC_SpellCollectionComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/DamageEvents.h"
+#include "GameFramework/PlayerController.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHotPathAllocationTest,
+    "WizardJam.Perf.HotPathAllocations.ScriptedFight",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHotPathAllocationTest::RunTest(const FString& Parameters)
+{
+    static constexpr int32 WarmupFrames = 10;
+    static constexpr int32 MeasuredFrames = 120;
+    static constexpr float FrameDelta = 1.0f / 60.0f;
+
+    FWizardJamTestWorld TestWorld;
+
+    ABasePlayer* Player = TestWorld.Spawn<ABasePlayer>(FVector::ZeroVector);
+    ABaseCharacter* Enemy = TestWorld.Spawn<ABaseCharacter>(FVector(800.0f, 0.0f, 0.0f), FRotator(0.0f, 180.0f, 0.0f));
+    ASpellCollectible* Collectible = TestWorld.Spawn<ASpellCollectible>(FVector(300.0f, 300.0f, 0.0f));
+    ACollectiblePickup* Pickup = TestWorld.Spawn<ACollectiblePickup>(FVector(600.0f, 0.0f, 0.0f));
+    APlayerController* PC = TestWorld.Spawn<APlayerController>(FVector::ZeroVector);
+    if (!TestNotNull(TEXT("Player"), Player) || !TestNotNull(TEXT("Enemy"), Enemy)
+        || !TestNotNull(TEXT("Collectible"), Collectible) || !TestNotNull(TEXT("Pickup"), Pickup)
+        || !TestNotNull(TEXT("Controller"), PC))
+    {
+        return false;
+    }
+    PC->Possess(Player);
+
+    // Tagged player (what BasePickup looks for) and an enemy-team opponent,
+    // which both pickups refuse - neither is collected mid-script
+    Player->Tags.Add(TEXT("Player"));
+    Enemy->SetGenericTeamId(FGenericTeamId(1));
+
+    // Enough health on both sides that nobody dies mid-script
+    UAC_HealthComponent* PlayerHealth = Player->FindComponentByClass<UAC_HealthComponent>();
+    UAC_HealthComponent* EnemyHealth = Enemy->FindComponentByClass<UAC_HealthComponent>();
+    if (!TestNotNull(TEXT("Player health"), PlayerHealth) || !TestNotNull(TEXT("Enemy health"), EnemyHealth))
+    {
+        return false;
+    }
+    PlayerHealth->Initialize(1000000.0f);
+    EnemyHealth->Initialize(1000000.0f);
+
+    // All four spells unlocked so every cycle step changes the equipped spell
+    UAC_SpellCollectionComponent* Spells = Player->GetSpellCollection();
+    for (const TCHAR* Spell : { TEXT("Flame"), TEXT("Ice"), TEXT("Lightning"), TEXT("Arcane") })
+    {
+        Spells->AddSpell(FName(Spell));
+        Spells->AddChannel(FName(Spell));
+    }
+
+    UAC_AimComponent* Aim = Player->GetAimComponent();
+    UAC_CombatComponent* Combat = Player->GetCombatComponent();
+    if (!TestNotNull(TEXT("Combat component"), Combat))
+    {
+        return false;
+    }
+
+    const FDamageEvent DamageEvent;
+    const FHitResult NoSweep;
+    UBoxComponent* CollectibleBox = Collectible->GetCollisionBox();
+    UBoxComponent* PickupBox = Pickup->GetCollisionBox();
+    UPrimitiveComponent* EnemyCapsule = Enemy->GetCapsuleComponent();
+
+    ABaseProjectile* LastShot = nullptr;
+
+    // Everything except the shot - that is measured on its own below
+    auto FightFrame = [&]()
+    {
+        Aim->RequestAimUpdate();
+        Player->CycleToNextSpell();
+        Collectible->GetFirstMissingChannel(Player);
+        CollectibleBox->OnComponentBeginOverlap.Broadcast(CollectibleBox, Enemy, EnemyCapsule, 0, false, NoSweep);
+        PickupBox->OnComponentBeginOverlap.Broadcast(PickupBox, Enemy, EnemyCapsule, 0, false, NoSweep);
+        Enemy->TakeDamage(5.0f, DamageEvent, PC, Player);
+        Player->TakeDamage(3.0f, DamageEvent, nullptr, Enemy);
+    };
+
+    auto Fire = [&]()
+    {
+        LastShot = Combat->FireProjectileClass(ABaseProjectile::StaticClass());
+    };
+
+    // The same spawn the fire path makes, without any of the fire path around it
+    auto SpawnReferenceShot = [&]()
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = Player;
+        SpawnParams.Instigator = Player;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        return TestWorld.Get()->SpawnActor<ABaseProjectile>(ABaseProjectile::StaticClass(),
+            LastShot->GetActorLocation(), LastShot->GetActorRotation(), SpawnParams);
+    };
+
+    // Warm-up grows any reusable buffers to their steady-state size and
+    // fires at least once, so the first counted shot is not the first spawn
+    for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+    {
+        FightFrame();
+        Fire();
+        if (LastShot)
+        {
+            if (ABaseProjectile* Reference = SpawnReferenceShot())
+            {
+                Reference->Destroy();
+            }
+        }
+        TestWorld.Tick(FrameDelta);
+    }
+
+    int32 TotalAllocations = 0;
+    int32 WorstFrame = 0;
+    int32 ShotsFired = 0;
+    int32 ShotAllocations = 0;
+    int32 ReferenceSpawnAllocations = 0;
+    {
+        FScopedAllocationCounter Allocations;
+        for (int32 Frame = 0; Frame < MeasuredFrames; ++Frame)
+        {
+            Allocations.Reset();
+            FightFrame();
+            const int32 FightAllocations = Allocations.GetCount();
+
+            Allocations.Reset();
+            Fire();
+            const int32 FireAllocations = Allocations.GetCount();
+
+            int32 FrameAllocations = FightAllocations;
+            if (LastShot)
+            {
+                // Shot went out - everything beyond a bare spawn counts against the frame
+                ++ShotsFired;
+                ShotAllocations += FireAllocations;
+
+                Allocations.Reset();
+                ABaseProjectile* Reference = SpawnReferenceShot();
+                const int32 SpawnAllocations = Allocations.GetCount();
+                ReferenceSpawnAllocations += SpawnAllocations;
+
+                FrameAllocations += FMath::Max(FireAllocations - SpawnAllocations, 0);
+
+                Allocations.Pause();
+                if (Reference)
+                {
+                    Reference->Destroy();
+                }
+                Allocations.Resume();
+            }
+            else
+            {
+                // Refused by the cooldown
+                FrameAllocations += FireAllocations;
+            }
+
+            TotalAllocations += FrameAllocations;
+            WorstFrame = FMath::Max(WorstFrame, FrameAllocations);
+
+            Allocations.Pause();
+            TestWorld.Tick(FrameDelta);
+            Allocations.Resume();
+        }
+    }
+
+    AddInfo(FString::Printf(TEXT("%d frames | %d allocations | worst frame %d"), MeasuredFrames, TotalAllocations, WorstFrame));
+    AddInfo(FString::Printf(TEXT("%d shots | %d allocations firing | %d for the same bare spawns"),
+        ShotsFired, ShotAllocations, ReferenceSpawnAllocations));
+    TestEqual(TEXT("Game-thread allocations in steady-state fight frames"), TotalAllocations, 0);
+    TestTrue(TEXT("Shots fired during the measured frames"), ShotsFired > 0);
+    TestTrue(TEXT("Player took damage"), PlayerHealth->GetCurrentHealth() < 1000000.0f);
+    TestTrue(TEXT("Enemy took damage"), EnemyHealth->GetCurrentHealth() < 1000000.0f);
+    TestTrue(TEXT("Pickups turned the enemy away"), IsValid(Collectible) && IsValid(Pickup));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
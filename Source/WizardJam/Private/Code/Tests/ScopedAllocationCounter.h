@@ -0,0 +1,159 @@
+// ScopedAllocationCounter.h
+// Counts game-thread heap allocations while in scope
+//
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Automation tests that assert a path is allocation-free wrap it in one of
+// these. The first scope installs a forwarding FMalloc in front of GMalloc;
+// while a scope is alive it counts every Malloc/Realloc made on the game
+// thread. Worker threads allocate through it too but are not counted. Every
+// call is forwarded to the original allocator, so blocks allocated before,
+// during or after a scope can be freed at any time.
+//
+// The forwarder is a heap object that is never freed and stays installed
+// once installed: a worker thread can still be inside its Malloc when a scope
+// ends, so ending a scope only stops counting and never swaps GMalloc back.
+//
+// Counting can be paused (Pause/Resume) so setup work between measured
+// sections does not need a second scope.
+//
+// USAGE:
+// FScopedAllocationCounter Allocations;
+// RunHotPath();
+// TestEqual(TEXT("Allocations"), Allocations.GetCount(), 0);
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MemoryBase.h"
+
+// Process-lifetime forwarder behind FScopedAllocationCounter
+class FAllocationCountingMalloc final : public FMalloc
+{
+public:
+    // Installs the forwarder on first use
+    static FAllocationCountingMalloc& Get()
+    {
+        check(IsInGameThread());
+        static FAllocationCountingMalloc* Instance = nullptr;
+        if (!Instance)
+        {
+            Instance = new FAllocationCountingMalloc(GMalloc);
+            GMalloc = Instance;
+        }
+        return *Instance;
+    }
+
+    void BeginCounting()
+    {
+        check(!bCounting);
+        Count = 0;
+        bPaused = false;
+        bCounting = true;
+    }
+
+    void EndCounting() { bCounting = false; }
+
+    int32 GetCount() const { return Count; }
+    void Reset() { Count = 0; }
+    void Pause() { bPaused = true; }
+    void Resume() { bPaused = false; }
+
+    // ========================================================================
+    // FMalloc - everything forwards to the allocator that was installed
+    // ========================================================================
+
+    virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->Malloc(Size, Alignment);
+    }
+
+    virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->TryMalloc(Size, Alignment);
+    }
+
+    virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+    {
+        if (Size > 0)
+        {
+            CountAllocation();
+        }
+        return Inner->Realloc(Original, Size, Alignment);
+    }
+
+    virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+    {
+        if (Size > 0)
+        {
+            CountAllocation();
+        }
+        return Inner->TryRealloc(Original, Size, Alignment);
+    }
+
+    virtual void Free(void* Original) override { Inner->Free(Original); }
+    virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return Inner->QuantizeSize(Size, Alignment); }
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+    virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+    virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+    virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+    virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+    virtual const TCHAR* GetDescriptiveName() override { return TEXT("WizardJamAllocationCounter"); }
+
+private:
+    explicit FAllocationCountingMalloc(FMalloc* InInner)
+        : Inner(InInner)
+    {
+    }
+
+    // Count, bCounting and bPaused are only touched on the game thread
+    void CountAllocation()
+    {
+        if (bCounting && !bPaused && IsInGameThread())
+        {
+            ++Count;
+        }
+    }
+
+    FMalloc* Inner;
+    int32 Count = 0;
+    bool bCounting = false;
+    bool bPaused = false;
+};
+
+class FScopedAllocationCounter
+{
+public:
+    FScopedAllocationCounter()
+        : Counter(FAllocationCountingMalloc::Get())
+    {
+        Counter.BeginCounting();
+    }
+
+    ~FScopedAllocationCounter()
+    {
+        Counter.EndCounting();
+    }
+
+    FScopedAllocationCounter(const FScopedAllocationCounter&) = delete;
+    FScopedAllocationCounter& operator=(const FScopedAllocationCounter&) = delete;
+
+    int32 GetCount() const { return Counter.GetCount(); }
+    void Reset() { Counter.Reset(); }
+    void Pause() { Counter.Pause(); }
+    void Resume() { Counter.Resume(); }
+
+private:
+    FAllocationCountingMalloc& Counter;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
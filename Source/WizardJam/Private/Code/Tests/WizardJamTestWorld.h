@@ -0,0 +1,79 @@
+// WizardJamTestWorld.h
+// Minimal game world for automation tests
+//
+// Developer: Marcus Daley
+// Date: January 22, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Automation tests that need real actors (overlap queries, component ticks,
+// widget paint) create one of these on the stack. It owns a standalone game
+// world with a physics scene, has begun play, and is torn down when the
+// scope ends. No game mode is spawned, so project defaults do not leak in.
+//
+// USAGE:
+// FWizardJamTestWorld TestWorld;
+// AActor* Actor = TestWorld.Spawn<AActor>(FVector::ZeroVector);
+// TestWorld.Tick(1.0f / 60.0f);
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+
+class FWizardJamTestWorld
+{
+public:
+    FWizardJamTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("WizardJamTestWorld"));
+
+        FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+        Context.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+
+        // BeginPlay only dispatches through a game mode; without one, start play directly
+        if (!World->HasBegunPlay())
+        {
+            World->GetWorldSettings()->NotifyBeginPlay();
+        }
+    }
+
+    ~FWizardJamTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    FWizardJamTestWorld(const FWizardJamTestWorld&) = delete;
+    FWizardJamTestWorld& operator=(const FWizardJamTestWorld&) = delete;
+
+    UWorld* Get() const { return World; }
+
+    template<typename ActorType>
+    ActorType* Spawn(const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        return World->SpawnActor<ActorType>(ActorType::StaticClass(), Location, Rotation, SpawnParams);
+    }
+
+    void Tick(float DeltaSeconds)
+    {
+        World->Tick(LEVELTICK_All, DeltaSeconds);
+        ++GFrameCounter;
+    }
+
+private:
+    UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
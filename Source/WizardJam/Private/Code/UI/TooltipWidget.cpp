@@ -4,9 +4,10 @@
 // Date: December 31, 2025
 
 #include "Code/UI/TooltipWidget.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Components/TextBlock.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogTooltipWidget, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogTooltipWidget, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 void UTooltipWidget::NativeConstruct()
 {
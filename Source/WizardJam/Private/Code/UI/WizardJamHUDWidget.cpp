@@ -9,9 +9,12 @@
 //
 // Key Implementation Details:
 // - InitializeSpellSlotSystem() builds TMap lookups from designer's config array
-// - FindSpellSlotWidget() searches SpellSlotContainer for "SpellSlot_X" by name
+// - ResolveSpellSlotWidgets() parses "SpellSlot_X" names once into a fixed
+//   slot table; runtime updates index that table, never search by name
 // - UpdateSpellSlotVisual() swaps textures using FSpellSlotConfig helper functions
 // - Quidditch widget created dynamically if QuidditchWidgetClass is set
+// - Handlers only fill ViewModel; ApplyViewModel() writes widgets once per
+//   frame and skips writes that would not change what is displayed
 //
 // Modular Design Benefits:
 // - Designer adds new spells by editing SpellSlotConfigs array (no C++ changes)
@@ -20,6 +23,8 @@
 // ============================================================================
 
 #include "Code/UI/WizardJamHUDWidget.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
 #include "Code/UI/WizardJamQuidditchWidget.h"
 #include "Code/GameMode/WizardJamGameMode.h"
 #include "Code/Utility/AC_HealthComponent.h"
@@ -30,21 +35,78 @@
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/PanelWidget.h"
+#include "Components/InvalidationBox.h"
+#include "Components/RetainerBox.h"
 #include "Blueprint/WidgetTree.h"
 #include "GameFramework/Actor.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogWizardJamHUD, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogWizardJamHUD, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("HUD Apply View Model"), STAT_WizardJam_HUDApplyViewModel, STATGROUP_WizardJam);
+
+namespace
+{
+    // Bar changes smaller than this are not visible - skip the write
+    constexpr float BarPercentTolerance = 0.001f;
+
+    // Health bar color bands (0 = healthy, 1 = hurt, 2 = critical)
+    int32 GetHealthBand(float HealthPercent)
+    {
+        if (HealthPercent <= 0.3f)
+        {
+            return 2;
+        }
+        return HealthPercent <= 0.6f ? 1 : 0;
+    }
+}
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+UWizardJamHUDWidget::UWizardJamHUDWidget(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , bShowQuidditchOnStart(false)
+    , StatTextUpdateInterval(0.1f)
+    , OwnerActor(nullptr)
+    , HealthComp(nullptr)
+    , StaminaComp(nullptr)
+    , SpellCollectionComp(nullptr)
+    , BroomComp(nullptr)
+    , AppliedHealthPercent(-1.0f)
+    , AppliedStaminaPercent(-1.0f)
+    , AppliedHealthBand(INDEX_NONE)
+    , AppliedHealthText(INDEX_NONE, INDEX_NONE)
+    , AppliedStaminaText(INDEX_NONE, INDEX_NONE)
+    , NextHealthTextTime(0.0)
+    , NextStaminaTextTime(0.0)
+    , QuidditchWidget(nullptr)
+    , PerfOverlayWidget(nullptr)
+{
+}
 
 // ============================================================================
 // LIFECYCLE
 // ============================================================================
 
+void UWizardJamHUDWidget::NativeOnInitialized()
+{
+    Super::NativeOnInitialized();
+
+    // Tree edits must land before TakeWidget builds the Slate hierarchy
+    WrapMissingInvalidationPanels();
+}
+
 void UWizardJamHUDWidget::NativeConstruct()
 {
     Super::NativeConstruct();
 
     UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] NativeConstruct called"));
 
+    // Widget may be re-constructed after being removed - start from scratch
+    ViewModel.Reset();
+    ResetAppliedState();
+
     // Cache owner actor
     OwnerActor = GetOwningPlayerPawn();
     if (!OwnerActor)
@@ -53,6 +115,9 @@ void UWizardJamHUDWidget::NativeConstruct()
         return;
     }
 
+    // Cache static panels so only changing widgets repaint
+    ConfigureInvalidationPanels();
+
     // Initialize modular spell slot system
     InitializeSpellSlotSystem();
 
@@ -72,13 +137,285 @@ void UWizardJamHUDWidget::NativeDestruct()
 {
     UnbindComponentDelegates();
 
-    // Clear runtime maps
-    SpellSlotWidgets.Empty();
-    SpellConfigLookup.Empty();
+    // Clear runtime slot table
+    SlotWidgets.Empty();
+    SlotConfigIndices.Empty();
+    SlotRowBySpell.Empty();
+
+    if (PerfOverlayWidget)
+    {
+        PerfOverlayWidget->RemoveFromParent();
+        PerfOverlayWidget = nullptr;
+    }
 
     Super::NativeDestruct();
 }
 
+void UWizardJamHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // Components only broadcast at segment boundaries, so bars are evaluated
+    // here while a rate is active - idle bars cost nothing
+    if (StaminaComp && !FMath::IsNearlyZero(StaminaComp->GetStaminaRate()))
+    {
+        HandleStaminaChanged(OwnerActor, StaminaComp->GetCurrentStamina(), 0.0f);
+    }
+
+    if (HealthComp && !FMath::IsNearlyZero(HealthComp->GetHealthRegenRate()))
+    {
+        HandleHealthChanged(OwnerActor, HealthComp->GetCurrentHealth(), 0.0f);
+    }
+
+    // Everything broadcast since last frame lands in one pass
+    ApplyViewModel();
+}
+
+// ============================================================================
+// VIEW MODEL APPLICATION
+// ============================================================================
+
+void UWizardJamHUDWidget::ResetAppliedState()
+{
+    AppliedHealthPercent = -1.0f;
+    AppliedStaminaPercent = -1.0f;
+    AppliedHealthBand = INDEX_NONE;
+    AppliedHealthText = FIntPoint(INDEX_NONE, INDEX_NONE);
+    AppliedStaminaText = FIntPoint(INDEX_NONE, INDEX_NONE);
+    NextHealthTextTime = 0.0;
+    NextStaminaTextTime = 0.0;
+}
+
+void UWizardJamHUDWidget::ApplyViewModel()
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_HUDApplyViewModel);
+
+    if (!ViewModel.HasAnyDirty())
+    {
+        return;
+    }
+
+    const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+    if (ViewModel.IsDirty(EHUDDirtyField::Health) && ApplyHealth(Now))
+    {
+        ViewModel.ClearDirty(EHUDDirtyField::Health);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::Stamina) && ApplyStamina(Now))
+    {
+        ViewModel.ClearDirty(EHUDDirtyField::Stamina);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::StaminaColor))
+    {
+        if (StaminaProgressBar)
+        {
+            StaminaProgressBar->SetFillColorAndOpacity(ViewModel.StaminaColor);
+        }
+        ViewModel.ClearDirty(EHUDDirtyField::StaminaColor);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::Flight))
+    {
+        if (BroomIcon)
+        {
+            BroomIcon->SetVisibility(ViewModel.bFlying ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
+        }
+        ViewModel.ClearDirty(EHUDDirtyField::Flight);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::Boost))
+    {
+        if (BoostIndicatorImage)
+        {
+            BoostIndicatorImage->SetVisibility(ViewModel.bBoosting ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
+        }
+        ViewModel.ClearDirty(EHUDDirtyField::Boost);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::SpellSlots))
+    {
+        ApplySpellSlots();
+        ViewModel.ClearDirty(EHUDDirtyField::SpellSlots);
+    }
+
+    if (ViewModel.IsDirty(EHUDDirtyField::SpellCount))
+    {
+        UpdateSpellCountText();
+        ViewModel.ClearDirty(EHUDDirtyField::SpellCount);
+    }
+}
+
+bool UWizardJamHUDWidget::ApplyHealth(double Now)
+{
+    const float MaxHealth = ViewModel.MaxHealth;
+    if (MaxHealth <= 0.0f)
+    {
+        return true;
+    }
+
+    const float HealthPercent = ViewModel.Health / MaxHealth;
+
+    if (HealthProgressBar && !FMath::IsNearlyEqual(HealthPercent, AppliedHealthPercent, BarPercentTolerance))
+    {
+        HealthProgressBar->SetPercent(HealthPercent);
+        AppliedHealthPercent = HealthPercent;
+
+        // Color based on health level - only rewritten when the band changes
+        const int32 HealthBand = GetHealthBand(HealthPercent);
+        if (HealthBand != AppliedHealthBand)
+        {
+            static const FLinearColor BandColors[] = { FLinearColor::Green, FLinearColor::Yellow, FLinearColor::Red };
+            HealthProgressBar->SetFillColorAndOpacity(BandColors[HealthBand]);
+            AppliedHealthBand = HealthBand;
+        }
+    }
+
+    if (!HealthText)
+    {
+        return true;
+    }
+
+    // Text shows whole numbers - fractional changes never reach Slate
+    const FIntPoint Shown(FMath::RoundToInt(ViewModel.Health), FMath::RoundToInt(MaxHealth));
+    if (Shown == AppliedHealthText)
+    {
+        return true;
+    }
+    if (Now < NextHealthTextTime)
+    {
+        return false;
+    }
+
+    HealthText->SetText(FText::FromString(FString::Printf(TEXT("%d / %d"), Shown.X, Shown.Y)));
+    AppliedHealthText = Shown;
+    NextHealthTextTime = Now + StatTextUpdateInterval;
+    return true;
+}
+
+bool UWizardJamHUDWidget::ApplyStamina(double Now)
+{
+    const float MaxStamina = ViewModel.MaxStamina;
+    if (MaxStamina <= 0.0f)
+    {
+        return true;
+    }
+
+    const float StaminaPercent = ViewModel.Stamina / MaxStamina;
+
+    if (StaminaProgressBar && !FMath::IsNearlyEqual(StaminaPercent, AppliedStaminaPercent, BarPercentTolerance))
+    {
+        StaminaProgressBar->SetPercent(StaminaPercent);
+        AppliedStaminaPercent = StaminaPercent;
+    }
+
+    if (!StaminaText)
+    {
+        return true;
+    }
+
+    const FIntPoint Shown(FMath::RoundToInt(ViewModel.Stamina), FMath::RoundToInt(MaxStamina));
+    if (Shown == AppliedStaminaText)
+    {
+        return true;
+    }
+    if (Now < NextStaminaTextTime)
+    {
+        return false;
+    }
+
+    StaminaText->SetText(FText::FromString(FString::Printf(TEXT("%d / %d"), Shown.X, Shown.Y)));
+    AppliedStaminaText = Shown;
+    NextStaminaTextTime = Now + StatTextUpdateInterval;
+    return true;
+}
+
+void UWizardJamHUDWidget::ApplySpellSlots()
+{
+    for (const FName& SpellTypeName : ViewModel.DirtySpellSlots)
+    {
+        const int32* Row = SlotRowBySpell.Find(SpellTypeName);
+        const bool* bUnlocked = ViewModel.SpellUnlocked.Find(SpellTypeName);
+        if (Row && bUnlocked)
+        {
+            UpdateSpellSlotVisual(*Row, *bUnlocked);
+        }
+    }
+    ViewModel.DirtySpellSlots.Reset();
+
+    // Slot images sit under the cached panel - one invalidation per pass
+    if (SpellSlotInvalidationBox)
+    {
+        SpellSlotInvalidationBox->InvalidateCache();
+    }
+}
+
+void UWizardJamHUDWidget::WrapMissingInvalidationPanels()
+{
+    if (IsDesignTime() || !WidgetTree)
+    {
+        return;
+    }
+
+    // Slot images: swap the container for a box in its own slot, so the
+    // designer's anchors and padding carry over, then nest the container
+    if (!SpellSlotInvalidationBox && SpellSlotContainer && SpellSlotContainer->GetParent())
+    {
+        UPanelWidget* Parent = SpellSlotContainer->GetParent();
+        UInvalidationBox* Box = WidgetTree->ConstructWidget<UInvalidationBox>(
+            UInvalidationBox::StaticClass(), TEXT("SpellSlotInvalidationBox"));
+
+        if (Parent->ReplaceChild(SpellSlotContainer, Box))
+        {
+            Box->SetContent(SpellSlotContainer);
+            SpellSlotInvalidationBox = Box;
+        }
+    }
+
+    // Static layout: the whole tree goes under one box. Invalidation panels
+    // repaint only the widgets that invalidated, so moving bars repaint alone
+    // and the frame, labels and icons replay from the cache
+    if (!StaticLayoutInvalidationBox && !StaticLayoutRetainer && WidgetTree->RootWidget)
+    {
+        UWidget* OldRoot = WidgetTree->RootWidget;
+        UInvalidationBox* Box = WidgetTree->ConstructWidget<UInvalidationBox>(
+            UInvalidationBox::StaticClass(), TEXT("StaticLayoutInvalidationBox"));
+
+        WidgetTree->RootWidget = Box;
+        Box->SetContent(OldRoot);
+        StaticLayoutInvalidationBox = Box;
+    }
+}
+
+void UWizardJamHUDWidget::ConfigureInvalidationPanels()
+{
+    // Static frame, labels and slot images only change on spell or layout
+    // events; caching them leaves the per-frame bars as the only repaint
+    if (StaticLayoutInvalidationBox)
+    {
+        StaticLayoutInvalidationBox->SetCanCache(true);
+    }
+
+    if (SpellSlotInvalidationBox)
+    {
+        SpellSlotInvalidationBox->SetCanCache(true);
+    }
+
+    // Retained layers render to a texture and are only redrawn when their
+    // content invalidates (set "Render on Invalidation" in the designer)
+    if (StaticLayoutRetainer)
+    {
+        StaticLayoutRetainer->SetRetainRendering(true);
+    }
+
+    UE_LOG(LogWizardJamHUD, Display,
+        TEXT("[WizardJamHUD] Cached panels | StaticLayout: %s | SpellSlots: %s | Retainer: %s"),
+        StaticLayoutInvalidationBox ? TEXT("YES") : TEXT("NO"),
+        SpellSlotInvalidationBox ? TEXT("YES") : TEXT("NO"),
+        StaticLayoutRetainer ? TEXT("YES") : TEXT("NO"));
+}
+
 // ============================================================================
 // SPELL SLOT SYSTEM INITIALIZATION
 // ============================================================================
@@ -86,8 +423,9 @@ void UWizardJamHUDWidget::NativeDestruct()
 void UWizardJamHUDWidget::InitializeSpellSlotSystem()
 {
     // Clear previous state
-    SpellSlotWidgets.Empty();
-    SpellConfigLookup.Empty();
+    SlotWidgets.Reset();
+    SlotConfigIndices.Reset();
+    SlotRowBySpell.Reset();
 
     // Validate config array
     if (SpellSlotConfigs.Num() == 0)
@@ -97,9 +435,17 @@ void UWizardJamHUDWidget::InitializeSpellSlotSystem()
         return;
     }
 
-    // Build lookup map and find widgets for each configured spell
-    for (const FSpellSlotConfig& Config : SpellSlotConfigs)
+    // One pass over the container resolves every SpellSlot_X widget
+    TMap<int32, UImage*> WidgetsBySlotIndex;
+    ResolveSpellSlotWidgets(WidgetsBySlotIndex);
+
+    int32 WidgetsFound = 0;
+
+    // Build the fixed slot table - one row per valid config
+    for (int32 ConfigIndex = 0; ConfigIndex < SpellSlotConfigs.Num(); ++ConfigIndex)
     {
+        const FSpellSlotConfig& Config = SpellSlotConfigs[ConfigIndex];
+
         // Skip invalid entries
         if (!Config.IsValid())
         {
@@ -108,18 +454,18 @@ void UWizardJamHUDWidget::InitializeSpellSlotSystem()
             continue;
         }
 
-        // Add to lookup map for fast access during gameplay
-        SpellConfigLookup.Add(Config.SpellTypeName, Config);
+        UImage* SlotWidget = WidgetsBySlotIndex.FindRef(Config.SlotIndex);
+
+        const int32 Row = SlotWidgets.Add(SlotWidget);
+        SlotConfigIndices.Add(ConfigIndex);
+        SlotRowBySpell.Add(Config.SpellTypeName, Row);
 
-        // Find the widget for this slot index
-        UImage* SlotWidget = FindSpellSlotWidget(Config.SlotIndex);
         if (SlotWidget)
         {
-            // Map spell name to widget
-            SpellSlotWidgets.Add(Config.SpellTypeName, SlotWidget);
+            ++WidgetsFound;
 
-            // Initialize to locked state
-            UpdateSpellSlotVisual(Config.SpellTypeName, false);
+            // Initialize to locked state (applied on the next frame)
+            ViewModel.SetSpellUnlocked(Config.SpellTypeName, false);
 
             UE_LOG(LogWizardJamHUD, Display,
                 TEXT("[WizardJamHUD] Spell slot configured: '%s' -> SpellSlot_%d"),
@@ -135,82 +481,91 @@ void UWizardJamHUDWidget::InitializeSpellSlotSystem()
 
     UE_LOG(LogWizardJamHUD, Display,
         TEXT("[WizardJamHUD] Spell slot system initialized | Configs: %d | Widgets found: %d"),
-        SpellSlotConfigs.Num(), SpellSlotWidgets.Num());
+        SpellSlotConfigs.Num(), WidgetsFound);
 }
 
-UImage* UWizardJamHUDWidget::FindSpellSlotWidget(int32 SlotIndex)
+void UWizardJamHUDWidget::ResolveSpellSlotWidgets(TMap<int32, UImage*>& OutWidgetsBySlotIndex) const
 {
-    // Build expected widget name: "SpellSlot_X"
-    FString WidgetName = FString::Printf(TEXT("SpellSlot_%d"), SlotIndex);
+    static const FString SlotPrefix = TEXT("SpellSlot_");
 
-    // First try: Search in SpellSlotContainer if it exists
+    // First try: parse every "SpellSlot_X" child of the container in one pass
     if (SpellSlotContainer)
     {
-        // Get all children of the container
-        TArray<UWidget*> Children = SpellSlotContainer->GetAllChildren();
-
-        for (UWidget* Child : Children)
+        const int32 ChildCount = SpellSlotContainer->GetChildrenCount();
+        for (int32 ChildIndex = 0; ChildIndex < ChildCount; ++ChildIndex)
         {
-            if (Child && Child->GetName() == WidgetName)
+            UImage* ImageWidget = Cast<UImage>(SpellSlotContainer->GetChildAt(ChildIndex));
+            if (!ImageWidget)
             {
-                UImage* ImageWidget = Cast<UImage>(Child);
-                if (ImageWidget)
-                {
-                    return ImageWidget;
-                }
+                continue;
+            }
+
+            const FString ChildName = ImageWidget->GetName();
+            if (!ChildName.StartsWith(SlotPrefix))
+            {
+                continue;
+            }
+
+            const FString IndexString = ChildName.RightChop(SlotPrefix.Len());
+            if (IndexString.IsNumeric())
+            {
+                OutWidgetsBySlotIndex.Add(FCString::Atoi(*IndexString), ImageWidget);
             }
         }
     }
 
-    // Second try: Search entire widget tree
+    // Second try: slots placed outside the container - search the widget tree
+    // only for configured indices the container did not provide
     if (WidgetTree)
     {
-        UWidget* FoundWidget = WidgetTree->FindWidget(FName(*WidgetName));
-        if (FoundWidget)
+        for (const FSpellSlotConfig& Config : SpellSlotConfigs)
         {
-            return Cast<UImage>(FoundWidget);
+            if (!Config.IsValid() || OutWidgetsBySlotIndex.Contains(Config.SlotIndex))
+            {
+                continue;
+            }
+
+            const FName WidgetName(*FString::Printf(TEXT("SpellSlot_%d"), Config.SlotIndex));
+            if (UImage* FoundWidget = Cast<UImage>(WidgetTree->FindWidget(WidgetName)))
+            {
+                OutWidgetsBySlotIndex.Add(Config.SlotIndex, FoundWidget);
+            }
         }
     }
-
-    return nullptr;
 }
 
-void UWizardJamHUDWidget::UpdateSpellSlotVisual(FName SpellTypeName, bool bIsUnlocked)
+void UWizardJamHUDWidget::UpdateSpellSlotVisual(int32 Row, bool bIsUnlocked)
 {
-    // Find the widget for this spell
-    UImage** FoundWidget = SpellSlotWidgets.Find(SpellTypeName);
-    if (!FoundWidget || !(*FoundWidget))
+    if (!SlotWidgets.IsValidIndex(Row))
     {
-        UE_LOG(LogWizardJamHUD, Warning,
-            TEXT("[WizardJamHUD] No widget mapped for spell '%s'"), *SpellTypeName.ToString());
         return;
     }
 
-    // Find the config for this spell
-    FSpellSlotConfig* Config = SpellConfigLookup.Find(SpellTypeName);
-    if (!Config)
+    const FSpellSlotConfig& Config = SpellSlotConfigs[SlotConfigIndices[Row]];
+
+    // Find the widget for this spell
+    UImage* SlotWidget = SlotWidgets[Row];
+    if (!SlotWidget)
     {
         UE_LOG(LogWizardJamHUD, Warning,
-            TEXT("[WizardJamHUD] No config found for spell '%s'"), *SpellTypeName.ToString());
+            TEXT("[WizardJamHUD] No widget mapped for spell '%s'"), *Config.SpellTypeName.ToString());
         return;
     }
 
-    UImage* SlotWidget = *FoundWidget;
-
     // Get appropriate texture using config helper
-    UTexture2D* TargetTexture = Config->GetIcon(bIsUnlocked);
+    UTexture2D* TargetTexture = Config.GetIcon(bIsUnlocked);
     if (TargetTexture)
     {
         SlotWidget->SetBrushFromTexture(TargetTexture);
     }
 
     // Apply color tint using config helper
-    FLinearColor TintColor = Config->GetColor(bIsUnlocked);
+    FLinearColor TintColor = Config.GetColor(bIsUnlocked);
     SlotWidget->SetColorAndOpacity(TintColor);
 
-    UE_LOG(LogWizardJamHUD, Display,
+    UE_LOG(LogWizardJamHUD, Verbose,
         TEXT("[WizardJamHUD] Spell slot updated: '%s' -> %s"),
-        *SpellTypeName.ToString(), bIsUnlocked ? TEXT("UNLOCKED") : TEXT("LOCKED"));
+        *Config.SpellTypeName.ToString(), bIsUnlocked ? TEXT("UNLOCKED") : TEXT("LOCKED"));
 }
 
 void UWizardJamHUDWidget::UpdateSpellCountText()
@@ -220,12 +575,8 @@ void UWizardJamHUDWidget::UpdateSpellCountText()
         return;
     }
 
-    // Get collected count from component
-    int32 CollectedCount = 0;
-    if (SpellCollectionComp)
-    {
-        CollectedCount = SpellCollectionComp->GetAllChannels().Num();
-    }
+    // Collected count comes from the view model (set by channel events)
+    const int32 CollectedCount = ViewModel.CollectedSpellCount;
 
     // Total possible = number of configured spell slots
     int32 TotalCount = SpellSlotConfigs.Num();
@@ -234,7 +585,7 @@ void UWizardJamHUDWidget::UpdateSpellCountText()
     FString CountString = FString::Printf(TEXT("%d / %d"), CollectedCount, TotalCount);
     SpellCountText->SetText(FText::FromString(CountString));
 
-    UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] Spell count updated: %s"), *CountString);
+    UE_LOG(LogWizardJamHUD, Verbose, TEXT("[WizardJamHUD] Spell count updated: %s"), *CountString);
 }
 
 void UWizardJamHUDWidget::RefreshAllSpellSlots()
@@ -246,21 +597,22 @@ void UWizardJamHUDWidget::RefreshAllSpellSlots()
         return;
     }
 
-    // Get currently collected channels from component
-    TArray<FName> CollectedSpells = SpellCollectionComp->GetAllChannels();
-
     // Update each configured slot based on collection state
-    for (const auto& ConfigPair : SpellConfigLookup)
+    for (const TPair<FName, int32>& SlotPair : SlotRowBySpell)
     {
-        FName SpellName = ConfigPair.Key;
-        bool bIsCollected = CollectedSpells.Contains(SpellName);
-        UpdateSpellSlotVisual(SpellName, bIsCollected);
+        ViewModel.SetSpellUnlocked(SlotPair.Key, SpellCollectionComp->HasChannel(SlotPair.Key));
+
+        // Widgets may have been swapped (save load) - rewrite even unchanged slots
+        ViewModel.DirtySpellSlots.Add(SlotPair.Key);
     }
+
     // Update spell count text display
-    UpdateSpellCountText();
+    const int32 CollectedCount = SpellCollectionComp->GetChannelCount();
+    ViewModel.SetCollectedSpellCount(CollectedCount);
+    ViewModel.MarkDirty(EHUDDirtyField::SpellSlots | EHUDDirtyField::SpellCount);
 
     UE_LOG(LogWizardJamHUD, Display,
-        TEXT("[WizardJamHUD] Refreshed all spell slots | Collected: %d"), CollectedSpells.Num());
+        TEXT("[WizardJamHUD] Refreshed all spell slots | Collected: %d"), CollectedCount);
 }
 
 // ============================================================================
@@ -329,6 +681,52 @@ bool UWizardJamHUDWidget::IsQuidditchUIVisible() const
     return false;
 }
 
+// ============================================================================
+// PERF OVERLAY
+// ============================================================================
+
+void UWizardJamHUDWidget::TogglePerfOverlay()
+{
+#if WIZARDJAM_COUNTERS_ENABLED
+    if (!PerfOverlayWidget)
+    {
+        if (!PerfOverlayWidgetClass)
+        {
+            UE_LOG(LogWizardJamHUD, Warning,
+                TEXT("[WizardJamHUD] No PerfOverlayWidgetClass set - perf overlay disabled"));
+            return;
+        }
+
+        // Created on first use so the overlay costs nothing until asked for
+        PerfOverlayWidget = CreateWidget<UWizardJamPerfOverlayWidget>(GetOwningPlayer(), PerfOverlayWidgetClass);
+        if (!PerfOverlayWidget)
+        {
+            UE_LOG(LogWizardJamHUD, Error,
+                TEXT("[WizardJamHUD] Failed to create perf overlay widget!"));
+            return;
+        }
+
+        PerfOverlayWidget->AddToViewport(10);
+        PerfOverlayWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
+        UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] Perf overlay created and VISIBLE"));
+        return;
+    }
+
+    const bool bShow = !IsPerfOverlayVisible();
+    PerfOverlayWidget->SetVisibility(bShow ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+    UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] Perf overlay %s"), bShow ? TEXT("shown") : TEXT("hidden"));
+#endif
+}
+
+bool UWizardJamHUDWidget::IsPerfOverlayVisible() const
+{
+    if (PerfOverlayWidget)
+    {
+        return PerfOverlayWidget->GetVisibility() != ESlateVisibility::Collapsed;
+    }
+    return false;
+}
+
 // ============================================================================
 // COMPONENT CACHING
 // ============================================================================
@@ -457,45 +855,23 @@ void UWizardJamHUDWidget::BindBroomComponentDelegates()
 
     HandleFlightStateChanged(BroomComp->IsFlying());
 
+    // Default view-model value matches "not flying" - force the initial write
+    ViewModel.MarkDirty(EHUDDirtyField::Flight);
+
     UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] Broom delegates bound | Flying: %s"),
         BroomComp->IsFlying() ? TEXT("YES") : TEXT("NO"));
 }
 
 // ============================================================================
 // HEALTH HANDLERS
+// Handlers only record values - ApplyViewModel() writes the widgets
 // ============================================================================
 
 void UWizardJamHUDWidget::HandleHealthChanged(AActor* Owner, float NewHealth, float Delta)
 {
     if (!HealthComp) return;
 
-    float MaxHealth = HealthComp->GetMaxHealth();
-    if (MaxHealth <= 0.0f) return;
-
-    float HealthPercent = NewHealth / MaxHealth;
-
-    if (HealthProgressBar)
-    {
-        HealthProgressBar->SetPercent(HealthPercent);
-
-        // Color based on health level
-        FLinearColor HealthColor = FLinearColor::Green;
-        if (HealthPercent <= 0.3f)
-        {
-            HealthColor = FLinearColor::Red;
-        }
-        else if (HealthPercent <= 0.6f)
-        {
-            HealthColor = FLinearColor::Yellow;
-        }
-        HealthProgressBar->SetFillColorAndOpacity(HealthColor);
-    }
-
-    if (HealthText)
-    {
-        HealthText->SetText(FText::FromString(
-            FString::Printf(TEXT("%.0f / %.0f"), NewHealth, MaxHealth)));
-    }
+    ViewModel.SetHealth(NewHealth, HealthComp->GetMaxHealth());
 }
 
 // ============================================================================
@@ -506,21 +882,7 @@ void UWizardJamHUDWidget::HandleStaminaChanged(AActor* Owner, float NewStamina,
 {
     if (!StaminaComp) return;
 
-    float MaxStamina = StaminaComp->GetMaxStamina();
-    if (MaxStamina <= 0.0f) return;
-
-    float StaminaPercent = NewStamina / MaxStamina;
-
-    if (StaminaProgressBar)
-    {
-        StaminaProgressBar->SetPercent(StaminaPercent);
-    }
-
-    if (StaminaText)
-    {
-        StaminaText->SetText(FText::FromString(
-            FString::Printf(TEXT("%.0f / %.0f"), NewStamina, MaxStamina)));
-    }
+    ViewModel.SetStamina(NewStamina, StaminaComp->GetMaxStamina());
 }
 
 // ============================================================================
@@ -532,7 +894,12 @@ void UWizardJamHUDWidget::HandleChannelAdded(FName ChannelName)
     UE_LOG(LogWizardJamHUD, Display, TEXT("[WizardJamHUD] Channel added: %s"), *ChannelName.ToString());
 
     // Update the spell slot visual to unlocked state
-    UpdateSpellSlotVisual(ChannelName, true);
+    ViewModel.SetSpellUnlocked(ChannelName, true);
+
+    if (SpellCollectionComp)
+    {
+        ViewModel.SetCollectedSpellCount(SpellCollectionComp->GetChannelCount());
+    }
 }
 
 // ============================================================================
@@ -541,10 +908,7 @@ void UWizardJamHUDWidget::HandleChannelAdded(FName ChannelName)
 
 void UWizardJamHUDWidget::HandleFlightStateChanged(bool bIsFlying)
 {
-    if (BroomIcon)
-    {
-        BroomIcon->SetVisibility(bIsFlying ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
-    }
+    ViewModel.SetFlying(bIsFlying);
 
     UE_LOG(LogWizardJamHUD, Log, TEXT("[WizardJamHUD] Flight state: %s"),
         bIsFlying ? TEXT("FLYING") : TEXT("GROUNDED"));
@@ -552,10 +916,7 @@ void UWizardJamHUDWidget::HandleFlightStateChanged(bool bIsFlying)
 
 void UWizardJamHUDWidget::HandleStaminaColorChange(FLinearColor NewColor)
 {
-    if (StaminaProgressBar)
-    {
-        StaminaProgressBar->SetFillColorAndOpacity(NewColor);
-    }
+    ViewModel.SetStaminaColor(NewColor);
 }
 
 void UWizardJamHUDWidget::HandleForcedDismount()
@@ -588,10 +949,7 @@ void UWizardJamHUDWidget::HandleForcedDismount()
 
 void UWizardJamHUDWidget::HandleBoostChange(bool bIsBoosting)
 {
-    if (BoostIndicatorImage)
-    {
-        BoostIndicatorImage->SetVisibility(bIsBoosting ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
-    }
+    ViewModel.SetBoosting(bIsBoosting);
 
     UE_LOG(LogWizardJamHUD, Log, TEXT("[WizardJamHUD] Boost: %s"),
         bIsBoosting ? TEXT("ON") : TEXT("OFF"));
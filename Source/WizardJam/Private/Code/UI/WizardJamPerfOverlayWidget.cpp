@@ -0,0 +1,126 @@
+// ============================================================================
+// WizardJamPerfOverlayWidget.cpp
+// Developer: Marcus Daley
+// Date: January 14, 2026
+// Project: WizardJam
+// ============================================================================
+// Purpose:
+// Implementation of the gameplay performance counter overlay.
+//
+// Key Implementation Details:
+// - Reads FWizardJamCounters directly; the stats subsystem rolls per-frame
+//   counters over, this widget only samples them
+// - Only ticks while visible (collapsed widgets are not ticked by Slate)
+// - Text is rebuilt every RefreshInterval, not every frame
+// ============================================================================
+
+#include "Code/UI/WizardJamPerfOverlayWidget.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Components/TextBlock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPerfOverlay, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+UWizardJamPerfOverlayWidget::UWizardJamPerfOverlayWidget(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , RefreshInterval(0.25f)
+    , TimeSinceRefresh(0.0f)
+{
+    FMemory::Memzero(PeakValues);
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+void UWizardJamPerfOverlayWidget::NativeConstruct()
+{
+    Super::NativeConstruct();
+
+    FMemory::Memzero(PeakValues);
+    TimeSinceRefresh = RefreshInterval;
+
+    UE_LOG(LogPerfOverlay, Display, TEXT("[PerfOverlay] Widget initialized"));
+}
+
+void UWizardJamPerfOverlayWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+#if WIZARDJAM_COUNTERS_ENABLED
+    SamplePeaks();
+
+    TimeSinceRefresh += InDeltaTime;
+    if (TimeSinceRefresh >= RefreshInterval)
+    {
+        TimeSinceRefresh = 0.0f;
+        RefreshText();
+        FMemory::Memzero(PeakValues);
+    }
+#endif
+}
+
+// ============================================================================
+// DISPLAY
+// ============================================================================
+
+void UWizardJamPerfOverlayWidget::SamplePeaks()
+{
+#if WIZARDJAM_COUNTERS_ENABLED
+    for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+    {
+        PeakValues[Index] = FMath::Max(PeakValues[Index], FWizardJamCounters::LastFrameValues[Index]);
+    }
+#endif
+}
+
+void UWizardJamPerfOverlayWidget::RefreshText()
+{
+#if WIZARDJAM_COUNTERS_ENABLED
+    auto Get = [](EWizardJamCounter Counter) { return FWizardJamCounters::Get(Counter); };
+    auto Peak = [this](EWizardJamCounter Counter) { return PeakValues[static_cast<int32>(Counter)]; };
+
+    // Per-frame counters read "last frame (peak in window)"
+    auto SetPerFrameText = [&](UTextBlock* TextBlock, const TCHAR* Label, EWizardJamCounter Counter)
+    {
+        if (TextBlock)
+        {
+            TextBlock->SetText(FText::FromString(FString::Printf(TEXT("%s: %d (peak %d)"),
+                Label, Get(Counter), Peak(Counter))));
+        }
+    };
+
+    if (LiveProjectilesText)
+    {
+        LiveProjectilesText->SetText(FText::FromString(FString::Printf(TEXT("Projectiles: %d"),
+            Get(EWizardJamCounter::LiveProjectiles))));
+    }
+
+    if (ProjectileSourceText)
+    {
+        ProjectileSourceText->SetText(FText::FromString(FString::Printf(TEXT("Pooled / Spawned: %d / %d"),
+            Get(EWizardJamCounter::ProjectilesPooled), Get(EWizardJamCounter::ProjectilesSpawned))));
+    }
+
+    if (AgentLODText)
+    {
+        AgentLODText->SetText(FText::FromString(FString::Printf(TEXT("Agents ticking N/M/F: %d / %d / %d"),
+            Get(EWizardJamCounter::AgentsTickingNear),
+            Get(EWizardJamCounter::AgentsTickingMid),
+            Get(EWizardJamCounter::AgentsTickingFar))));
+    }
+
+    SetPerFrameText(TracesText, TEXT("Traces/frame"), EWizardJamCounter::Traces);
+    SetPerFrameText(DamageEventsText, TEXT("Damage/frame"), EWizardJamCounter::DamageEvents);
+    SetPerFrameText(BroadcastsText, TEXT("Broadcasts/frame"), EWizardJamCounter::DelegateBroadcasts);
+
+    if (MIDsText)
+    {
+        MIDsText->SetText(FText::FromString(FString::Printf(TEXT("MIDs created: %d"),
+            Get(EWizardJamCounter::MIDsCreated))));
+    }
+#endif
+}
@@ -16,10 +16,11 @@
 // ============================================================================
 
 #include "Code/UI/WizardJamQuidditchWidget.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/GameMode/WizardJamGameMode.h"
 #include "Components/TextBlock.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogQuidditchWidget, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogQuidditchWidget, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // LIFECYCLE
@@ -16,14 +16,25 @@
 // ============================================================================
 
 #include "Code/Utility/AC_AimComponent.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Character.h"
 #include "GenericTeamAgentInterface.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Engine/World.h"
+#include "Stats/Stats.h"
 
 DEFINE_LOG_CATEGORY(LogAimComponent);
 
+// Game-thread cost of each aim mode - compare with "stat WizardJam".
+// Sync is the blocking line trace of an auto-update sample; async is
+// issue + consume (the trace itself runs during the physics scene's async
+// trace pass). Both samples trace the same ray with the same params.
+DECLARE_CYCLE_STAT(TEXT("Aim Trace Sync"), STAT_AimTraceSync, STATGROUP_WizardJam);
+DECLARE_CYCLE_STAT(TEXT("Aim Trace Async Issue"), STAT_AimTraceAsyncIssue, STATGROUP_WizardJam);
+DECLARE_CYCLE_STAT(TEXT("Aim Trace Async Consume"), STAT_AimTraceAsyncConsume, STATGROUP_WizardJam);
+
 // ============================================================================
 // CONSTRUCTOR
 // All values initialized in list per coding standards
@@ -37,9 +48,14 @@ UAC_AimComponent::UAC_AimComponent()
     , LocationUpdateThreshold(10.0f)
     , bAutoUpdateOnTick(false)
     , AutoUpdateInterval(0.05f)
+    , bEnableAimAssist(false)
+    , bUseAsyncTrace(false)
     , PreviousAimLocation(FVector::ZeroVector)
     , bAimIsBlocked(false)
     , AutoUpdateTimer(0.0f)
+    , AsyncTraceEnd(FVector::ZeroVector)
+    , AsyncTraceIssueFrame(0)
+    , LastSyncTraceFrame(0)
 {
     // Tick is disabled by default - only enabled if bAutoUpdateOnTick is true
     // This follows the Observer pattern: update on request, not continuously
@@ -72,8 +88,8 @@ void UAC_AimComponent::BeginPlay()
     {
         SetComponentTickEnabled(true);
         UE_LOG(LogAimComponent, Display,
-            TEXT("[%s] AimComponent auto-update ENABLED | Interval: %.3fs"),
-            *GetOwner()->GetName(), AutoUpdateInterval);
+            TEXT("[%s] AimComponent auto-update ENABLED | Interval: %.3fs | Trace: %s"),
+            *GetOwner()->GetName(), AutoUpdateInterval, bUseAsyncTrace ? TEXT("Async") : TEXT("Sync"));
     }
     else
     {
@@ -83,7 +99,7 @@ void UAC_AimComponent::BeginPlay()
     }
 
     // Perform initial trace to populate cache
-    PerformAimTrace(CachedAimData);
+    PerformAimTrace(CachedAimData, ECameraTraceStaleness::SameFrame);
     PreviousAimLocation = CachedAimData.AimLocation;
     PreviousTargetActor = CachedAimData.HitActor;
 }
@@ -99,12 +115,26 @@ void UAC_AimComponent::TickComponent(float DeltaTime, ELevelTick TickType,
         return;
     }
 
+    // Async results issued last frame are ready now
+    if (bUseAsyncTrace)
+    {
+        ConsumeAsyncAimTrace();
+    }
+
     // Accumulate time for interval-based updates
     AutoUpdateTimer += DeltaTime;
     if (AutoUpdateTimer >= AutoUpdateInterval)
     {
         AutoUpdateTimer = 0.0f;
-        RequestAimUpdate();
+
+        if (bUseAsyncTrace)
+        {
+            IssueAsyncAimTrace();
+        }
+        else
+        {
+            PerformSyncAimSample();
+        }
     }
 }
 
@@ -115,18 +145,31 @@ void UAC_AimComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 // broadcasts any changes via delegates.
 // ============================================================================
 
-FAimTraceData UAC_AimComponent::RequestAimUpdate()
+FAimTraceData UAC_AimComponent::RequestAimUpdate(ECameraTraceStaleness Staleness)
 {
     if (!GetOwner() || !GetWorld())
     {
         return CachedAimData;
     }
 
+    // Perform fresh raycast
+    FAimTraceData NewData;
+    PerformAimTrace(NewData, Staleness);
+
+    // Any async trace still in flight was aimed from an older view
+    LastSyncTraceFrame = GFrameCounter;
+
+    ApplyAimAssist(NewData);
+    ApplyAimData(NewData);
+
+    return CachedAimData;
+}
+
+void UAC_AimComponent::ApplyAimData(const FAimTraceData& NewData)
+{
     // Store old data for comparison
     FAimTraceData OldData = CachedAimData;
-
-    // Perform fresh raycast
-    PerformAimTrace(CachedAimData);
+    CachedAimData = NewData;
 
     // Check blocked state change
     bool bWasBlocked = bAimIsBlocked;
@@ -134,6 +177,7 @@ FAimTraceData UAC_AimComponent::RequestAimUpdate()
 
     if (bWasBlocked != bAimIsBlocked)
     {
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnAimBlocked.Broadcast(bAimIsBlocked);
 
         UE_LOG(LogAimComponent, Verbose,
@@ -145,8 +189,193 @@ FAimTraceData UAC_AimComponent::RequestAimUpdate()
 
     // Broadcast any changes
     BroadcastChanges(OldData, CachedAimData);
+}
 
-    return CachedAimData;
+// ============================================================================
+// AIM ASSIST
+// Raw trace result stays authoritative when it is already on a target or
+// the aim is blocked; otherwise the best registered target in the assist
+// cone (confirmed by one LOS trace) replaces the aim point.
+// ============================================================================
+
+void UAC_AimComponent::SetAimAssistEnabled(bool bEnabled)
+{
+    if (bEnableAimAssist == bEnabled)
+    {
+        return;
+    }
+
+    bEnableAimAssist = bEnabled;
+    AimAssistState = FAimAssistState();
+
+    UE_LOG(LogAimComponent, Display, TEXT("[%s] Aim assist %s"),
+        *GetNameSafe(GetOwner()), bEnabled ? TEXT("ENABLED") : TEXT("disabled"));
+}
+
+void UAC_AimComponent::ApplyAimAssist(FAimTraceData& InOutData)
+{
+    if (!bEnableAimAssist || !GetOwner() || !GetWorld())
+    {
+        return;
+    }
+
+    // Already on something worth aiming at, or face against a wall
+    const bool bOnTarget = InOutData.TraceResult == EAimTraceResult::Enemy
+        || InOutData.TraceResult == EAimTraceResult::Interactable;
+    const bool bBlocked = InOutData.bDidHit && InOutData.HitDistance < MinAimDistance;
+    if (bOnTarget || bBlocked)
+    {
+        return;
+    }
+
+    APlayerController* PC = GetOwnerController();
+    UCameraTraceSubsystem* CameraTraces = GetWorld()->GetSubsystem<UCameraTraceSubsystem>();
+    UAimAssistSubsystem* AimAssist = GetWorld()->GetSubsystem<UAimAssistSubsystem>();
+    if (!PC || !CameraTraces || !AimAssist)
+    {
+        return;
+    }
+
+    FVector ViewOrigin;
+    FVector ViewDirection;
+    if (!CameraTraces->GetCameraRay(PC, CrosshairScreenPosition, ECameraTraceStaleness::SameFrame, ViewOrigin, ViewDirection))
+    {
+        return;
+    }
+
+    FVector AssistPoint;
+    AActor* AssistTarget = AimAssist->FindAssistTarget(ViewOrigin, ViewDirection, GetOwner(), AimAssistState, AssistPoint);
+    if (!AssistTarget)
+    {
+        return;
+    }
+
+    InOutData.bDidHit = true;
+    InOutData.AimLocation = AssistPoint;
+    InOutData.HitActor = AssistTarget;
+    InOutData.HitDistance = FVector::Dist(ViewOrigin, AssistPoint);
+    InOutData.HitNormal = (ViewOrigin - AssistPoint).GetSafeNormal();
+    InOutData.PhysicalSurface = NAME_None;
+    InOutData.TraceResult = EAimTraceResult::AimAssist;
+    InOutData.AimDirection = (AssistPoint - GetOwner()->GetActorLocation()).GetSafeNormal();
+}
+
+// ============================================================================
+// ASYNC TRACE
+// Issued from tick, resolved by the physics scene during the frame, and
+// consumed on the next tick. Aim feedback lags one frame; firing still
+// forces a synchronous RequestAimUpdate for exact muzzle alignment.
+// ============================================================================
+
+void UAC_AimComponent::IssueAsyncAimTrace()
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_AimTraceAsyncIssue);
+
+    UWorld* World = GetWorld();
+    if (!World || !GetOwner())
+    {
+        return;
+    }
+
+    // One trace in flight at a time - the pending one lands next frame
+    if (AsyncTraceHandle.IsValid())
+    {
+        return;
+    }
+
+    FVector TraceStart;
+    BuildAimRay(ECameraTraceStaleness::SameFrame, TraceStart, AsyncTraceEnd);
+
+    WJ_COUNTER_INC(Traces);
+    AsyncTraceHandle = World->AsyncLineTraceByChannel(
+        EAsyncTraceType::Single,
+        TraceStart,
+        AsyncTraceEnd,
+        TraceChannel,
+        MakeAimQueryParams()
+    );
+    AsyncTraceIssueFrame = GFrameCounter;
+}
+
+void UAC_AimComponent::PerformSyncAimSample()
+{
+    UWorld* World = GetWorld();
+    if (!World || !GetOwner())
+    {
+        return;
+    }
+
+    // Mirrors IssueAsyncAimTrace: a fresh trace every interval, not the
+    // shared crosshair cache, so the sync stat times a real trace
+    FVector TraceStart;
+    FVector TraceEnd;
+    BuildAimRay(ECameraTraceStaleness::SameFrame, TraceStart, TraceEnd);
+
+    FHitResult HitResult;
+    bool bHit = false;
+    {
+        WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_AimTraceSync);
+
+        WJ_COUNTER_INC(Traces);
+        bHit = World->LineTraceSingleByChannel(
+            HitResult,
+            TraceStart,
+            TraceEnd,
+            TraceChannel,
+            MakeAimQueryParams()
+        );
+    }
+
+    FAimTraceData NewData;
+    NewData.Timestamp = World->GetTimeSeconds();
+    FillAimData(NewData, bHit, HitResult, TraceEnd);
+
+    LastSyncTraceFrame = GFrameCounter;
+
+    ApplyAimAssist(NewData);
+    ApplyAimData(NewData);
+}
+
+void UAC_AimComponent::ConsumeAsyncAimTrace()
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_AimTraceAsyncConsume);
+
+    UWorld* World = GetWorld();
+    if (!World || !AsyncTraceHandle.IsValid())
+    {
+        return;
+    }
+
+    // Results become readable the frame after the request
+    if (AsyncTraceIssueFrame >= GFrameCounter)
+    {
+        return;
+    }
+
+    FTraceDatum Datum;
+    const bool bReady = World->QueryTraceData(AsyncTraceHandle, Datum);
+    AsyncTraceHandle = FTraceHandle();
+
+    if (!bReady)
+    {
+        // Handle expired (hitch or world travel) - next interval issues again
+        return;
+    }
+
+    // A forced sync update (fire) since the request is fresher than this result
+    if (LastSyncTraceFrame >= AsyncTraceIssueFrame)
+    {
+        return;
+    }
+
+    const FHitResult* BlockingHit = FHitResult::GetFirstBlockingHit(Datum.OutHits);
+
+    FAimTraceData NewData;
+    NewData.Timestamp = World->GetTimeSeconds();
+    FillAimData(NewData, BlockingHit != nullptr, BlockingHit ? *BlockingHit : FHitResult(), AsyncTraceEnd);
+
+    ApplyAimAssist(NewData);
+    ApplyAimData(NewData);
 }
 
 // ============================================================================
@@ -157,12 +386,15 @@ FAimTraceData UAC_AimComponent::RequestAimUpdate()
 void UAC_AimComponent::BroadcastCurrentState()
 {
     // Broadcast target (even if nullptr)
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnAimTargetChanged.Broadcast(CachedAimData.HitActor, CachedAimData.TraceResult);
 
     // Broadcast location
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnAimLocationUpdated.Broadcast(CachedAimData.AimLocation, CachedAimData.AimDirection);
 
     // Broadcast blocked state
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnAimBlocked.Broadcast(bAimIsBlocked);
 
     UE_LOG(LogAimComponent, Verbose,
@@ -207,7 +439,7 @@ bool UAC_AimComponent::IsAimingAt(AActor* TestActor) const
 // RAYCAST IMPLEMENTATION
 // ============================================================================
 
-void UAC_AimComponent::PerformAimTrace(FAimTraceData& OutData) const
+void UAC_AimComponent::PerformAimTrace(FAimTraceData& OutData, ECameraTraceStaleness Staleness) const
 {
     // Initialize to defaults
     OutData = FAimTraceData();
@@ -218,78 +450,82 @@ void UAC_AimComponent::PerformAimTrace(FAimTraceData& OutData) const
         return;
     }
 
-    FVector TraceStart;
     FVector TraceEnd;
+    FHitResult HitResult;
+    bool bHit = false;
 
     // Try to get player controller for camera-based aiming
     APlayerController* PC = GetOwnerController();
+    UCameraTraceSubsystem* CameraTraces = GetWorld()->GetSubsystem<UCameraTraceSubsystem>();
 
-    if (PC)
+    if (PC && CameraTraces)
     {
         // CAMERA-BASED AIMING (Player characters)
-        // Raycast from camera through crosshair screen position
-
-        int32 ViewportX, ViewportY;
-        PC->GetViewportSize(ViewportX, ViewportY);
-
-        FVector2D ScreenPos;
-        ScreenPos.X = ViewportX * CrosshairScreenPosition.X;
-        ScreenPos.Y = ViewportY * CrosshairScreenPosition.Y;
-
-        FVector WorldLoc, WorldDir;
-        bool bDeprojected = PC->DeprojectScreenPositionToWorld(
-            ScreenPos.X, ScreenPos.Y, WorldLoc, WorldDir);
-
-        if (bDeprojected)
-        {
-            TraceStart = WorldLoc;
-            TraceEnd = WorldLoc + (WorldDir * MaxTraceDistance);
-        }
-        else
-        {
-            // Fallback: use camera location and forward
-            FVector CamLoc;
-            FRotator CamRot;
-            PC->GetPlayerViewPoint(CamLoc, CamRot);
-
-            TraceStart = CamLoc;
-            TraceEnd = CamLoc + (CamRot.Vector() * MaxTraceDistance);
-
-            UE_LOG(LogAimComponent, Warning,
-                TEXT("[%s] Deprojection failed, using camera forward"),
-                *GetOwner()->GetName());
-        }
+        // Shared crosshair trace - interaction and fire reuse the same ray
+        // and hit instead of each deprojecting and tracing on their own
+        FCameraTraceResult CameraResult;
+        CameraTraces->TraceFromCamera(PC, CrosshairScreenPosition, MaxTraceDistance,
+            TraceChannel, Staleness, CameraResult);
+
+        TraceEnd = CameraResult.TraceEnd;
+        bHit = CameraResult.bHit;
+        HitResult = CameraResult.Hit;
     }
     else
     {
         // NON-PLAYER AIMING (AI, Companions)
         // Use actor location and forward vector
+        FVector TraceStart;
+        BuildAimRay(Staleness, TraceStart, TraceEnd);
+
+        WJ_COUNTER_INC(Traces);
+        bHit = GetWorld()->LineTraceSingleByChannel(
+            HitResult,
+            TraceStart,
+            TraceEnd,
+            TraceChannel,
+            MakeAimQueryParams()
+        );
+    }
+
+    FillAimData(OutData, bHit, HitResult, TraceEnd);
+}
 
-        TraceStart = GetOwner()->GetActorLocation();
-        TraceEnd = TraceStart + (GetOwner()->GetActorForwardVector() * MaxTraceDistance);
+void UAC_AimComponent::BuildAimRay(ECameraTraceStaleness Staleness, FVector& OutStart, FVector& OutEnd) const
+{
+    APlayerController* PC = GetOwnerController();
+    UCameraTraceSubsystem* CameraTraces = GetWorld() ? GetWorld()->GetSubsystem<UCameraTraceSubsystem>() : nullptr;
+
+    FVector Direction;
+    if (PC && CameraTraces && CameraTraces->GetCameraRay(PC, CrosshairScreenPosition, Staleness, OutStart, Direction))
+    {
+        OutEnd = OutStart + (Direction * MaxTraceDistance);
+        return;
     }
 
+    OutStart = GetOwner()->GetActorLocation();
+    OutEnd = OutStart + (GetOwner()->GetActorForwardVector() * MaxTraceDistance);
+}
+
+FCollisionQueryParams UAC_AimComponent::MakeAimQueryParams() const
+{
     // Configure trace parameters
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(GetOwner());
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AimTrace), false, GetOwner());
     QueryParams.bReturnPhysicalMaterial = true;
-    QueryParams.bTraceComplex = false;
 
-    // Ignore attached actors (weapons, equipment, etc.)
-    TArray<AActor*> AttachedActors;
-    GetOwner()->GetAttachedActors(AttachedActors);
-    QueryParams.AddIgnoredActors(AttachedActors);
+    // Ignore attached actors (weapons, equipment, etc.) without building a temporary array
+    GetOwner()->ForEachAttachedActors([&QueryParams](AActor* Attached)
+    {
+        QueryParams.AddIgnoredActor(Attached);
+        return true;
+    });
 
-    // Perform line trace
-    FHitResult HitResult;
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        TraceStart,
-        TraceEnd,
-        TraceChannel,
-        QueryParams
-    );
+    return QueryParams;
+}
 
+void UAC_AimComponent::FillAimData(FAimTraceData& OutData, bool bHit, const FHitResult& HitResult,
+    const FVector& TraceEnd) const
+{
     // Populate output data
     if (bHit)
     {
@@ -377,6 +613,7 @@ void UAC_AimComponent::BroadcastChanges(const FAimTraceData& OldData, const FAim
     if (OldTarget != NewTarget)
     {
         PreviousTargetActor = NewTarget;
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnAimTargetChanged.Broadcast(NewTarget, NewData.TraceResult);
 
         UE_LOG(LogAimComponent, Verbose,
@@ -392,6 +629,7 @@ void UAC_AimComponent::BroadcastChanges(const FAimTraceData& OldData, const FAim
     if (LocationDelta > LocationUpdateThreshold)
     {
         PreviousAimLocation = NewData.AimLocation;
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnAimLocationUpdated.Broadcast(NewData.AimLocation, NewData.AimDirection);
 
         UE_LOG(LogAimComponent, Verbose,
@@ -1,5 +1,5 @@
 // AC_BroomComponent.cpp
-// Spawn-on-demand broom flight with full HUD integration
+// Persistent-visual broom flight with full HUD integration
 //
 // Developer: Marcus Daley
 // Date: January 1, 2026
@@ -9,17 +9,26 @@
 // - Broadcasts OnForcedDismount when stamina depletes
 // - Broadcasts OnBoostStateChanged when shift pressed
 // - Provides GetFlightStaminaPercent() for UI
+//
+// MOVEMENT & STAMINA:
+// Flight runs in UWizardJamMovementComponent's Broom custom mode. Input
+// handlers only set intents on the movement component; drain rate and
+// stamina exhaustion are evaluated inside the simulated move, which reports
+// forced dismount back through OnBroomStaminaExhausted. No tick needed here.
 
 #include "Code/Utility/AC_BroomComponent.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "Code/Utility/AC_StaminaComponent.h"
+#include "Code/Utility/WizardJamMovementComponent.h"
 #include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 DEFINE_LOG_CATEGORY(LogBroomComponent);
 
@@ -43,14 +52,14 @@ UAC_BroomComponent::UAC_BroomComponent()
     , MountSocketName(FName("MountSocket"))
     , bIsFlying(false)
     , bIsBoosting(false)
-    , CurrentVerticalVelocity(0.0f)
-    , SpawnedBroomVisual(nullptr)
+    , BroomVisual(nullptr)
     , StaminaComponent(nullptr)
     , MovementComponent(nullptr)
     , PlayerController(nullptr)
     , InputSubsystem(nullptr)
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // Flight physics run in the movement component - nothing to tick here
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 // ============================================================================
@@ -79,9 +88,6 @@ void UAC_BroomComponent::BeginPlay()
         return;
     }
 
-    // Bind to stamina changed event
-    StaminaComponent->OnStaminaChanged.AddDynamic(this, &UAC_BroomComponent::OnStaminaChanged);
-
     // Cache character movement component
     ACharacter* OwnerChar = Cast<ACharacter>(Owner);
     if (!OwnerChar)
@@ -92,15 +98,24 @@ void UAC_BroomComponent::BeginPlay()
         return;
     }
 
-    MovementComponent = OwnerChar->GetCharacterMovement();
+    MovementComponent = Cast<UWizardJamMovementComponent>(OwnerChar->GetCharacterMovement());
     if (!MovementComponent)
     {
         UE_LOG(LogBroomComponent, Error,
-            TEXT("[%s] Character has no CharacterMovementComponent!"),
+            TEXT("[%s] Character movement is not UWizardJamMovementComponent! Flight disabled."),
             *Owner->GetName());
         return;
     }
 
+    // Flight tuning stays on this component; movement simulates with it
+    MovementComponent->ConfigureBroomFlight(FlySpeed, BoostSpeed, VerticalSpeed,
+        StaminaDrainRate, BoostStaminaDrainRate, MinStaminaToFly);
+    StaminaExhaustedHandle = MovementComponent->OnBroomStaminaExhausted.AddUObject(
+        this, &UAC_BroomComponent::HandleStaminaExhausted);
+
+    // Kick off the broom class load now so the first mount never hitches
+    RequestBroomVisualClassLoad();
+
     // Cache player controller
     PlayerController = Cast<APlayerController>(OwnerChar->GetController());
     if (!PlayerController)
@@ -149,7 +164,7 @@ void UAC_BroomComponent::BeginPlay()
     }
 
     // Verify BroomVisualClass is set
-    if (!BroomVisualClass)
+    if (BroomVisualClass.IsNull())
     {
         UE_LOG(LogBroomComponent, Error,
             TEXT("[%s] ? BroomVisualClass is NULL! Set to BP_Broom_Combat in Blueprint!"),
@@ -159,7 +174,7 @@ void UAC_BroomComponent::BeginPlay()
     {
         UE_LOG(LogBroomComponent, Display,
             TEXT("[%s] ? BroomVisualClass set: %s"),
-            *Owner->GetName(), *BroomVisualClass->GetName());
+            *Owner->GetName(), *BroomVisualClass.ToString());
     }
 
     // Setup input bindings
@@ -178,28 +193,27 @@ void UAC_BroomComponent::BeginPlay()
         OwnerChar->GetMesh()->DoesSocketExist(MountSocketName) ? TEXT("FOUND") : TEXT("MISSING"));
 }
 
-void UAC_BroomComponent::TickComponent(float DeltaTime, ELevelTick TickType,
-    FActorComponentTickFunction* ThisTickFunction)
+void UAC_BroomComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    if (!bIsFlying)
+    if (BroomClassLoadHandle.IsValid())
     {
-        return;
+        BroomClassLoadHandle->CancelHandle();
+        BroomClassLoadHandle.Reset();
     }
 
-    // Drain stamina while flying
-    DrainStamina(DeltaTime);
+    if (MovementComponent)
+    {
+        MovementComponent->OnBroomStaminaExhausted.Remove(StaminaExhaustedHandle);
+    }
 
-    // Check stamina depletion
-    if (!HasSufficientStamina())
+    // Visual lives as long as its owner component
+    if (BroomVisual)
     {
-        ForceDismount();
-        return;
+        BroomVisual->Destroy();
+        BroomVisual = nullptr;
     }
 
-    // Apply vertical movement
-    ApplyVerticalMovement(DeltaTime);
+    Super::EndPlay(EndPlayReason);
 }
 
 // ============================================================================
@@ -213,19 +227,19 @@ void UAC_BroomComponent::SetFlightEnabled(bool bEnabled)
         return; // No change
     }
 
-    UE_LOG(LogBroomComponent, Warning,
-        TEXT("========== SetFlightEnabled(%s) START =========="),
-        bEnabled ? TEXT("TRUE") : TEXT("FALSE"));
-
     // Check stamina before enabling
     if (bEnabled && !HasSufficientStamina())
     {
-        UE_LOG(LogBroomComponent, Warning,
-            TEXT("  ? Insufficient stamina (need %.0f, have %.0f)"),
+        WJ_EVENT(FlightToggled, GetOwner(), 0.0f,
+            StaminaComponent ? StaminaComponent->GetCurrentStamina() : 0.0f, 1.0f);
+        UE_LOG(LogBroomComponent, Log,
+            TEXT("[%s] Flight denied - insufficient stamina (need %.0f, have %.0f)"),
+            *GetNameSafe(GetOwner()),
             MinStaminaToFly,
             StaminaComponent ? StaminaComponent->GetCurrentStamina() : 0.0f);
 
         // Broadcast red color for insufficient stamina
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnStaminaVisualUpdate.Broadcast(FLinearColor::Red);
         return;
     }
@@ -235,26 +249,37 @@ void UAC_BroomComponent::SetFlightEnabled(bool bEnabled)
 
     if (bEnabled)
     {
-        // 1. Spawn broom visual and attach to player
-        SpawnBroomVisual();
+        // 1. Show persistent broom visual
+        ShowBroomVisual();
 
-        // 2. Switch to flying movement mode
-        SetMovementMode(true);
+        // 2. Request broom movement mode (applied on the next predicted move)
+        if (MovementComponent)
+        {
+            MovementComponent->SetWantsBroomFlight(true);
+        }
 
         // 3. Add flight input context
         UpdateInputContext(true);
 
         // 4. Update UI - cyan color for flying
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnFlightStateChanged.Broadcast(true);
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnStaminaVisualUpdate.Broadcast(FLinearColor(0.0f, 1.0f, 1.0f)); // Cyan
     }
     else
     {
-        // 1. Destroy broom visual
-        DestroyBroomVisual();
+        // 1. Hide broom visual (kept attached for the next mount)
+        HideBroomVisual();
 
-        // 2. Return to walking mode
-        SetMovementMode(false);
+        // 2. Leave broom mode - movement falls and lands into walking
+        if (MovementComponent)
+        {
+            MovementComponent->SetWantsBroomFlight(false);
+            MovementComponent->SetWantsToAscend(false);
+            MovementComponent->SetWantsToDescend(false);
+            MovementComponent->SetWantsToBoost(false);
+        }
 
         // 3. Remove flight input context
         UpdateInputContext(false);
@@ -263,18 +288,22 @@ void UAC_BroomComponent::SetFlightEnabled(bool bEnabled)
         if (bIsBoosting)
         {
             bIsBoosting = false;
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnBoostStateChanged.Broadcast(false);
         }
-        CurrentVerticalVelocity = 0.0f;
 
         // 5. Update UI - green color for grounded
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnFlightStateChanged.Broadcast(false);
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnStaminaVisualUpdate.Broadcast(FLinearColor::Green);
     }
 
-    UE_LOG(LogBroomComponent, Warning,
-        TEXT("========== SetFlightEnabled COMPLETE | Flying: %s =========="),
-        bIsFlying ? TEXT("YES") : TEXT("NO"));
+    WJ_EVENT(FlightToggled, GetOwner(), bIsFlying ? 1.0f : 0.0f,
+        StaminaComponent ? StaminaComponent->GetCurrentStamina() : 0.0f, 0.0f);
+    UE_LOG(LogBroomComponent, Verbose,
+        TEXT("[%s] SetFlightEnabled complete | Flying: %s"),
+        *GetNameSafe(GetOwner()), bIsFlying ? TEXT("YES") : TEXT("NO"));
 }
 
 float UAC_BroomComponent::GetFlightStaminaPercent() const
@@ -294,74 +323,84 @@ float UAC_BroomComponent::GetFlightStaminaPercent() const
 }
 
 // ============================================================================
-// BROOM VISUAL SPAWNING
+// BROOM VISUAL (PERSISTENT)
 // ============================================================================
 
-void UAC_BroomComponent::SpawnBroomVisual()
+void UAC_BroomComponent::RequestBroomVisualClassLoad()
 {
-    if (!BroomVisualClass)
+    if (BroomVisualClass.IsNull())
     {
-        UE_LOG(LogBroomComponent, Error,
-            TEXT("  ? Cannot spawn broom - BroomVisualClass is NULL!"));
         return;
     }
 
-    UWorld* World = GetWorld();
-    if (!World)
+    // Already resident (e.g. referenced elsewhere) - no async round trip
+    if (BroomVisualClass.Get())
     {
-        UE_LOG(LogBroomComponent, Error,
-            TEXT("  ? Cannot spawn broom - World is NULL!"));
+        OnBroomVisualClassLoaded();
         return;
     }
 
-    ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
-    if (!OwnerChar)
+    FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+    BroomClassLoadHandle = Streamable.RequestAsyncLoad(
+        BroomVisualClass.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &UAC_BroomComponent::OnBroomVisualClassLoaded));
+
+    UE_LOG(LogBroomComponent, Display,
+        TEXT("[%s] Async loading broom visual class: %s"),
+        *GetNameSafe(GetOwner()), *BroomVisualClass.ToString());
+}
+
+void UAC_BroomComponent::OnBroomVisualClassLoaded()
+{
+    if (!CreateBroomVisual())
     {
-        UE_LOG(LogBroomComponent, Error,
-            TEXT("  ? Cannot spawn broom - Owner is not ACharacter!"));
         return;
     }
 
-    // Destroy old broom if it somehow still exists
-    if (SpawnedBroomVisual)
+    // Player mounted before the load finished - show it now
+    if (bIsFlying)
     {
-        UE_LOG(LogBroomComponent, Warning,
-            TEXT("  ?? Old broom visual still exists - destroying before spawning new one"));
-        SpawnedBroomVisual->Destroy();
-        SpawnedBroomVisual = nullptr;
+        ShowBroomVisual();
     }
+}
 
-    // Spawn broom visual actor at player location
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = GetOwner();
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+bool UAC_BroomComponent::CreateBroomVisual()
+{
+    if (BroomVisual)
+    {
+        return true; // Created once per character
+    }
 
-    SpawnedBroomVisual = World->SpawnActor<AActor>(
-        BroomVisualClass,
-        OwnerChar->GetActorLocation(),
-        OwnerChar->GetActorRotation(),
-        SpawnParams
-    );
+    UClass* VisualClass = BroomVisualClass.Get();
+    if (!VisualClass)
+    {
+        UE_LOG(LogBroomComponent, Error,
+            TEXT("  ? Cannot create broom - BroomVisualClass not loaded!"));
+        return false;
+    }
 
-    if (!SpawnedBroomVisual)
+    UWorld* World = GetWorld();
+    if (!World)
     {
         UE_LOG(LogBroomComponent, Error,
-            TEXT("  ? Failed to spawn broom visual actor!"));
-        return;
+            TEXT("  ? Cannot create broom - World is NULL!"));
+        return false;
     }
 
-    UE_LOG(LogBroomComponent, Display,
-        TEXT("  ? Spawned broom visual: %s"), *SpawnedBroomVisual->GetName());
+    ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
+    if (!OwnerChar)
+    {
+        UE_LOG(LogBroomComponent, Error,
+            TEXT("  ? Cannot create broom - Owner is not ACharacter!"));
+        return false;
+    }
 
-    // Attach broom to player's mount socket
     USkeletalMeshComponent* PlayerMesh = OwnerChar->GetMesh();
     if (!PlayerMesh)
     {
         UE_LOG(LogBroomComponent, Error,
             TEXT("  ? Player has no skeletal mesh - cannot attach broom!"));
-        SpawnedBroomVisual->Destroy();
-        SpawnedBroomVisual = nullptr;
-        return;
+        return false;
     }
 
     // Verify socket exists
@@ -370,45 +409,83 @@ void UAC_BroomComponent::SpawnBroomVisual()
         UE_LOG(LogBroomComponent, Error,
             TEXT("  ? Socket '%s' does not exist on player mesh!"),
             *MountSocketName.ToString());
-        SpawnedBroomVisual->Destroy();
-        SpawnedBroomVisual = nullptr;
-        return;
+        return false;
     }
 
-    // Attach to player
-    bool bAttached = SpawnedBroomVisual->AttachToComponent(
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = OwnerChar;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    BroomVisual = World->SpawnActor<AActor>(
+        VisualClass,
+        OwnerChar->GetActorLocation(),
+        OwnerChar->GetActorRotation(),
+        SpawnParams
+    );
+
+    if (!BroomVisual)
+    {
+        UE_LOG(LogBroomComponent, Error,
+            TEXT("  ? Failed to spawn broom visual actor!"));
+        return false;
+    }
+
+    // Attach once - stays on the socket for the life of the character
+    const bool bAttached = BroomVisual->AttachToComponent(
         PlayerMesh,
         FAttachmentTransformRules::SnapToTargetIncludingScale,
         MountSocketName
     );
 
-    if (bAttached)
-    {
-        UE_LOG(LogBroomComponent, Display,
-            TEXT("  ? Broom attached to player socket: %s"), *MountSocketName.ToString());
-    }
-    else
+    if (!bAttached)
     {
         UE_LOG(LogBroomComponent, Error,
             TEXT("  ? Failed to attach broom to socket!"));
     }
 
-    // Disable collision on spawned broom (visual only)
-    SpawnedBroomVisual->SetActorEnableCollision(false);
+    // Visual only - no collision, hidden and dormant until mounted
+    BroomVisual->SetActorEnableCollision(false);
+    BroomVisual->SetActorHiddenInGame(true);
+    BroomVisual->SetActorTickEnabled(false);
+
+    UE_LOG(LogBroomComponent, Display,
+        TEXT("[%s] ? Created persistent broom visual: %s (socket: %s)"),
+        *OwnerChar->GetName(), *BroomVisual->GetName(), *MountSocketName.ToString());
+
+    return true;
 }
 
-void UAC_BroomComponent::DestroyBroomVisual()
+void UAC_BroomComponent::ShowBroomVisual()
 {
-    if (!SpawnedBroomVisual)
+    if (!BroomVisual)
     {
-        return; // Nothing to destroy
+        // Class still streaming - OnBroomVisualClassLoaded shows it on arrival
+        if (BroomClassLoadHandle.IsValid() && BroomClassLoadHandle->IsLoadingInProgress())
+        {
+            UE_LOG(LogBroomComponent, Warning,
+                TEXT("  ? Broom visual class still loading - will show when ready"));
+            return;
+        }
+
+        if (!CreateBroomVisual())
+        {
+            return;
+        }
     }
 
-    UE_LOG(LogBroomComponent, Display,
-        TEXT("  ? Destroying broom visual: %s"), *SpawnedBroomVisual->GetName());
+    BroomVisual->SetActorHiddenInGame(false);
+    BroomVisual->SetActorTickEnabled(true);
+}
 
-    SpawnedBroomVisual->Destroy();
-    SpawnedBroomVisual = nullptr;
+void UAC_BroomComponent::HideBroomVisual()
+{
+    if (!BroomVisual)
+    {
+        return;
+    }
+
+    BroomVisual->SetActorHiddenInGame(true);
+    BroomVisual->SetActorTickEnabled(false);
 }
 
 // ============================================================================
@@ -472,18 +549,17 @@ void UAC_BroomComponent::HandleToggleInput(const FInputActionValue& Value)
 
 void UAC_BroomComponent::HandleAscendInput(const FInputActionValue& Value)
 {
-    if (!bIsFlying) return;
+    if (!bIsFlying || !MovementComponent) return;
 
-    float InputValue = Value.Get<float>();
-    CurrentVerticalVelocity = InputValue * VerticalSpeed;
+    // Digital intent - VerticalSpeed is applied inside the broom movement mode
+    MovementComponent->SetWantsToAscend(Value.Get<float>() > 0.0f);
 }
 
 void UAC_BroomComponent::HandleDescendInput(const FInputActionValue& Value)
 {
-    if (!bIsFlying) return;
+    if (!bIsFlying || !MovementComponent) return;
 
-    float InputValue = Value.Get<float>();
-    CurrentVerticalVelocity = -InputValue * VerticalSpeed;
+    MovementComponent->SetWantsToDescend(Value.Get<float>() > 0.0f);
 }
 
 void UAC_BroomComponent::HandleBoostInput(const FInputActionValue& Value)
@@ -496,26 +572,30 @@ void UAC_BroomComponent::HandleBoostInput(const FInputActionValue& Value)
     if (bIsBoosting != bBoostPressed)
     {
         bIsBoosting = bBoostPressed;
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnBoostStateChanged.Broadcast(bIsBoosting);
 
+        // Speed and drain rate follow the boost flag inside the simulated move
         if (MovementComponent)
         {
-            MovementComponent->MaxFlySpeed = bIsBoosting ? BoostSpeed : FlySpeed;
+            MovementComponent->SetWantsToBoost(bIsBoosting);
 
             UE_LOG(LogBroomComponent, Log,
                 TEXT("[%s] Boost %s | Speed: %.0f"),
                 *GetOwner()->GetName(),
                 bIsBoosting ? TEXT("ON") : TEXT("OFF"),
-                MovementComponent->MaxFlySpeed);
+                bIsBoosting ? BoostSpeed : FlySpeed);
         }
 
         // Update stamina bar color
         if (bIsBoosting)
         {
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnStaminaVisualUpdate.Broadcast(FLinearColor(1.0f, 0.5f, 0.0f)); // Orange
         }
         else
         {
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnStaminaVisualUpdate.Broadcast(FLinearColor(0.0f, 1.0f, 1.0f)); // Cyan
         }
     }
@@ -525,53 +605,6 @@ void UAC_BroomComponent::HandleBoostInput(const FInputActionValue& Value)
 // FLIGHT MECHANICS
 // ============================================================================
 
-void UAC_BroomComponent::ApplyVerticalMovement(float DeltaTime)
-{
-    if (!MovementComponent || FMath::IsNearlyZero(CurrentVerticalVelocity))
-    {
-        return;
-    }
-
-    FVector Velocity = MovementComponent->Velocity;
-    Velocity.Z = CurrentVerticalVelocity;
-    MovementComponent->Velocity = Velocity;
-}
-
-void UAC_BroomComponent::SetMovementMode(bool bFlying)
-{
-    if (!MovementComponent)
-    {
-        UE_LOG(LogBroomComponent, Error,
-            TEXT("  ? MovementComponent is NULL!"));
-        return;
-    }
-
-    UE_LOG(LogBroomComponent, Log,
-        TEXT("  Before: MovementMode = %s"),
-        *UEnum::GetValueAsString(MovementComponent->MovementMode));
-
-    if (bFlying)
-    {
-        MovementComponent->SetMovementMode(MOVE_Flying);
-        MovementComponent->MaxFlySpeed = FlySpeed;
-
-        UE_LOG(LogBroomComponent, Display,
-            TEXT("  ? Movement mode = MOVE_Flying | Speed: %.0f"), FlySpeed);
-    }
-    else
-    {
-        MovementComponent->SetMovementMode(MOVE_Walking);
-        CurrentVerticalVelocity = 0.0f;
-
-        UE_LOG(LogBroomComponent, Display,
-            TEXT("  ? Movement mode = MOVE_Walking"));
-    }
-
-    UE_LOG(LogBroomComponent, Log,
-        TEXT("  After: MovementMode = %s"),
-        *UEnum::GetValueAsString(MovementComponent->MovementMode));
-}
-
 void UAC_BroomComponent::UpdateInputContext(bool bAddContext)
 {
     if (!InputSubsystem)
@@ -619,12 +652,14 @@ void UAC_BroomComponent::ForceDismount()
         *GetOwner()->GetName());
 
     // Broadcast forced dismount event for HUD
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnForcedDismount.Broadcast();
 
     // Disable flight
     SetFlightEnabled(false);
 
     // Red color for depleted stamina
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnStaminaVisualUpdate.Broadcast(FLinearColor::Red);
 }
 
@@ -632,25 +667,11 @@ void UAC_BroomComponent::ForceDismount()
 // STAMINA INTEGRATION
 // ============================================================================
 
-void UAC_BroomComponent::DrainStamina(float DeltaTime)
-{
-    if (!StaminaComponent)
-    {
-        return;
-    }
-
-    float DrainRate = bIsBoosting ? BoostStaminaDrainRate : StaminaDrainRate;
-    float DrainAmount = DrainRate * DeltaTime;
-
-    // Use ConsumeStamina() to drain stamina
-    StaminaComponent->ConsumeStamina(DrainAmount);
-}
-
-void UAC_BroomComponent::OnStaminaChanged(AActor* Owner, float NewStamina, float Delta)
+void UAC_BroomComponent::HandleStaminaExhausted()
 {
-    // Force dismount if stamina drops below minimum while flying
-    if (bIsFlying && NewStamina < MinStaminaToFly)
+    // Movement already left broom mode inside the move - sync visuals/input/UI
+    if (bIsFlying)
     {
         ForceDismount();
     }
-}
\ No newline at end of file
+}
@@ -10,6 +10,8 @@
 // ============================================================================
 
 #include "Code/Utility/AC_CombatComponent.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "Code/Utility/AC_AimComponent.h"
 #include "Code/Actors/BaseProjectile.h"
 #include "Components/SceneComponent.h"
@@ -20,6 +22,8 @@
 
 DEFINE_LOG_CATEGORY(LogCombatComponent);
 
+DECLARE_CYCLE_STAT(TEXT("Fire Projectile"), STAT_WizardJam_FireProjectile, STATGROUP_WizardJam);
+
 // ============================================================================
 // CONSTRUCTOR
 // ============================================================================
@@ -97,6 +101,7 @@ void UAC_CombatComponent::TickComponent(float DeltaTime, ELevelTick TickType,
     if (bIsOnCooldown != bWasOnCooldown)
     {
         bWasOnCooldown = bIsOnCooldown;
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnCooldownStateChanged.Broadcast(bIsOnCooldown, GetCooldownRemaining());
 
         UE_LOG(LogCombatComponent, Verbose,
@@ -145,6 +150,8 @@ ABaseProjectile* UAC_CombatComponent::FireProjectileClass(TSubclassOf<ABaseProje
 ABaseProjectile* UAC_CombatComponent::SpawnProjectileInternal(
     TSubclassOf<ABaseProjectile> ProjectileClass, FName TypeName)
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_FireProjectile);
+
     // Validate world
     if (!GetWorld() || !GetOwner())
     {
@@ -195,8 +202,9 @@ ABaseProjectile* UAC_CombatComponent::SpawnProjectileInternal(
 
     if (AimComponent)
     {
-        // Request fresh aim data
-        AimComponent->RequestAimUpdate();
+        // Request fresh aim data - ExactView reuses this frame's crosshair
+        // trace only if the camera has not moved since it was taken
+        AimComponent->RequestAimUpdate(ECameraTraceStaleness::ExactView);
 
         // Get aim point from component
         AimPoint = AimComponent->GetAimHitLocation();
@@ -257,12 +265,14 @@ ABaseProjectile* UAC_CombatComponent::SpawnProjectileInternal(
     // Update cooldown
     LastFireTime = CurrentTime;
     bWasOnCooldown = true;
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnCooldownStateChanged.Broadcast(true, FireCooldown);
 
     // Broadcast success
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnProjectileFired.Broadcast(Projectile, TypeName, FireDirection);
 
-    UE_LOG(LogCombatComponent, Log,
+    UE_LOG(LogCombatComponent, Verbose,
         TEXT("[%s] Fired projectile | Type: %s | Location: %s | Direction: %s"),
         *GetOwner()->GetName(),
         *TypeName.ToString(),
@@ -464,5 +474,6 @@ FVector UAC_CombatComponent::CalculateMuzzleLocation() const
 
 void UAC_CombatComponent::BroadcastFireBlocked(EFireBlockedReason Reason, FName TypeName)
 {
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnFireBlocked.Broadcast(Reason, TypeName);
 }
\ No newline at end of file
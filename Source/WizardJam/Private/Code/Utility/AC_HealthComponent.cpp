@@ -6,17 +6,27 @@
 // Project: WizardJam
 
 #include "Code/Utility/AC_HealthComponent.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Controller.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogHealthComponent, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogHealthComponent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Apply Damage"), STAT_WizardJam_ApplyDamage, STATGROUP_WizardJam);
 
 UAC_HealthComponent::UAC_HealthComponent()
     : MaxHealth(100.0f)
+    , HealthRegenRate(0.0f)
+    , HealthRegenDelay(5.0f)
     , CurrentHealth(0.0f)
     , OwnerActor(nullptr)
     , bIsInitialized(false)
+    , SegmentStartTime(0.0)
+    , RegenStartTime(0.0)
 {
     PrimaryComponentTick.bCanEverTick = false;
 }
@@ -58,36 +68,53 @@ void UAC_HealthComponent::Initialize(float InMaxHealth)
     CurrentHealth = MaxHealth;
     bIsInitialized = true;
 
+    SegmentStartTime = GetNow();
+    RegenStartTime = SegmentStartTime;
+    ScheduleRegenBoundary();
+
     if (OwnerActor && OnHealthChanged.IsBound())
     {
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnHealthChanged.Broadcast(OwnerActor, CurrentHealth, 0.0f);
     }
 }
 
 float UAC_HealthComponent::ApplyDamage(float DamageAmount, AActor* DamageCauser)
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_ApplyDamage);
+
     if (DamageAmount <= 0.0f || !IsAlive())
     {
         return 0.0f;
     }
 
+    WJ_COUNTER_INC(DamageEvents);
+
+    FoldRegenSegment();
+    RegenStartTime = SegmentStartTime + HealthRegenDelay;
+
     float OldHealth = CurrentHealth;
     CurrentHealth = FMath::Clamp(CurrentHealth - DamageAmount, 0.0f, MaxHealth);
     float ActualDamage = OldHealth - CurrentHealth;
 
     if (OwnerActor && OnHealthChanged.IsBound())
     {
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnHealthChanged.Broadcast(OwnerActor, CurrentHealth, -ActualDamage);
     }
 
-    UE_LOG(LogHealthComponent, Display, TEXT("[%s] Took %.1f damage | HP: %.1f/%.1f"),
+    WJ_EVENT(DamageTaken, OwnerActor, ActualDamage, CurrentHealth, MaxHealth);
+    UE_LOG(LogHealthComponent, Verbose, TEXT("[%s] Took %.1f damage | HP: %.1f/%.1f"),
         *GetNameSafe(OwnerActor), ActualDamage, CurrentHealth, MaxHealth);
 
+    ScheduleRegenBoundary();
+
     if (CurrentHealth <= 0.0f)
     {
         UE_LOG(LogHealthComponent, Warning, TEXT("[%s] has died!"), *GetNameSafe(OwnerActor));
         if (OnDeath.IsBound())
         {
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnDeath.Broadcast(OwnerActor, DamageCauser);
         }
     }
@@ -102,18 +129,23 @@ float UAC_HealthComponent::Heal(float HealAmount)
         return 0.0f;
     }
 
+    FoldRegenSegment();
+
     float OldHealth = CurrentHealth;
     CurrentHealth = FMath::Clamp(CurrentHealth + HealAmount, 0.0f, MaxHealth);
     float ActualHealing = CurrentHealth - OldHealth;
 
     if (OwnerActor && OnHealthChanged.IsBound())
     {
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnHealthChanged.Broadcast(OwnerActor, CurrentHealth, ActualHealing);
     }
 
     UE_LOG(LogHealthComponent, Display, TEXT("[%s] Healed %.1f HP | HP: %.1f/%.1f"),
         *GetNameSafe(OwnerActor), ActualHealing, CurrentHealth, MaxHealth);
 
+    ScheduleRegenBoundary();
+
     return ActualHealing;
 }
 
@@ -139,7 +171,7 @@ bool UAC_HealthComponent::IsAlive() const
 
 float UAC_HealthComponent::GetCurrentHealth() const
 {
-    return CurrentHealth;
+    return EvaluateHealthAt(GetNow());
 }
 
 float UAC_HealthComponent::GetMaxHealth() const
@@ -149,5 +181,99 @@ float UAC_HealthComponent::GetMaxHealth() const
 
 float UAC_HealthComponent::GetHealthPercent() const
 {
-    return MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 0.0f;
+    return MaxHealth > 0.0f ? GetCurrentHealth() / MaxHealth : 0.0f;
+}
+
+float UAC_HealthComponent::GetHealthRegenRate() const
+{
+    const double Now = GetNow();
+    if (HealthRegenRate <= 0.0f || !IsAlive() || Now < RegenStartTime)
+    {
+        return 0.0f;
+    }
+
+    return EvaluateHealthAt(Now) < MaxHealth ? HealthRegenRate : 0.0f;
+}
+
+// ============================================================================
+// REGEN SEGMENT
+// ============================================================================
+
+double UAC_HealthComponent::GetNow() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UAC_HealthComponent::EvaluateHealthAt(double Time) const
+{
+    // Regen never revives - dead stays dead until Initialize()
+    if (HealthRegenRate <= 0.0f || CurrentHealth <= 0.0f)
+    {
+        return CurrentHealth;
+    }
+
+    const double RegenFrom = FMath::Max(SegmentStartTime, RegenStartTime);
+    if (Time <= RegenFrom)
+    {
+        return CurrentHealth;
+    }
+
+    const float Regenerated = HealthRegenRate * static_cast<float>(Time - RegenFrom);
+    return FMath::Min(CurrentHealth + Regenerated, MaxHealth);
+}
+
+void UAC_HealthComponent::FoldRegenSegment()
+{
+    const double Now = GetNow();
+    CurrentHealth = EvaluateHealthAt(Now);
+    SegmentStartTime = Now;
+}
+
+void UAC_HealthComponent::ScheduleRegenBoundary()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+
+    if (HealthRegenRate <= 0.0f || !IsAlive() || CurrentHealth >= MaxHealth)
+    {
+        TimerManager.ClearTimer(RegenBoundaryTimer);
+        return;
+    }
+
+    // Next boundary is either regen starting or health reaching max
+    const double Now = GetNow();
+    const double BoundaryTime = (Now < RegenStartTime)
+        ? RegenStartTime
+        : Now + (MaxHealth - CurrentHealth) / HealthRegenRate;
+
+    const float Delay = FMath::Max(static_cast<float>(BoundaryTime - Now), KINDA_SMALL_NUMBER);
+    TimerManager.SetTimer(RegenBoundaryTimer, this,
+        &UAC_HealthComponent::HandleRegenBoundary, Delay, false);
+}
+
+void UAC_HealthComponent::HandleRegenBoundary()
+{
+    const float OldHealth = CurrentHealth;
+    FoldRegenSegment();
+
+    // Timer jitter can land a hair short of max - snap so no tiny timer follows
+    if (CurrentHealth >= MaxHealth - 0.01f)
+    {
+        CurrentHealth = MaxHealth;
+    }
+
+    // Broadcast at regen start (rate changed) and at full (value settled)
+    if (OwnerActor && OnHealthChanged.IsBound())
+    {
+        WJ_COUNTER_INC(DelegateBroadcasts);
+        OnHealthChanged.Broadcast(OwnerActor, CurrentHealth, CurrentHealth - OldHealth);
+    }
+
+    ScheduleRegenBoundary();
 }
\ No newline at end of file
@@ -23,6 +23,7 @@
 // ============================================================================
 
 #include "Code/Utility/AC_SpellCollectionComponent.h"
+#include "Code/Utility/WizardJamCounters.h"
 
 // NOTE: No TeleportInterface include here!
 // The component is fully decoupled from the teleport system.
@@ -76,11 +77,10 @@ void UAC_SpellCollectionComponent::BeginPlay()
 
     // Log initial state for debugging
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] SpellCollectionComponent initialized | Enabled: %s | Starting Spells: %d | Starting Channels: %d"),
-        *OwnerName,
+        *GetNameSafe(Owner),
         bCollectionEnabled ? TEXT("YES") : TEXT("NO"),
         CollectedSpells.Num(),
         UnlockedChannels.Num());
@@ -92,16 +92,14 @@ void UAC_SpellCollectionComponent::BeginPlay()
 
 bool UAC_SpellCollectionComponent::AddSpell(FName SpellType)
 {
-    // Get owner name for logging
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     // Validate input - NAME_None would pollute the set
     if (SpellType == NAME_None)
     {
         UE_LOG(LogSpellCollection, Warning,
             TEXT("[%s] AddSpell failed: SpellType is NAME_None"),
-            *OwnerName);
+            *GetNameSafe(Owner));
         return false;
     }
 
@@ -110,7 +108,7 @@ bool UAC_SpellCollectionComponent::AddSpell(FName SpellType)
     {
         UE_LOG(LogSpellCollection, Log,
             TEXT("[%s] AddSpell('%s') denied: Collection is disabled"),
-            *OwnerName, *SpellType.ToString());
+            *GetNameSafe(Owner), *SpellType.ToString());
         return false;
     }
 
@@ -119,7 +117,7 @@ bool UAC_SpellCollectionComponent::AddSpell(FName SpellType)
     {
         UE_LOG(LogSpellCollection, Log,
             TEXT("[%s] AddSpell('%s') skipped: Already collected"),
-            *OwnerName, *SpellType.ToString());
+            *GetNameSafe(Owner), *SpellType.ToString());
         return false;
     }
 
@@ -127,14 +125,17 @@ bool UAC_SpellCollectionComponent::AddSpell(FName SpellType)
     CollectedSpells.Add(SpellType);
     int32 TotalCount = CollectedSpells.Num();
 
-    UE_LOG(LogSpellCollection, Display,
+    WJ_EVENT(SpellAdded, Owner, static_cast<float>(TotalCount));
+    UE_LOG(LogSpellCollection, Verbose,
         TEXT("[%s] === SPELL COLLECTED === '%s' | Total: %d"),
-        *OwnerName, *SpellType.ToString(), TotalCount);
+        *GetNameSafe(Owner), *SpellType.ToString(), TotalCount);
 
     // Broadcast to instance delegate (actor-specific reactions)
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnSpellAdded.Broadcast(SpellType, TotalCount);
 
     // Broadcast to static delegate (GameMode global tracking)
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnAnySpellCollected.Broadcast(SpellType, Owner, this);
 
     return true;
@@ -154,14 +155,13 @@ bool UAC_SpellCollectionComponent::HasSpell(FName SpellType) const
 bool UAC_SpellCollectionComponent::RemoveSpell(FName SpellType)
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     // Validate input
     if (SpellType == NAME_None)
     {
         UE_LOG(LogSpellCollection, Warning,
             TEXT("[%s] RemoveSpell failed: SpellType is NAME_None"),
-            *OwnerName);
+            *GetNameSafe(Owner));
         return false;
     }
 
@@ -170,7 +170,7 @@ bool UAC_SpellCollectionComponent::RemoveSpell(FName SpellType)
     {
         UE_LOG(LogSpellCollection, Log,
             TEXT("[%s] RemoveSpell('%s') failed: Not in collection"),
-            *OwnerName, *SpellType.ToString());
+            *GetNameSafe(Owner), *SpellType.ToString());
         return false;
     }
 
@@ -180,9 +180,10 @@ bool UAC_SpellCollectionComponent::RemoveSpell(FName SpellType)
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] === SPELL REMOVED === '%s' | Remaining: %d"),
-        *OwnerName, *SpellType.ToString(), RemainingCount);
+        *GetNameSafe(Owner), *SpellType.ToString(), RemainingCount);
 
     // Broadcast removal
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnSpellRemoved.Broadcast(SpellType, RemainingCount);
 
     return true;
@@ -203,7 +204,6 @@ int32 UAC_SpellCollectionComponent::GetSpellCount() const
 void UAC_SpellCollectionComponent::ClearAllSpells()
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     int32 PreviousCount = CollectedSpells.Num();
 
@@ -214,15 +214,17 @@ void UAC_SpellCollectionComponent::ClearAllSpells()
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] === ALL SPELLS CLEARED === Previous count: %d"),
-        *OwnerName, PreviousCount);
+        *GetNameSafe(Owner), PreviousCount);
 
     // Broadcast individual removals so listeners can react per-spell
     for (const FName& Spell : SpellsToRemove)
     {
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnSpellRemoved.Broadcast(Spell, 0);
     }
 
     // Broadcast the clear event
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnAllSpellsCleared.Broadcast(PreviousCount);
 }
 
@@ -234,13 +236,12 @@ void UAC_SpellCollectionComponent::ClearAllSpells()
 void UAC_SpellCollectionComponent::AddChannel(FName Channel)
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     if (Channel == NAME_None)
     {
         UE_LOG(LogSpellCollection, Warning,
             TEXT("[%s] AddChannel failed: Channel is NAME_None"),
-            *OwnerName);
+            *GetNameSafe(Owner));
         return;
     }
 
@@ -248,7 +249,7 @@ void UAC_SpellCollectionComponent::AddChannel(FName Channel)
     {
         UE_LOG(LogSpellCollection, Verbose,
             TEXT("[%s] AddChannel('%s') skipped: Already unlocked"),
-            *OwnerName, *Channel.ToString());
+            *GetNameSafe(Owner), *Channel.ToString());
         return;
     }
 
@@ -256,7 +257,7 @@ void UAC_SpellCollectionComponent::AddChannel(FName Channel)
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] Channel unlocked: '%s' | Total channels: %d"),
-        *OwnerName, *Channel.ToString(), UnlockedChannels.Num());
+        *GetNameSafe(Owner), *Channel.ToString(), UnlockedChannels.Num());
 
     // ========================================================================
     // HYBRID BRIDGE: Broadcast channel addition via delegate
@@ -276,6 +277,7 @@ void UAC_SpellCollectionComponent::AddChannel(FName Channel)
     // Companion might not bind at all, so channels only affect spells
     // Enemy might bind to do something completely different
     // ========================================================================
+    WJ_COUNTER_INC(DelegateBroadcasts);
     OnChannelAdded.Broadcast(Channel);
 }
 
@@ -292,7 +294,6 @@ bool UAC_SpellCollectionComponent::HasChannel(FName Channel) const
 void UAC_SpellCollectionComponent::RemoveChannel(FName Channel)
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     if (Channel == NAME_None)
     {
@@ -303,9 +304,10 @@ void UAC_SpellCollectionComponent::RemoveChannel(FName Channel)
     {
         UE_LOG(LogSpellCollection, Display,
             TEXT("[%s] Channel removed: '%s'"),
-            *OwnerName, *Channel.ToString());
+            *GetNameSafe(Owner), *Channel.ToString());
 
         // Broadcast so owner can also remove from teleport channels if desired
+        WJ_COUNTER_INC(DelegateBroadcasts);
         OnChannelRemoved.Broadcast(Channel);
     }
 }
@@ -315,17 +317,21 @@ TArray<FName> UAC_SpellCollectionComponent::GetAllChannels() const
     return UnlockedChannels.Array();
 }
 
+int32 UAC_SpellCollectionComponent::GetChannelCount() const
+{
+    return UnlockedChannels.Num();
+}
+
 void UAC_SpellCollectionComponent::ClearAllChannels()
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     int32 PreviousCount = UnlockedChannels.Num();
     UnlockedChannels.Empty();
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] All channels cleared (had %d)"),
-        *OwnerName, PreviousCount);
+        *GetNameSafe(Owner), PreviousCount);
 }
 
 // ============================================================================
@@ -340,13 +346,12 @@ bool UAC_SpellCollectionComponent::IsCollectionEnabled() const
 void UAC_SpellCollectionComponent::SetCollectionEnabled(bool bEnabled)
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     bCollectionEnabled = bEnabled;
 
     UE_LOG(LogSpellCollection, Display,
         TEXT("[%s] Spell collection %s"),
-        *OwnerName, bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
+        *GetNameSafe(Owner), bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
 // ============================================================================
@@ -356,11 +361,10 @@ void UAC_SpellCollectionComponent::SetCollectionEnabled(bool bEnabled)
 void UAC_SpellCollectionComponent::DebugPrintSpells() const
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     UE_LOG(LogSpellCollection, Warning,
         TEXT("========== [%s] COLLECTED SPELLS (%d) =========="),
-        *OwnerName, CollectedSpells.Num());
+        *GetNameSafe(Owner), CollectedSpells.Num());
 
     for (const FName& Spell : CollectedSpells)
     {
@@ -382,11 +386,10 @@ void UAC_SpellCollectionComponent::DebugPrintSpells() const
 void UAC_SpellCollectionComponent::DebugPrintChannels() const
 {
     AActor* Owner = GetOwner();
-    FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
 
     UE_LOG(LogSpellCollection, Warning,
         TEXT("========== [%s] UNLOCKED CHANNELS (%d) =========="),
-        *OwnerName, UnlockedChannels.Num());
+        *GetNameSafe(Owner), UnlockedChannels.Num());
 
     for (const FName& Channel : UnlockedChannels)
     {
@@ -4,12 +4,26 @@
 // Developer: Marcus Daley
 // Date: December 30, 2025 (Updated from December 21)
 // Project: WizardJam
+//
+// Tick-free: stamina is evaluated from the active segment on demand and a
+// single timer per segment boundary drives threshold events.
 
 #include "Code/Utility/AC_StaminaComponent.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 // Logging
-DEFINE_LOG_CATEGORY_STATIC(LogStaminaComponent, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogStaminaComponent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Stamina Change"), STAT_WizardJam_StaminaChange, STATGROUP_WizardJam);
+
+// Values within this distance of 0 or Max snap to the boundary so timer
+// jitter cannot leave a sliver of stamina and schedule a near-zero timer
+static constexpr float StaminaSnapTolerance = 0.01f;
 
 // ============================================================================
 // CONSTRUCTOR
@@ -17,15 +31,19 @@ DEFINE_LOG_CATEGORY_STATIC(LogStaminaComponent, Log, All);
 
 UAC_StaminaComponent::UAC_StaminaComponent()
     : MaxStamina(100.0f)
-    , CurrentStamina(100.0f)
     , StaminaRegenRate(15.0f)
     , StaminaDrainRate(20.0f)
     , RegenDelay(1.0f)
+    , SegmentBaseStamina(100.0f)
+    , SegmentRate(0.0f)
+    , SegmentStartTime(0.0)
+    , RegenStartTime(0.0)
+    , SustainedDrainRate(0.0f)
     , bIsSprinting(false)
-    , RegenDelayTimer(0.0f)
     , OwnerActor(nullptr)
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // No per-frame work - segment boundaries are driven by timers
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 // ============================================================================
@@ -40,57 +58,25 @@ void UAC_StaminaComponent::BeginPlay()
     OwnerActor = GetOwner();
 
     // Ensure valid starting stamina
-    if (CurrentStamina <= 0.0f)
+    if (SegmentBaseStamina <= 0.0f)
     {
-        CurrentStamina = MaxStamina;
+        SegmentBaseStamina = MaxStamina;
     }
 
+    // Open the first segment at the current world time
+    SegmentStartTime = GetNow();
+    RegenStartTime = SegmentStartTime;
+    SegmentRate = 0.0f;
+
     // Initial broadcast so HUD can initialize
     if (OwnerActor && OnStaminaChanged.IsBound())
     {
-        OnStaminaChanged.Broadcast(OwnerActor, CurrentStamina, 0.0f);
+        WJ_COUNTER_INC(DelegateBroadcasts);
+        OnStaminaChanged.Broadcast(OwnerActor, SegmentBaseStamina, 0.0f);
     }
 
     UE_LOG(LogStaminaComponent, Display, TEXT("[%s] StaminaComponent ready: %.0f/%.0f | RegenRate: %.0f | DrainRate: %.0f"),
-        *GetNameSafe(OwnerActor), CurrentStamina, MaxStamina, StaminaRegenRate, StaminaDrainRate);
-}
-
-void UAC_StaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType,
-    FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    if (bIsSprinting)
-    {
-        // Drain stamina while sprinting
-        float DrainAmount = StaminaDrainRate * DeltaTime;
-        ApplyStaminaChange(-DrainAmount);
-
-        // Auto-stop sprinting when depleted
-        if (CurrentStamina <= 0.0f)
-        {
-            bIsSprinting = false;
-            UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Sprint stopped - stamina depleted"),
-                *GetNameSafe(OwnerActor));
-        }
-
-        // Reset regen delay timer
-        RegenDelayTimer = RegenDelay;
-    }
-    else
-    {
-        // Count down regen delay
-        if (RegenDelayTimer > 0.0f)
-        {
-            RegenDelayTimer -= DeltaTime;
-        }
-        else if (CurrentStamina < MaxStamina)
-        {
-            // Regenerate stamina after delay
-            float RegenAmount = StaminaRegenRate * DeltaTime;
-            ApplyStaminaChange(RegenAmount);
-        }
-    }
+        *GetNameSafe(OwnerActor), SegmentBaseStamina, MaxStamina, StaminaRegenRate, StaminaDrainRate);
 }
 
 // ============================================================================
@@ -107,17 +93,25 @@ void UAC_StaminaComponent::Initialize(float InMaxStamina)
     }
 
     MaxStamina = InMaxStamina;
-    CurrentStamina = MaxStamina;
-    RegenDelayTimer = 0.0f;
+    SegmentBaseStamina = MaxStamina;
+    SegmentRate = 0.0f;
+    SegmentStartTime = GetNow();
+    RegenStartTime = SegmentStartTime;
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(SegmentBoundaryTimer);
+    }
 
     // Broadcast initial state
     if (OwnerActor && OnStaminaChanged.IsBound())
     {
-        OnStaminaChanged.Broadcast(OwnerActor, CurrentStamina, 0.0f);
+        WJ_COUNTER_INC(DelegateBroadcasts);
+        OnStaminaChanged.Broadcast(OwnerActor, SegmentBaseStamina, 0.0f);
     }
 
     UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Stamina initialized: %.0f/%.0f"),
-        *GetNameSafe(OwnerActor), CurrentStamina, MaxStamina);
+        *GetNameSafe(OwnerActor), SegmentBaseStamina, MaxStamina);
 }
 
 void UAC_StaminaComponent::SetSprinting(bool bNewSprinting)
@@ -142,12 +136,31 @@ void UAC_StaminaComponent::SetSprinting(bool bNewSprinting)
             UE_LOG(LogStaminaComponent, Verbose, TEXT("[%s] Sprint STOPPED"),
                 *GetNameSafe(OwnerActor));
         }
+
+        Rebase(0.0f);
+    }
+}
+
+void UAC_StaminaComponent::SetSustainedDrainRate(float DrainPerSecond)
+{
+    DrainPerSecond = FMath::Max(DrainPerSecond, 0.0f);
+
+    if (FMath::IsNearlyEqual(SustainedDrainRate, DrainPerSecond))
+    {
+        return;
     }
+
+    SustainedDrainRate = DrainPerSecond;
+
+    UE_LOG(LogStaminaComponent, Verbose, TEXT("[%s] Sustained drain set to %.1f/s"),
+        *GetNameSafe(OwnerActor), SustainedDrainRate);
+
+    Rebase(0.0f);
 }
 
 bool UAC_StaminaComponent::CanSprint() const
 {
-    return CurrentStamina > 0.0f;
+    return GetCurrentStamina() > 0.0f;
 }
 
 bool UAC_StaminaComponent::ConsumeStamina(float Amount)
@@ -157,18 +170,19 @@ bool UAC_StaminaComponent::ConsumeStamina(float Amount)
         return true; // Nothing to consume
     }
 
-    if (CurrentStamina < Amount)
+    const float Available = GetCurrentStamina();
+    if (Available < Amount)
     {
         UE_LOG(LogStaminaComponent, Verbose, TEXT("[%s] Cannot consume %.0f stamina - only %.0f available"),
-            *GetNameSafe(OwnerActor), Amount, CurrentStamina);
+            *GetNameSafe(OwnerActor), Amount, Available);
         return false;
     }
 
-    ApplyStaminaChange(-Amount);
-    RegenDelayTimer = RegenDelay; // Reset regen delay
+    // Negative delta also restarts the regen delay
+    Rebase(-Amount);
 
     UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Consumed %.0f stamina | Remaining: %.0f/%.0f"),
-        *GetNameSafe(OwnerActor), Amount, CurrentStamina, MaxStamina);
+        *GetNameSafe(OwnerActor), Amount, SegmentBaseStamina, MaxStamina);
 
     return true;
 }
@@ -180,53 +194,172 @@ float UAC_StaminaComponent::RestoreStamina(float Amount)
         return 0.0f;
     }
 
-    float OldStamina = CurrentStamina;
-    ApplyStaminaChange(Amount);
-    float ActualRestored = CurrentStamina - OldStamina;
+    float OldStamina = GetCurrentStamina();
+    Rebase(Amount);
+    float ActualRestored = SegmentBaseStamina - OldStamina;
 
     if (ActualRestored > 0.0f)
     {
         UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Restored %.0f stamina | Current: %.0f/%.0f"),
-            *GetNameSafe(OwnerActor), ActualRestored, CurrentStamina, MaxStamina);
+            *GetNameSafe(OwnerActor), ActualRestored, SegmentBaseStamina, MaxStamina);
     }
 
     return ActualRestored;
 }
 
+float UAC_StaminaComponent::GetCurrentStamina() const
+{
+    return EvaluateAt(GetNow());
+}
+
 float UAC_StaminaComponent::GetStaminaPercent() const
 {
-    return (MaxStamina > 0.0f) ? (CurrentStamina / MaxStamina) : 0.0f;
+    return (MaxStamina > 0.0f) ? (GetCurrentStamina() / MaxStamina) : 0.0f;
+}
+
+float UAC_StaminaComponent::GetTimeUntilStamina(float Threshold) const
+{
+    const float Current = GetCurrentStamina();
+
+    if (SegmentRate < 0.0f && Threshold <= Current && Threshold >= 0.0f)
+    {
+        return (Current - Threshold) / -SegmentRate;
+    }
+
+    if (SegmentRate > 0.0f && Threshold >= Current && Threshold <= MaxStamina)
+    {
+        return (Threshold - Current) / SegmentRate;
+    }
+
+    return -1.0f;
 }
 
 // ============================================================================
-// INTERNAL METHODS
+// SEGMENT EVALUATION
 // ============================================================================
 
-void UAC_StaminaComponent::ApplyStaminaChange(float Delta)
+double UAC_StaminaComponent::GetNow() const
 {
-    if (FMath::IsNearlyZero(Delta))
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UAC_StaminaComponent::EvaluateAt(double Time) const
+{
+    const double Elapsed = FMath::Max(Time - SegmentStartTime, 0.0);
+    const float Value = SegmentBaseStamina + SegmentRate * static_cast<float>(Elapsed);
+    return FMath::Clamp(Value, 0.0f, MaxStamina);
+}
+
+float UAC_StaminaComponent::GetTotalDrainRate() const
+{
+    return (bIsSprinting ? StaminaDrainRate : 0.0f) + SustainedDrainRate;
+}
+
+void UAC_StaminaComponent::Rebase(float Delta)
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_StaminaChange);
+
+    UWorld* World = GetWorld();
+    const double Now = GetNow();
+
+    const float PreviousBase = SegmentBaseStamina;
+    const float PreviousRate = SegmentRate;
+
+    float NewStamina = FMath::Clamp(EvaluateAt(Now) + Delta, 0.0f, MaxStamina);
+    if (NewStamina <= StaminaSnapTolerance)
     {
-        return;
+        NewStamina = 0.0f;
+    }
+    else if (NewStamina >= MaxStamina - StaminaSnapTolerance)
+    {
+        NewStamina = MaxStamina;
+    }
+
+    // Auto-stop sprinting when depleted
+    if (bIsSprinting && NewStamina <= 0.0f)
+    {
+        bIsSprinting = false;
+        UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Sprint stopped - stamina depleted"),
+            *GetNameSafe(OwnerActor));
+    }
+
+    const float DrainRate = GetTotalDrainRate();
+
+    // Draining, a drain ending, or a discrete cost all restart the regen delay
+    if (DrainRate > 0.0f || PreviousRate < 0.0f || Delta < 0.0f)
+    {
+        RegenStartTime = Now + RegenDelay;
+    }
+
+    // Pick the new segment rate and the time of its boundary
+    float NewRate = 0.0f;
+    double BoundaryTime = -1.0;
+
+    if (DrainRate > 0.0f)
+    {
+        if (NewStamina > 0.0f)
+        {
+            NewRate = -DrainRate;
+            BoundaryTime = Now + NewStamina / DrainRate;
+        }
+    }
+    else if (NewStamina < MaxStamina)
+    {
+        if (Now < RegenStartTime)
+        {
+            // Flat segment until the regen delay elapses
+            BoundaryTime = RegenStartTime;
+        }
+        else if (StaminaRegenRate > 0.0f)
+        {
+            NewRate = StaminaRegenRate;
+            BoundaryTime = Now + (MaxStamina - NewStamina) / StaminaRegenRate;
+        }
     }
 
-    float OldStamina = CurrentStamina;
-    CurrentStamina = FMath::Clamp(CurrentStamina + Delta, 0.0f, MaxStamina);
-    float ActualDelta = CurrentStamina - OldStamina;
+    SegmentBaseStamina = NewStamina;
+    SegmentStartTime = Now;
+    SegmentRate = NewRate;
 
-    // Only broadcast if there was actual change
-    if (!FMath::IsNearlyZero(ActualDelta))
+    if (World)
     {
-        // Broadcast to HUD and other listeners
-        if (OwnerActor && OnStaminaChanged.IsBound())
+        FTimerManager& TimerManager = World->GetTimerManager();
+        if (BoundaryTime >= 0.0)
+        {
+            const float Delay = FMath::Max(static_cast<float>(BoundaryTime - Now), KINDA_SMALL_NUMBER);
+            TimerManager.SetTimer(SegmentBoundaryTimer, this,
+                &UAC_StaminaComponent::HandleSegmentBoundary, Delay, false);
+        }
+        else
         {
-            OnStaminaChanged.Broadcast(OwnerActor, CurrentStamina, ActualDelta);
+            TimerManager.ClearTimer(SegmentBoundaryTimer);
         }
+    }
+
+    // One broadcast per segment change - listeners interpolate with GetStaminaRate()
+    const float BroadcastDelta = NewStamina - PreviousBase;
+    const bool bValueChanged = !FMath::IsNearlyZero(BroadcastDelta);
+    const bool bRateChanged = !FMath::IsNearlyEqual(PreviousRate, NewRate);
+
+    if ((bValueChanged || bRateChanged) && OwnerActor && OnStaminaChanged.IsBound())
+    {
+        WJ_COUNTER_INC(DelegateBroadcasts);
+        OnStaminaChanged.Broadcast(OwnerActor, NewStamina, BroadcastDelta);
+    }
 
-        // Check threshold events
-        CheckThresholds(OldStamina, CurrentStamina);
+    // Segments are monotonic so base-to-base comparison catches any crossing
+    if (bValueChanged)
+    {
+        CheckThresholds(PreviousBase, NewStamina);
     }
 }
 
+void UAC_StaminaComponent::HandleSegmentBoundary()
+{
+    Rebase(0.0f);
+}
+
 void UAC_StaminaComponent::CheckThresholds(float OldStamina, float NewStamina)
 {
     // Check for depletion
@@ -234,6 +367,7 @@ void UAC_StaminaComponent::CheckThresholds(float OldStamina, float NewStamina)
     {
         if (OwnerActor && OnStaminaDepleted.IsBound())
         {
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnStaminaDepleted.Broadcast(OwnerActor);
         }
         UE_LOG(LogStaminaComponent, Warning, TEXT("[%s] Stamina DEPLETED!"),
@@ -245,9 +379,10 @@ void UAC_StaminaComponent::CheckThresholds(float OldStamina, float NewStamina)
     {
         if (OwnerActor && OnStaminaRestored.IsBound())
         {
+            WJ_COUNTER_INC(DelegateBroadcasts);
             OnStaminaRestored.Broadcast(OwnerActor);
         }
         UE_LOG(LogStaminaComponent, Display, TEXT("[%s] Stamina FULL!"),
             *GetNameSafe(OwnerActor));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,374 @@
+// AimAssistSubsystem.cpp
+// Developer: Marcus Daley
+// Date: January 12, 2026
+// Project: WizardJam
+
+#include "Code/Utility/AimAssistSubsystem.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "GenericTeamAgentInterface.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAimAssist, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Aim Assist Query"), STAT_WizardJam_AimAssist, STATGROUP_WizardJam);
+
+UAimAssistSubsystem::UAimAssistSubsystem()
+    : AssistRange(3000.0f)
+    , ConeHalfAngleDegrees(6.0f)
+    , LockReleaseAngleScale(1.5f)
+    , LockedScoreScale(0.5f)
+    , AngleWeight(0.7f)
+    , CellSize(1000.0f)
+    , RefreshInterval(0.1f)
+    , OcclusionRetryFrames(10)
+{
+}
+
+bool UAimAssistSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAimAssistSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(RefreshTimerHandle);
+    }
+
+    Cells.Empty();
+    TargetCells.Empty();
+
+    Super::Deinitialize();
+}
+
+// ============================================================================
+// REGISTRY
+// ============================================================================
+
+void UAimAssistSubsystem::RegisterTarget(AActor* Target)
+{
+    if (!Target || TargetCells.Contains(Target))
+    {
+        return;
+    }
+
+    const FIntVector Cell = GetCell(Target->GetActorLocation());
+    TargetCells.Add(Target, Cell);
+    AddToCell(Target, Cell);
+
+    UpdateRefreshTimer();
+
+    UE_LOG(LogAimAssist, Verbose, TEXT("[%s] Registered as aim assist target | Cell: %s"),
+        *Target->GetName(), *Cell.ToString());
+}
+
+void UAimAssistSubsystem::UnregisterTarget(AActor* Target)
+{
+    FIntVector Cell;
+    if (!Target || !TargetCells.RemoveAndCopyValue(Target, Cell))
+    {
+        return;
+    }
+
+    RemoveFromCell(Target, Cell);
+    UpdateRefreshTimer();
+}
+
+FIntVector UAimAssistSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+FVector UAimAssistSubsystem::GetCellCenter(const FIntVector& Cell) const
+{
+    return (FVector(Cell) + FVector(0.5f)) * CellSize;
+}
+
+void UAimAssistSubsystem::AddToCell(AActor* Target, const FIntVector& Cell)
+{
+    Cells.FindOrAdd(Cell).Add(Target);
+}
+
+void UAimAssistSubsystem::RemoveFromCell(AActor* Target, const FIntVector& Cell)
+{
+    if (auto* CellTargets = Cells.Find(Cell))
+    {
+        CellTargets->RemoveSingleSwap(Target);
+        if (CellTargets->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void UAimAssistSubsystem::RefreshTargetCells()
+{
+    for (auto It = TargetCells.CreateIterator(); It; ++It)
+    {
+        AActor* Target = It->Key.Get();
+        if (!Target)
+        {
+            // Destroyed without unregistering - cell entry is already stale
+            if (auto* CellTargets = Cells.Find(It->Value))
+            {
+                CellTargets->RemoveAllSwap([](const TWeakObjectPtr<AActor>& Entry) { return !Entry.IsValid(); });
+                if (CellTargets->Num() == 0)
+                {
+                    Cells.Remove(It->Value);
+                }
+            }
+            It.RemoveCurrent();
+            continue;
+        }
+
+        const FIntVector NewCell = GetCell(Target->GetActorLocation());
+        if (NewCell != It->Value)
+        {
+            RemoveFromCell(Target, It->Value);
+            AddToCell(Target, NewCell);
+            It->Value = NewCell;
+        }
+    }
+
+    UpdateRefreshTimer();
+}
+
+void UAimAssistSubsystem::UpdateRefreshTimer()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    const bool bHasTargets = TargetCells.Num() > 0;
+
+    if (bHasTargets && !TimerManager.IsTimerActive(RefreshTimerHandle))
+    {
+        TimerManager.SetTimer(RefreshTimerHandle, this,
+            &UAimAssistSubsystem::RefreshTargetCells, RefreshInterval, true);
+    }
+    else if (!bHasTargets)
+    {
+        TimerManager.ClearTimer(RefreshTimerHandle);
+    }
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+AActor* UAimAssistSubsystem::FindAssistTarget(const FVector& ViewOrigin, const FVector& ViewDirection,
+    AActor* Viewer, FAimAssistState& State, FVector& OutAimPoint)
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_AimAssist);
+
+    // Aim and fire can both ask in one frame - only the first pays for a trace
+    if (State.LastQueryFrame == GFrameCounter)
+    {
+        OutAimPoint = State.LastAimPoint;
+        return State.LastResult.Get();
+    }
+
+    State.LastQueryFrame = GFrameCounter;
+    State.LastResult.Reset();
+
+    AActor* Best = FindBestCandidate(ViewOrigin, ViewDirection, Viewer, State);
+    if (!Best)
+    {
+        State.LockedTarget.Reset();
+        return nullptr;
+    }
+
+    // One line of sight trace per frame, best candidate only
+    if (!HasLineOfSight(ViewOrigin, Best, Viewer))
+    {
+        State.OccludedTarget = Best;
+        State.OccludedUntilFrame = GFrameCounter + OcclusionRetryFrames;
+        if (State.LockedTarget == Best)
+        {
+            State.LockedTarget.Reset();
+        }
+        return nullptr;
+    }
+
+    if (State.LockedTarget != Best)
+    {
+        UE_LOG(LogAimAssist, Verbose, TEXT("[%s] Soft-lock: %s"),
+            *GetNameSafe(Viewer), *Best->GetName());
+    }
+
+    State.LockedTarget = Best;
+    State.LastResult = Best;
+    State.LastAimPoint = Best->GetActorLocation();
+
+    OutAimPoint = State.LastAimPoint;
+    return Best;
+}
+
+AActor* UAimAssistSubsystem::FindBestCandidate(const FVector& ViewOrigin, const FVector& ViewDirection,
+    AActor* Viewer, const FAimAssistState& State) const
+{
+    if (Cells.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    const float ConeHalfAngle = FMath::DegreesToRadians(ConeHalfAngleDegrees);
+    const float ReleaseHalfAngle = ConeHalfAngle * LockReleaseAngleScale;
+    const float CosConeHalf = FMath::Cos(ConeHalfAngle);
+    const float CosReleaseHalf = FMath::Cos(ReleaseHalfAngle);
+
+    // Targets may have moved up to one refresh since they were binned, so
+    // cells are treated as half a cell larger than they are
+    const float CellPadding = CellSize * 0.5f;
+    const float CellRadius = CellSize * UE_HALF_SQRT_3 + CellPadding;
+
+    // Bounds of the (release) cone: apex plus the end cap disc
+    const FVector EndCenter = ViewOrigin + (ViewDirection * AssistRange);
+    const float EndRadius = AssistRange * FMath::Tan(ReleaseHalfAngle);
+    FBox ConeBounds(ViewOrigin, ViewOrigin);
+    ConeBounds += FBox(EndCenter - FVector(EndRadius), EndCenter + FVector(EndRadius));
+    ConeBounds = ConeBounds.ExpandBy(CellPadding);
+
+    const FIntVector MinCell = GetCell(ConeBounds.Min);
+    const FIntVector MaxCell = GetCell(ConeBounds.Max);
+    const FIntVector Span = MaxCell - MinCell + FIntVector(1);
+    const int64 CellsInBounds = int64(Span.X) * Span.Y * Span.Z;
+
+    IGenericTeamAgentInterface* ViewerTeam = Cast<IGenericTeamAgentInterface>(Viewer);
+    AActor* LockedTarget = State.LockedTarget.Get();
+    AActor* OccludedTarget = State.OccludedUntilFrame > GFrameCounter ? State.OccludedTarget.Get() : nullptr;
+
+    AActor* BestTarget = nullptr;
+    float BestScore = TNumericLimits<float>::Max();
+
+    auto ScoreCell = [&](const FIntVector& Cell, const TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>>& CellTargets)
+    {
+        // Angular bucket rejection: skip the whole cell if its bounding
+        // sphere lies entirely outside the release cone
+        const FVector ToCell = GetCellCenter(Cell) - ViewOrigin;
+        const float CellDistance = ToCell.Size();
+        if (CellDistance - CellRadius > AssistRange)
+        {
+            return;
+        }
+        if (CellDistance > CellRadius)
+        {
+            const float CellAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToCell / CellDistance, ViewDirection), -1.0f, 1.0f));
+            const float CellAngularRadius = FMath::Asin(CellRadius / CellDistance);
+            if (CellAngle - CellAngularRadius > ReleaseHalfAngle)
+            {
+                return;
+            }
+        }
+
+        for (const TWeakObjectPtr<AActor>& WeakTarget : CellTargets)
+        {
+            AActor* Target = WeakTarget.Get();
+            if (!Target || Target == Viewer || Target == OccludedTarget)
+            {
+                continue;
+            }
+
+            const FVector ToTarget = Target->GetActorLocation() - ViewOrigin;
+            const float Distance = ToTarget.Size();
+            if (Distance <= KINDA_SMALL_NUMBER || Distance > AssistRange)
+            {
+                continue;
+            }
+
+            const bool bIsLocked = Target == LockedTarget;
+            const float CosAngle = FVector::DotProduct(ToTarget / Distance, ViewDirection);
+            if (CosAngle < (bIsLocked ? CosReleaseHalf : CosConeHalf))
+            {
+                continue;
+            }
+
+            if (ViewerTeam && ViewerTeam->GetTeamAttitudeTowards(*Target) == ETeamAttitude::Friendly)
+            {
+                continue;
+            }
+
+            const float Angle = FMath::Acos(FMath::Min(CosAngle, 1.0f));
+            float Score = AngleWeight * (Angle / ConeHalfAngle)
+                + (1.0f - AngleWeight) * (Distance / AssistRange);
+            if (bIsLocked)
+            {
+                Score *= LockedScoreScale;
+            }
+
+            if (Score < BestScore)
+            {
+                BestScore = Score;
+                BestTarget = Target;
+            }
+        }
+    };
+
+    // Walk whichever is smaller: the cells under the cone or the occupied cells
+    if (CellsInBounds <= Cells.Num())
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+            {
+                for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+                {
+                    const FIntVector Cell(X, Y, Z);
+                    if (const auto* CellTargets = Cells.Find(Cell))
+                    {
+                        ScoreCell(Cell, *CellTargets);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (const auto& Pair : Cells)
+        {
+            const FIntVector& Cell = Pair.Key;
+            if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X
+                && Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y
+                && Cell.Z >= MinCell.Z && Cell.Z <= MaxCell.Z)
+            {
+                ScoreCell(Cell, Pair.Value);
+            }
+        }
+    }
+
+    return BestTarget;
+}
+
+bool UAimAssistSubsystem::HasLineOfSight(const FVector& ViewOrigin, AActor* Target, AActor* Viewer) const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AimAssistLOS), false, Viewer);
+    QueryParams.AddIgnoredActor(Target);
+    if (Viewer)
+    {
+        Viewer->ForEachAttachedActors([&QueryParams](AActor* Attached)
+        {
+            QueryParams.AddIgnoredActor(Attached);
+            return true;
+        });
+    }
+
+    // Anything blocking between camera and target means no line of sight
+    WJ_COUNTER_INC(Traces);
+    return !World->LineTraceTestByChannel(ViewOrigin, Target->GetActorLocation(), ECC_Visibility, QueryParams);
+}
@@ -0,0 +1,243 @@
+// CameraTraceSubsystem.cpp
+// Developer: Marcus Daley
+// Date: January 11, 2026
+// Project: WizardJam
+
+#include "Code/Utility/CameraTraceSubsystem.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCameraTrace, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Camera Trace"), STAT_WizardJam_CameraTrace, STATGROUP_WizardJam);
+
+namespace
+{
+    // View point drift allowed before ExactView queries re-trace
+    constexpr float ViewLocationTolerance = 0.1f;
+    constexpr float ViewRotationTolerance = 0.01f;
+}
+
+UCameraTraceSubsystem::UCameraTraceSubsystem()
+    : TraceCount(0)
+    , CacheHitCount(0)
+{
+}
+
+bool UCameraTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool UCameraTraceSubsystem::TraceFromCamera(APlayerController* PC, const FVector2D& ScreenFraction,
+    float MaxDistance, ECollisionChannel Channel, ECameraTraceStaleness Staleness, FCameraTraceResult& OutResult)
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_CameraTrace);
+
+    OutResult = FCameraTraceResult();
+
+    if (!PC || !GetWorld())
+    {
+        return false;
+    }
+
+    FCameraViewCache& View = FindOrAddView(PC, ScreenFraction);
+    if (!IsViewCurrent(View, PC, Staleness))
+    {
+        ResolveView(View, PC);
+    }
+
+    FChannelTraceCache& Entry = FindOrAddChannel(View, Channel);
+    Entry.PeakRequestedDistance = FMath::Max(Entry.PeakRequestedDistance, MaxDistance);
+
+    if (Entry.TracedDistance >= MaxDistance)
+    {
+        ++CacheHitCount;
+        OutResult.bFromCache = true;
+    }
+    else
+    {
+        // Trace as far as anyone has asked on this channel so the next shorter
+        // or equal query this frame is a cache hit
+        RunTrace(View, PC, Entry, Entry.PeakRequestedDistance);
+    }
+
+    OutResult.TraceStart = View.RayStart;
+    OutResult.TraceDirection = View.RayDirection;
+    OutResult.TraceEnd = View.RayStart + (View.RayDirection * MaxDistance);
+    OutResult.bHit = Entry.bHit && Entry.Hit.Distance <= MaxDistance;
+    if (OutResult.bHit)
+    {
+        OutResult.Hit = Entry.Hit;
+    }
+
+    return true;
+}
+
+bool UCameraTraceSubsystem::GetCameraRay(APlayerController* PC, const FVector2D& ScreenFraction,
+    ECameraTraceStaleness Staleness, FVector& OutStart, FVector& OutDirection)
+{
+    if (!PC)
+    {
+        return false;
+    }
+
+    FCameraViewCache& View = FindOrAddView(PC, ScreenFraction);
+    if (!IsViewCurrent(View, PC, Staleness))
+    {
+        ResolveView(View, PC);
+    }
+
+    OutStart = View.RayStart;
+    OutDirection = View.RayDirection;
+    return true;
+}
+
+// ============================================================================
+// CACHE MANAGEMENT
+// ============================================================================
+
+UCameraTraceSubsystem::FCameraViewCache& UCameraTraceSubsystem::FindOrAddView(
+    APlayerController* PC, const FVector2D& ScreenFraction)
+{
+    // Controllers destroyed on travel or logout drop out here
+    Views.RemoveAllSwap([](const FCameraViewCache& View) { return !View.Controller.IsValid(); });
+
+    for (FCameraViewCache& View : Views)
+    {
+        if (View.Controller.Get() == PC && View.ScreenFraction.Equals(ScreenFraction))
+        {
+            return View;
+        }
+    }
+
+    FCameraViewCache& NewView = Views.AddDefaulted_GetRef();
+    NewView.Controller = PC;
+    NewView.ScreenFraction = ScreenFraction;
+    NewView.FrameNumber = 0;
+    return NewView;
+}
+
+bool UCameraTraceSubsystem::IsViewCurrent(const FCameraViewCache& View, APlayerController* PC,
+    ECameraTraceStaleness Staleness) const
+{
+    if (View.FrameNumber != GFrameCounter)
+    {
+        return false;
+    }
+
+    if (Staleness == ECameraTraceStaleness::SameFrame)
+    {
+        return true;
+    }
+
+    // ExactView: the camera may have moved since the cached trace (input
+    // processed after the aim update), so compare the live view point
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+    return ViewLocation.Equals(View.ViewLocation, ViewLocationTolerance)
+        && ViewRotation.Equals(View.ViewRotation, ViewRotationTolerance);
+}
+
+void UCameraTraceSubsystem::ResolveView(FCameraViewCache& View, APlayerController* PC) const
+{
+    View.FrameNumber = GFrameCounter;
+    PC->GetPlayerViewPoint(View.ViewLocation, View.ViewRotation);
+
+    int32 ViewportX = 0;
+    int32 ViewportY = 0;
+    PC->GetViewportSize(ViewportX, ViewportY);
+
+    FVector WorldLocation;
+    FVector WorldDirection;
+    const bool bDeprojected = ViewportX > 0 && ViewportY > 0 && PC->DeprojectScreenPositionToWorld(
+        ViewportX * View.ScreenFraction.X, ViewportY * View.ScreenFraction.Y, WorldLocation, WorldDirection);
+
+    if (bDeprojected)
+    {
+        View.RayStart = WorldLocation;
+        View.RayDirection = WorldDirection;
+    }
+    else
+    {
+        // No viewport (dedicated server, minimized) - camera forward is the best guess
+        View.RayStart = View.ViewLocation;
+        View.RayDirection = View.ViewRotation.Vector();
+
+        UE_LOG(LogCameraTrace, Verbose,
+            TEXT("[%s] Deprojection failed, using camera forward"), *GetNameSafe(PC));
+    }
+
+    // New ray - every channel must re-trace
+    for (FChannelTraceCache& Entry : View.Channels)
+    {
+        Entry.TracedDistance = -1.0f;
+    }
+}
+
+UCameraTraceSubsystem::FChannelTraceCache& UCameraTraceSubsystem::FindOrAddChannel(
+    FCameraViewCache& View, ECollisionChannel Channel)
+{
+    for (FChannelTraceCache& Entry : View.Channels)
+    {
+        if (Entry.Channel == Channel)
+        {
+            return Entry;
+        }
+    }
+
+    FChannelTraceCache& NewEntry = View.Channels.AddDefaulted_GetRef();
+    NewEntry.Channel = Channel;
+    NewEntry.TracedDistance = -1.0f;
+    NewEntry.PeakRequestedDistance = 0.0f;
+    NewEntry.bHit = false;
+    return NewEntry;
+}
+
+// ============================================================================
+// TRACE
+// ============================================================================
+
+void UCameraTraceSubsystem::RunTrace(const FCameraViewCache& View, APlayerController* PC,
+    FChannelTraceCache& Entry, float Distance)
+{
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CameraTrace), false);
+    QueryParams.bReturnPhysicalMaterial = true;
+
+    // Ignore the viewing pawn and everything attached to it (broom, equipment)
+    if (APawn* Pawn = PC->GetPawn())
+    {
+        QueryParams.AddIgnoredActor(Pawn);
+
+        Pawn->ForEachAttachedActors([&QueryParams](AActor* Attached)
+        {
+            QueryParams.AddIgnoredActor(Attached);
+            return true;
+        });
+    }
+
+    const FVector TraceEnd = View.RayStart + (View.RayDirection * Distance);
+
+    Entry.Hit = FHitResult();
+    Entry.bHit = GetWorld()->LineTraceSingleByChannel(
+        Entry.Hit,
+        View.RayStart,
+        TraceEnd,
+        Entry.Channel,
+        QueryParams
+    );
+    Entry.TracedDistance = Distance;
+
+    ++TraceCount;
+    WJ_COUNTER_INC(Traces);
+}
@@ -4,25 +4,38 @@
 // Date: December 31, 2025
 
 #include "Code/Utility/InteractionComponent.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
+#include "Components/SphereComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "Code/Utility/Interactable.h"
 #include "Code/UI/TooltipWidget.h"
+#include "Code/Utility/CameraTraceSubsystem.h"
+#include "Code/Utility/WizardJamCounters.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogInteraction, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogInteraction, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Interaction Focus"), STAT_WizardJam_InteractionFocus, STATGROUP_WizardJam);
 
 UInteractionComponent::UInteractionComponent()
     : InteractionTraceRange(300.0f)
+    , InteractionDetectionRadius(300.0f)
+    , MaxFocusAngle(20.0f)
     , bShowDebugTrace(false)
     , CurrentFocusedActor(nullptr)
     , PreviousFocusedActor(nullptr)
     , TooltipWidgetInstance(nullptr)
+    , DetectionSphere(nullptr)
 {
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.TickInterval = 0.1f; // Check 10 times per second
+
+    // Only ticks while an interactable is inside the detection sphere
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UInteractionComponent::BeginPlay()
@@ -30,12 +43,30 @@ void UInteractionComponent::BeginPlay()
     Super::BeginPlay();
 
     UE_LOG(LogInteraction, Log,
-        TEXT("[InteractionComponent] Initialized - Range: %.1f"), InteractionTraceRange);
+        TEXT("[InteractionComponent] Initialized - Range: %.1f | Detection radius: %.1f"),
+        InteractionTraceRange, InteractionDetectionRadius);
 
     if (!CreateTooltipWidget())
     {
         UE_LOG(LogInteraction, Error, TEXT("[InteractionComponent] Failed to create tooltip widget!"));
     }
+
+    CreateDetectionSphere();
+}
+
+void UInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (DetectionSphere)
+    {
+        DetectionSphere->OnComponentBeginOverlap.RemoveAll(this);
+        DetectionSphere->OnComponentEndOverlap.RemoveAll(this);
+        DetectionSphere->DestroyComponent();
+        DetectionSphere = nullptr;
+    }
+
+    Candidates.Empty();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -43,86 +74,219 @@ void UInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    // Perform interaction trace
-    FHitResult HitResult;
-    bool bHitInteractable = PerformInteractionTrace(HitResult);
-
-    // Update focused actor
-    AActor* NewFocusedActor = bHitInteractable ? HitResult.GetActor() : nullptr;
+    // Pick the candidate closest to the crosshair, then confirm it is visible
+    AActor* NewFocusedActor = FindFocusCandidate();
     UpdateFocusedActor(NewFocusedActor);
 }
 
-bool UInteractionComponent::PerformInteractionTrace(FHitResult& OutHitResult)
+// ============================================================================
+// CANDIDATE DETECTION
+// Interactables entering the sphere around the pawn become candidates; the
+// component only ticks while at least one candidate is in range.
+// ============================================================================
+
+void UInteractionComponent::CreateDetectionSphere()
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->GetRootComponent())
+    {
+        UE_LOG(LogInteraction, Error, TEXT("[InteractionComponent] No owner root - detection disabled"));
+        return;
+    }
+
+    DetectionSphere = NewObject<USphereComponent>(Owner, TEXT("InteractionDetectionSphere"));
+    DetectionSphere->InitSphereRadius(InteractionDetectionRadius);
+    DetectionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    DetectionSphere->SetCollisionObjectType(ECC_WorldDynamic);
+
+    // Only interactables - level geometry that generates overlaps stays silent
+    DetectionSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+    DetectionSphere->SetCollisionResponseToChannel(ECC_Interactable, ECR_Overlap);
+    DetectionSphere->SetGenerateOverlapEvents(true);
+    DetectionSphere->SetupAttachment(Owner->GetRootComponent());
+    DetectionSphere->RegisterComponent();
+
+    DetectionSphere->OnComponentBeginOverlap.AddDynamic(this, &UInteractionComponent::OnDetectionBeginOverlap);
+    DetectionSphere->OnComponentEndOverlap.AddDynamic(this, &UInteractionComponent::OnDetectionEndOverlap);
+
+    // Interactables already inside the sphere at spawn don't fire begin overlap
+    TArray<AActor*> OverlappingActors;
+    DetectionSphere->GetOverlappingActors(OverlappingActors);
+    for (AActor* Actor : OverlappingActors)
+    {
+        AddCandidate(Actor);
+    }
+}
+
+void UInteractionComponent::OnDetectionBeginOverlap(UPrimitiveComponent* OverlappedComponent,
+    AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+    bool bFromSweep, const FHitResult& SweepResult)
+{
+    AddCandidate(OtherActor);
+}
+
+void UInteractionComponent::OnDetectionEndOverlap(UPrimitiveComponent* OverlappedComponent,
+    AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    // Another component of the same actor may still be inside the sphere
+    if (!OtherActor || (DetectionSphere && DetectionSphere->IsOverlappingActor(OtherActor)))
+    {
+        return;
+    }
+
+    if (Candidates.RemoveSingleSwap(OtherActor) > 0)
+    {
+        UpdateTickState();
+    }
+}
+
+void UInteractionComponent::AddCandidate(AActor* Actor)
+{
+    if (!Actor || Actor == GetOwner() || !Actor->Implements<UInteractable>())
+    {
+        return;
+    }
+
+    if (!Candidates.Contains(Actor))
+    {
+        Candidates.Add(Actor);
+        UpdateTickState();
+    }
+}
+
+void UInteractionComponent::UpdateTickState()
+{
+    Candidates.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Candidate) { return !Candidate.IsValid(); });
+
+    const bool bHasCandidates = Candidates.Num() > 0;
+    if (bHasCandidates == IsComponentTickEnabled())
+    {
+        return;
+    }
+
+    SetComponentTickEnabled(bHasCandidates);
+
+    // Last candidate left range - drop focus now, there is no tick to do it
+    if (!bHasCandidates)
+    {
+        UpdateFocusedActor(nullptr);
+    }
+
+    UE_LOG(LogInteraction, Verbose, TEXT("[InteractionComponent] Detection %s | Candidates: %d"),
+        bHasCandidates ? TEXT("active") : TEXT("idle"), Candidates.Num());
+}
+
+// ============================================================================
+// FOCUS SELECTION
+// ============================================================================
+
+AActor* UInteractionComponent::FindFocusCandidate()
 {
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_InteractionFocus);
+
     APawn* OwnerPawn = Cast<APawn>(GetOwner());
     if (!OwnerPawn)
     {
-        return false;
+        return nullptr;
     }
 
     APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
     if (!PC)
     {
-        return false;
+        return nullptr;
     }
 
-    // Get viewport size to find screen center
-    int32 ViewportSizeX, ViewportSizeY;
-    PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
+    UWorld* World = GetWorld();
+    UCameraTraceSubsystem* CameraTraces = World ? World->GetSubsystem<UCameraTraceSubsystem>() : nullptr;
+    if (!CameraTraces)
+    {
+        return nullptr;
+    }
 
     // Screen center is where the crosshair is displayed
-    FVector2D ScreenCenter(ViewportSizeX / 2.0f, ViewportSizeY / 2.0f);
-
-    // Convert screen position to 3D world ray
-    // This gives us the exact direction the crosshair is pointing
-    FVector WorldLocation;
-    FVector WorldDirection;
-    if (!PC->DeprojectScreenPositionToWorld(ScreenCenter.X, ScreenCenter.Y, WorldLocation, WorldDirection))
+    FVector ViewOrigin;
+    FVector ViewDirection;
+    if (!CameraTraces->GetCameraRay(PC, FVector2D(0.5f, 0.5f), ECameraTraceStaleness::SameFrame, ViewOrigin, ViewDirection))
     {
-        // Deprojection failed - viewport might not be valid
-        return false;
+        return nullptr;
     }
 
-    // Trace from screen center outward along crosshair direction
-    FVector TraceStart = WorldLocation;
-    FVector TraceEnd = WorldLocation + (WorldDirection * InteractionTraceRange);
+    // Best candidate = smallest angle off the crosshair within trace range (no traces yet)
+    const float MinFocusDot = FMath::Cos(FMath::DegreesToRadians(MaxFocusAngle));
+    const float MaxRangeSq = FMath::Square(InteractionTraceRange);
+    AActor* BestCandidate = nullptr;
+    FVector BestFocusPoint = FVector::ZeroVector;
+    float BestDot = MinFocusDot;
 
-    // Setup trace parameters
-    FCollisionQueryParams TraceParams;
-    TraceParams.AddIgnoredActor(OwnerPawn);
-    TraceParams.bTraceComplex = false;
+    for (const TWeakObjectPtr<AActor>& WeakCandidate : Candidates)
+    {
+        AActor* Candidate = WeakCandidate.Get();
+        if (!IsValidInteractableActor(Candidate))
+        {
+            continue;
+        }
 
-    // Perform line trace using Visibility channel
-    // Interactable actors must have collision set to block Visibility
-    UWorld* World = GetWorld();
-    bool bHit = World->LineTraceSingleByChannel(
-        OutHitResult,
-        TraceStart,
-        TraceEnd,
-        ECC_Visibility,
-        TraceParams
-    );
+        const FVector FocusPoint = GetFocusPoint(Candidate);
+        const FVector ToCandidate = FocusPoint - ViewOrigin;
+        if (ToCandidate.SizeSquared() > MaxRangeSq)
+        {
+            continue;
+        }
+
+        const float Dot = FVector::DotProduct(ToCandidate.GetSafeNormal(), ViewDirection);
+        if (Dot >= BestDot)
+        {
+            BestDot = Dot;
+            BestCandidate = Candidate;
+            BestFocusPoint = FocusPoint;
+        }
+    }
+
+    if (!BestCandidate)
+    {
+        return nullptr;
+    }
+
+    // One trace to confirm the candidate is not behind a wall
+    const bool bVisible = IsCandidateVisible(ViewOrigin, BestFocusPoint, BestCandidate);
 
     // Debug visualization (enable in Blueprint with bShowDebugTrace)
     if (bShowDebugTrace)
     {
-        FColor DebugColor = bHit ? FColor::Yellow : FColor::Blue;
-        DrawDebugLine(World, TraceStart, bHit ? OutHitResult.ImpactPoint : TraceEnd,
-            DebugColor, false, 0.2f, 0, 2.0f);
-
-        if (bHit)
-        {
-            DrawDebugSphere(World, OutHitResult.ImpactPoint, 10.0f, 12, DebugColor, false, 0.2f);
-        }
+        FColor DebugColor = bVisible ? FColor::Yellow : FColor::Blue;
+        DrawDebugLine(World, ViewOrigin, BestFocusPoint, DebugColor, false, 0.2f, 0, 2.0f);
+        DrawDebugSphere(World, BestFocusPoint, 10.0f, 12, DebugColor, false, 0.2f);
     }
 
-    // Return true only if hit valid interactable actor
-    if (bHit && IsValidInteractableActor(OutHitResult.GetActor()))
+    return bVisible ? BestCandidate : nullptr;
+}
+
+bool UInteractionComponent::IsCandidateVisible(const FVector& ViewOrigin, const FVector& FocusPoint, AActor* Candidate) const
+{
+    FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(InteractionOcclusion), false, GetOwner());
+    TraceParams.AddIgnoredActor(Candidate);
+
+    // Ignore equipment attached to the pawn (broom visual, etc.)
+    GetOwner()->ForEachAttachedActors([&TraceParams](AActor* Attached)
     {
+        TraceParams.AddIgnoredActor(Attached);
         return true;
-    }
+    });
 
-    return false;
+    // Anything blocking Visibility between camera and candidate occludes it
+    WJ_COUNTER_INC(Traces);
+    return !GetWorld()->LineTraceTestByChannel(
+        ViewOrigin,
+        FocusPoint,
+        ECC_Visibility,
+        TraceParams
+    );
+}
+
+FVector UInteractionComponent::GetFocusPoint(const AActor* Candidate)
+{
+    const USceneComponent* Root = Candidate->GetRootComponent();
+    return Root ? Root->Bounds.Origin : Candidate->GetActorLocation();
 }
 
 void UInteractionComponent::UpdateFocusedActor(AActor* NewFocusedActor)
@@ -0,0 +1,616 @@
+// StatusEffectSubsystem.cpp
+// Batched elemental status effects
+//
+// Developer: Marcus Daley
+// Date: January 8, 2026
+// Project: WizardJam
+
+#include "Code/Utility/StatusEffectSubsystem.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "Code/Utility/AC_HealthComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GenericTeamAgentInterface.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStatusEffects, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+DECLARE_CYCLE_STAT(TEXT("Status Effects Pass"), STAT_WizardJam_StatusEffects, STATGROUP_WizardJam);
+
+// ============================================================================
+// ELEMENT INTERACTION TABLE
+// ============================================================================
+
+namespace
+{
+    // How an incoming element treats an effect already on the target
+    enum class EElementInteraction : uint8
+    {
+        Coexist,    // Both effects stay
+        Refresh,    // Same element - reset duration, keep strongest magnitude
+        Replace,    // Existing removed, incoming applied (Ice extinguishes Flame)
+        Cancel,     // Both removed (Flame melts Ice)
+        Amplify     // Existing consumed, incoming magnitude boosted (Lightning shatters Ice)
+    };
+
+    constexpr int32 NumSpellChannels = static_cast<int32>(ESpellChannel::Arcane) + 1;
+
+    using EI = EElementInteraction;
+
+    // Rows = incoming element, columns = existing element
+    constexpr EElementInteraction ElementInteractionTable[NumSpellChannels][NumSpellChannels] =
+    {
+        //                 None         Flame        Ice          Lightning    Arcane
+        /* None      */ { EI::Coexist, EI::Coexist, EI::Coexist, EI::Coexist, EI::Coexist },
+        /* Flame     */ { EI::Coexist, EI::Refresh, EI::Cancel,  EI::Coexist, EI::Coexist },
+        /* Ice       */ { EI::Coexist, EI::Replace, EI::Refresh, EI::Coexist, EI::Coexist },
+        /* Lightning */ { EI::Coexist, EI::Coexist, EI::Amplify, EI::Refresh, EI::Coexist },
+        /* Arcane    */ { EI::Coexist, EI::Coexist, EI::Coexist, EI::Coexist, EI::Refresh },
+    };
+
+    static_assert(UE_ARRAY_COUNT(ElementInteractionTable) == NumSpellChannels,
+        "ElementInteractionTable must have one row per ESpellChannel value");
+
+    constexpr EElementInteraction GetInteraction(ESpellChannel Incoming, ESpellChannel Existing)
+    {
+        return ElementInteractionTable[static_cast<uint8>(Incoming)][static_cast<uint8>(Existing)];
+    }
+
+    static_assert(GetInteraction(ESpellChannel::Ice, ESpellChannel::Flame) == EI::Replace,
+        "Ice must extinguish Flame");
+}
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+UStatusEffectSubsystem::UStatusEffectSubsystem()
+    : UpdateInterval(0.1f)
+    , BurnDamagePerSecond(5.0f)
+    , BurnDuration(4.0f)
+    , FreezeSpeedMultiplier(0.5f)
+    , FreezeDuration(3.0f)
+    , ShockChainDamage(8.0f)
+    , ShockChainRadius(600.0f)
+    , ShockChainMaxTargets(2)
+    , ShockDuration(0.5f)
+    , ShatterMagnitudeMultiplier(2.0f)
+    , ArcaneDamageTakenMultiplier(1.25f)
+    , ArcaneDuration(5.0f)
+{
+}
+
+// ============================================================================
+// SUBSYSTEM LIFECYCLE
+// ============================================================================
+
+bool UStatusEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+    }
+
+    // Hand back any speed we are still holding down
+    for (const TPair<TWeakObjectPtr<UCharacterMovementComponent>, float>& Pair : SlowedBaseSpeeds)
+    {
+        if (UCharacterMovementComponent* MoveComp = Pair.Key.Get())
+        {
+            MoveComp->MaxWalkSpeed = Pair.Value;
+        }
+    }
+
+    Targets.Empty();
+    Instigators.Empty();
+    HealthComponents.Empty();
+    MovementComponents.Empty();
+    Elements.Empty();
+    RemainingTimes.Empty();
+    Magnitudes.Empty();
+    TargetKeys.Empty();
+    NextRowForTarget.Empty();
+    FirstRowByTarget.Empty();
+    PendingDamage.Empty();
+    SlowedBaseSpeeds.Empty();
+    SpeedMultiplierScratch.Empty();
+
+    Super::Deinitialize();
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void UStatusEffectSubsystem::ApplyElementalEffect(AActor* Target, ESpellChannel Element,
+    AActor* EffectInstigator, float Magnitude)
+{
+    if (!Target || Element == ESpellChannel::None || Magnitude <= 0.0f)
+    {
+        return;
+    }
+
+    // Resolve interactions with every effect already on the target
+    bool bApplyIncoming = true;
+    for (uint8 ExistingIndex = 1; ExistingIndex < NumSpellChannels; ++ExistingIndex)
+    {
+        const ESpellChannel Existing = static_cast<ESpellChannel>(ExistingIndex);
+        const int32 Row = FindRow(Target, Existing);
+        if (Row == INDEX_NONE)
+        {
+            continue;
+        }
+
+        switch (GetInteraction(Element, Existing))
+        {
+        case EElementInteraction::Replace:
+            RemoveRow(Row);
+            break;
+
+        case EElementInteraction::Cancel:
+            RemoveRow(Row);
+            bApplyIncoming = false;
+            break;
+
+        case EElementInteraction::Amplify:
+            RemoveRow(Row);
+            Magnitude *= ShatterMagnitudeMultiplier;
+            break;
+
+        case EElementInteraction::Coexist:
+        case EElementInteraction::Refresh:
+        default:
+            break;
+        }
+    }
+
+    if (!bApplyIncoming)
+    {
+        UE_LOG(LogStatusEffects, Verbose, TEXT("[%s] %s cancelled an existing effect"),
+            *Target->GetName(), *UEnum::GetValueAsString(Element));
+        UpdateTimerState();
+        return;
+    }
+
+    if (Element == ESpellChannel::Lightning)
+    {
+        ChainShock(Target, EffectInstigator, Magnitude);
+    }
+
+    AddOrRefreshRow(Target, Element, EffectInstigator, Magnitude);
+    UpdateTimerState();
+}
+
+void UStatusEffectSubsystem::ClearEffects(AActor* Target)
+{
+    if (!Target)
+    {
+        return;
+    }
+
+    // RemoveRow advances the head, so keep removing it until the chain is gone
+    while (const int32* FirstRow = FirstRowByTarget.Find(Target))
+    {
+        RemoveRow(*FirstRow);
+    }
+
+    // Restore speed now rather than waiting for the next pass
+    if (ACharacter* Character = Cast<ACharacter>(Target))
+    {
+        TWeakObjectPtr<UCharacterMovementComponent> MoveKey(Character->GetCharacterMovement());
+        if (const float* BaseSpeed = SlowedBaseSpeeds.Find(MoveKey))
+        {
+            MoveKey->MaxWalkSpeed = *BaseSpeed;
+            SlowedBaseSpeeds.Remove(MoveKey);
+        }
+    }
+
+    UpdateTimerState();
+}
+
+bool UStatusEffectSubsystem::HasEffect(AActor* Target, ESpellChannel Element) const
+{
+    return FindRow(Target, Element) != INDEX_NONE;
+}
+
+float UStatusEffectSubsystem::GetDamageTakenMultiplier(AActor* Target) const
+{
+    const int32 Row = FindRow(Target, ESpellChannel::Arcane);
+    if (Row == INDEX_NONE)
+    {
+        return 1.0f;
+    }
+
+    return 1.0f + (ArcaneDamageTakenMultiplier - 1.0f) * Magnitudes[Row];
+}
+
+ESpellChannel UStatusEffectSubsystem::ElementNameToChannel(FName ElementName)
+{
+    const UEnum* ChannelEnum = StaticEnum<ESpellChannel>();
+    if (!ChannelEnum || ElementName.IsNone())
+    {
+        return ESpellChannel::None;
+    }
+
+    const FString ElementString = ElementName.ToString();
+    for (int32 Index = 1; Index < NumSpellChannels; ++Index)
+    {
+        if (ChannelEnum->GetNameStringByIndex(Index) == ElementString)
+        {
+            return static_cast<ESpellChannel>(ChannelEnum->GetValueByIndex(Index));
+        }
+    }
+
+    return ESpellChannel::None;
+}
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+int32 UStatusEffectSubsystem::FindRow(const AActor* Target, ESpellChannel Element) const
+{
+    if (!Target)
+    {
+        return INDEX_NONE;
+    }
+
+    // Walks only this target's rows - one per active element at most
+    const int32* FirstRow = FirstRowByTarget.Find(Target);
+    for (int32 Row = FirstRow ? *FirstRow : INDEX_NONE; Row != INDEX_NONE; Row = NextRowForTarget[Row])
+    {
+        if (Elements[Row] == Element)
+        {
+            return Row;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+void UStatusEffectSubsystem::AddOrRefreshRow(AActor* Target, ESpellChannel Element,
+    AActor* EffectInstigator, float Magnitude)
+{
+    const float Duration = GetDurationFor(Element);
+
+    const int32 ExistingRow = FindRow(Target, Element);
+    if (ExistingRow != INDEX_NONE)
+    {
+        RemainingTimes[ExistingRow] = FMath::Max(RemainingTimes[ExistingRow], Duration);
+        Magnitudes[ExistingRow] = FMath::Max(Magnitudes[ExistingRow], Magnitude);
+        Instigators[ExistingRow] = EffectInstigator;
+        return;
+    }
+
+    UCharacterMovementComponent* MoveComp = nullptr;
+    if (ACharacter* Character = Cast<ACharacter>(Target))
+    {
+        MoveComp = Character->GetCharacterMovement();
+    }
+
+    Targets.Add(Target);
+    Instigators.Add(EffectInstigator);
+    HealthComponents.Add(Target->FindComponentByClass<UAC_HealthComponent>());
+    MovementComponents.Add(MoveComp);
+    Elements.Add(Element);
+    RemainingTimes.Add(Duration);
+    Magnitudes.Add(Magnitude);
+    TargetKeys.Add(Target);
+
+    // New rows go to the front of the target's chain
+    int32& FirstRow = FirstRowByTarget.FindOrAdd(Target, INDEX_NONE);
+    NextRowForTarget.Add(FirstRow);
+    FirstRow = Targets.Num() - 1;
+
+    WJ_EVENT(StatusEffectApplied, Target, static_cast<float>(Element), Magnitude, Duration);
+
+    WJ_COUNTER_INC(DelegateBroadcasts);
+    OnStatusEffectChanged.Broadcast(Target, Element, true);
+}
+
+void UStatusEffectSubsystem::RemoveRow(int32 RowIndex)
+{
+    if (!Targets.IsValidIndex(RowIndex))
+    {
+        return;
+    }
+
+    AActor* Target = Targets[RowIndex].Get();
+    const ESpellChannel Element = Elements[RowIndex];
+
+    // Unlink the row from its target's chain, dropping the target once it has no rows
+    const int32 NextRow = NextRowForTarget[RowIndex];
+    const int32* FirstRow = FirstRowByTarget.Find(TargetKeys[RowIndex]);
+    if (NextRow == INDEX_NONE && FirstRow && *FirstRow == RowIndex)
+    {
+        FirstRowByTarget.Remove(TargetKeys[RowIndex]);
+    }
+    else
+    {
+        RelinkRow(RowIndex, NextRow);
+    }
+
+    // The last row is about to be swapped into RowIndex
+    const int32 LastRow = Targets.Num() - 1;
+    if (RowIndex != LastRow)
+    {
+        RelinkRow(LastRow, RowIndex);
+    }
+
+    // Same swap on every array keeps rows aligned
+    Targets.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    Instigators.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    HealthComponents.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    MovementComponents.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    Elements.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    RemainingTimes.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    Magnitudes.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    TargetKeys.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+    NextRowForTarget.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+
+    if (Target)
+    {
+        WJ_COUNTER_INC(DelegateBroadcasts);
+        OnStatusEffectChanged.Broadcast(Target, Element, false);
+    }
+}
+
+void UStatusEffectSubsystem::RelinkRow(int32 FromRow, int32 ToRow)
+{
+    int32& FirstRow = FirstRowByTarget.FindChecked(TargetKeys[FromRow]);
+    if (FirstRow == FromRow)
+    {
+        FirstRow = ToRow;
+        return;
+    }
+
+    for (int32 Row = FirstRow; Row != INDEX_NONE; Row = NextRowForTarget[Row])
+    {
+        if (NextRowForTarget[Row] == FromRow)
+        {
+            NextRowForTarget[Row] = ToRow;
+            return;
+        }
+    }
+}
+
+float UStatusEffectSubsystem::GetDurationFor(ESpellChannel Element) const
+{
+    switch (Element)
+    {
+    case ESpellChannel::Flame:     return BurnDuration;
+    case ESpellChannel::Ice:       return FreezeDuration;
+    case ESpellChannel::Lightning: return ShockDuration;
+    case ESpellChannel::Arcane:    return ArcaneDuration;
+    default:                       return 0.0f;
+    }
+}
+
+void UStatusEffectSubsystem::ChainShock(AActor* PrimaryTarget, AActor* EffectInstigator, float Magnitude)
+{
+    UWorld* World = GetWorld();
+    if (!World || !PrimaryTarget || ShockChainMaxTargets <= 0 || ShockChainRadius <= 0.0f)
+    {
+        return;
+    }
+
+    const FVector Origin = PrimaryTarget->GetActorLocation();
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(StatusEffectChainShock), false);
+    QueryParams.AddIgnoredActor(PrimaryTarget);
+    if (EffectInstigator)
+    {
+        QueryParams.AddIgnoredActor(EffectInstigator);
+    }
+
+    TArray<FOverlapResult> Overlaps;
+    WJ_COUNTER_INC(Traces);
+    World->OverlapMultiByObjectType(
+        Overlaps,
+        Origin,
+        FQuat::Identity,
+        FCollisionObjectQueryParams(ECC_Pawn),
+        FCollisionShape::MakeSphere(ShockChainRadius),
+        QueryParams
+    );
+
+    // Collect valid candidates, then keep the closest N
+    struct FChainCandidate
+    {
+        UAC_HealthComponent* HealthComp;
+        float DistanceSq;
+    };
+
+    TArray<FChainCandidate, TInlineAllocator<8>> Candidates;
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        AActor* Candidate = Overlap.GetActor();
+        if (!Candidate)
+        {
+            continue;
+        }
+
+        if (EffectInstigator &&
+            FGenericTeamId::GetAttitude(EffectInstigator, Candidate) == ETeamAttitude::Friendly)
+        {
+            continue;
+        }
+
+        UAC_HealthComponent* HealthComp = Candidate->FindComponentByClass<UAC_HealthComponent>();
+        if (!HealthComp || !HealthComp->IsAlive())
+        {
+            continue;
+        }
+
+        // Multiple overlapping components on one actor share a health component
+        const bool bAlreadyAdded = Candidates.ContainsByPredicate(
+            [HealthComp](const FChainCandidate& Existing) { return Existing.HealthComp == HealthComp; });
+        if (!bAlreadyAdded)
+        {
+            Candidates.Add({ HealthComp, FVector::DistSquared(Origin, Candidate->GetActorLocation()) });
+        }
+    }
+
+    Candidates.Sort([](const FChainCandidate& A, const FChainCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+
+    const int32 ChainCount = FMath::Min(Candidates.Num(), ShockChainMaxTargets);
+    for (int32 Index = 0; Index < ChainCount; ++Index)
+    {
+        QueueDamage(Candidates[Index].HealthComp, ShockChainDamage * Magnitude, EffectInstigator);
+    }
+
+    UE_LOG(LogStatusEffects, Verbose, TEXT("[%s] Shock chained to %d target(s)"),
+        *PrimaryTarget->GetName(), ChainCount);
+}
+
+void UStatusEffectSubsystem::QueueDamage(UAC_HealthComponent* HealthComp, float Amount, AActor* Causer)
+{
+    if (!HealthComp || Amount <= 0.0f)
+    {
+        return;
+    }
+
+    FPendingDamage& Pending = PendingDamage.FindOrAdd(HealthComp, FPendingDamage{ 0.0f, nullptr });
+    Pending.Amount += Amount;
+    if (Causer)
+    {
+        Pending.Causer = Causer;
+    }
+}
+
+void UStatusEffectSubsystem::UpdateTimerState()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+
+    // Keep running while slows still need restoring or damage is queued
+    const bool bHasWork = Targets.Num() > 0 || PendingDamage.Num() > 0 || SlowedBaseSpeeds.Num() > 0;
+
+    if (bHasWork && !TimerManager.IsTimerActive(UpdateTimerHandle))
+    {
+        TimerManager.SetTimer(UpdateTimerHandle, this, &UStatusEffectSubsystem::ProcessEffects,
+            FMath::Max(UpdateInterval, 0.01f), true);
+    }
+    else if (!bHasWork)
+    {
+        TimerManager.ClearTimer(UpdateTimerHandle);
+    }
+}
+
+// ============================================================================
+// BATCHED UPDATE
+// ============================================================================
+
+void UStatusEffectSubsystem::ProcessEffects()
+{
+    WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_StatusEffects);
+
+    const float DeltaTime = FMath::Max(UpdateInterval, 0.01f);
+
+    SpeedMultiplierScratch.Reset();
+
+    // Reverse order so swap-removal never skips an unprocessed row
+    for (int32 Row = Targets.Num() - 1; Row >= 0; --Row)
+    {
+        if (!Targets[Row].IsValid())
+        {
+            RemoveRow(Row);
+            continue;
+        }
+
+        RemainingTimes[Row] -= DeltaTime;
+        const bool bExpired = RemainingTimes[Row] <= 0.0f;
+
+        switch (Elements[Row])
+        {
+        case ESpellChannel::Flame:
+            QueueDamage(HealthComponents[Row].Get(), BurnDamagePerSecond * Magnitudes[Row] * DeltaTime,
+                Instigators[Row].Get());
+            break;
+
+        case ESpellChannel::Ice:
+            if (!bExpired && MovementComponents[Row].IsValid())
+            {
+                const float SlowMultiplier = FMath::Clamp(
+                    1.0f - (1.0f - FreezeSpeedMultiplier) * Magnitudes[Row], 0.05f, 1.0f);
+                float& Strongest = SpeedMultiplierScratch.FindOrAdd(MovementComponents[Row], 1.0f);
+                Strongest = FMath::Min(Strongest, SlowMultiplier);
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (bExpired)
+        {
+            RemoveRow(Row);
+        }
+    }
+
+    FlushPendingDamage();
+    FlushSpeedMultipliers();
+    UpdateTimerState();
+}
+
+void UStatusEffectSubsystem::FlushPendingDamage()
+{
+    // Move out first - death handlers may apply new effects and queue more damage
+    TMap<TWeakObjectPtr<UAC_HealthComponent>, FPendingDamage> DamageToApply = MoveTemp(PendingDamage);
+    PendingDamage.Reset();
+
+    for (const TPair<TWeakObjectPtr<UAC_HealthComponent>, FPendingDamage>& Pair : DamageToApply)
+    {
+        UAC_HealthComponent* HealthComp = Pair.Key.Get();
+        if (HealthComp && HealthComp->IsAlive())
+        {
+            HealthComp->ApplyDamage(Pair.Value.Amount, Pair.Value.Causer.Get());
+        }
+    }
+}
+
+void UStatusEffectSubsystem::FlushSpeedMultipliers()
+{
+    // Remember base speed the first time a component is slowed
+    for (const TPair<TWeakObjectPtr<UCharacterMovementComponent>, float>& Pair : SpeedMultiplierScratch)
+    {
+        UCharacterMovementComponent* MoveComp = Pair.Key.Get();
+        if (MoveComp && !SlowedBaseSpeeds.Contains(Pair.Key))
+        {
+            SlowedBaseSpeeds.Add(Pair.Key, MoveComp->MaxWalkSpeed);
+        }
+    }
+
+    // One write per slowed component; restore and forget once no slow remains
+    // NOTE: other systems changing MaxWalkSpeed mid-slow are overridden until it expires
+    for (auto It = SlowedBaseSpeeds.CreateIterator(); It; ++It)
+    {
+        UCharacterMovementComponent* MoveComp = It.Key().Get();
+        if (!MoveComp)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        const float* Multiplier = SpeedMultiplierScratch.Find(It.Key());
+        MoveComp->MaxWalkSpeed = It.Value() * (Multiplier ? *Multiplier : 1.0f);
+
+        if (!Multiplier)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
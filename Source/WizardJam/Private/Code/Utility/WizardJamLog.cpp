@@ -0,0 +1,127 @@
+// WizardJamLog.cpp
+// Developer: Marcus Daley
+// Date: January 15, 2026
+// Project: WizardJam
+
+#include "Code/Utility/WizardJamLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+
+#if WIZARDJAM_EVENTLOG_ENABLED
+
+DEFINE_LOG_CATEGORY_STATIC(LogWizardJamEvents, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+// ============================================================================
+// STORAGE
+// ============================================================================
+
+FWizardJamEventRecord FWizardJamEventLog::Records[FWizardJamEventLog::Capacity] = {};
+uint32 FWizardJamEventLog::NumRecorded = 0;
+
+// ============================================================================
+// DUMP
+// ============================================================================
+
+void FWizardJamEventLog::Dump(FOutputDevice& Ar, int32 MaxEvents)
+{
+    const uint32 NumStored = FMath::Min(NumRecorded, Capacity);
+    const uint32 NumToWrite = MaxEvents > 0 ? FMath::Min(NumStored, static_cast<uint32>(MaxEvents)) : NumStored;
+
+    Ar.Logf(TEXT("========== WizardJam events (%u of %u recorded) =========="), NumToWrite, NumRecorded);
+
+    for (uint32 Sequence = NumRecorded - NumToWrite; Sequence != NumRecorded; ++Sequence)
+    {
+        const FWizardJamEventRecord& Entry = Records[Sequence & (Capacity - 1)];
+        Ar.Logf(TEXT("  %10.3f f%-8u %-18s %s(#%u) | %s: %.2f, %.2f, %.2f"),
+            Entry.Time,
+            Entry.Frame,
+            GetEventName(Entry.Event),
+            *Entry.ActorName.ToString(),
+            Entry.ActorId,
+            GetValueLabels(Entry.Event),
+            Entry.Values[0], Entry.Values[1], Entry.Values[2]);
+    }
+
+    Ar.Logf(TEXT("=========================================================="));
+}
+
+bool FWizardJamEventLog::DumpToFile(const FString& FileName)
+{
+    FString FilePath = FileName;
+    if (FPaths::IsRelative(FilePath))
+    {
+        FilePath = FPaths::Combine(FPaths::ProjectLogDir(), FilePath);
+    }
+
+    const uint32 NumStored = FMath::Min(NumRecorded, Capacity);
+
+    FString Text = TEXT("Time,Frame,Event,Actor,ActorId,A,B,C") LINE_TERMINATOR;
+    Text.Reserve(Text.Len() + NumStored * 96);
+
+    for (uint32 Sequence = NumRecorded - NumStored; Sequence != NumRecorded; ++Sequence)
+    {
+        const FWizardJamEventRecord& Entry = Records[Sequence & (Capacity - 1)];
+        Text += FString::Printf(TEXT("%.4f,%u,%s,%s,%u,%g,%g,%g") LINE_TERMINATOR,
+            Entry.Time,
+            Entry.Frame,
+            GetEventName(Entry.Event),
+            *Entry.ActorName.ToString(),
+            Entry.ActorId,
+            Entry.Values[0], Entry.Values[1], Entry.Values[2]);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Text, *FilePath))
+    {
+        UE_LOG(LogWizardJamEvents, Warning, TEXT("[WizardJamEvents] Cannot write event dump: %s"), *FilePath);
+        return false;
+    }
+
+    UE_LOG(LogWizardJamEvents, Display, TEXT("[WizardJamEvents] Wrote %u events to %s"), NumStored, *FilePath);
+    return true;
+}
+
+void FWizardJamEventLog::Reset()
+{
+    NumRecorded = 0;
+}
+
+// ============================================================================
+// NAMES
+// ============================================================================
+
+const TCHAR* FWizardJamEventLog::GetEventName(EWizardJamEvent Event)
+{
+    switch (Event)
+    {
+    case EWizardJamEvent::ProjectileLaunched:   return TEXT("ProjectileLaunched");
+    case EWizardJamEvent::ProjectileHit:        return TEXT("ProjectileHit");
+    case EWizardJamEvent::ProjectileDamage:     return TEXT("ProjectileDamage");
+    case EWizardJamEvent::DamageTaken:          return TEXT("DamageTaken");
+    case EWizardJamEvent::SpellAdded:           return TEXT("SpellAdded");
+    case EWizardJamEvent::FlightToggled:        return TEXT("FlightToggled");
+    case EWizardJamEvent::AgentAttack:          return TEXT("AgentAttack");
+    case EWizardJamEvent::StatusEffectApplied:  return TEXT("StatusEffectApplied");
+    case EWizardJamEvent::AoEDetonated:         return TEXT("AoEDetonated");
+    default:                                    return TEXT("Unknown");
+    }
+}
+
+const TCHAR* FWizardJamEventLog::GetValueLabels(EWizardJamEvent Event)
+{
+    switch (Event)
+    {
+    case EWizardJamEvent::ProjectileLaunched:   return TEXT("Speed/OwnerId/-");
+    case EWizardJamEvent::ProjectileHit:        return TEXT("HitActorId/ImpactX/ImpactY");
+    case EWizardJamEvent::ProjectileDamage:     return TEXT("Damage/HitActorId/-");
+    case EWizardJamEvent::DamageTaken:          return TEXT("Damage/Health/MaxHealth");
+    case EWizardJamEvent::SpellAdded:           return TEXT("TotalSpells/-/-");
+    case EWizardJamEvent::FlightToggled:        return TEXT("Flying/Stamina/Denied");
+    case EWizardJamEvent::AgentAttack:          return TEXT("TargetId/Damage/Projectile");
+    case EWizardJamEvent::StatusEffectApplied:  return TEXT("Element/Magnitude/Duration");
+    case EWizardJamEvent::AoEDetonated:         return TEXT("Radius/Overlaps/Victims");
+    default:                                    return TEXT("-/-/-");
+    }
+}
+
+#endif // WIZARDJAM_EVENTLOG_ENABLED
@@ -0,0 +1,559 @@
+// WizardJamMovementComponent.cpp
+// Predicted broom flight custom movement mode
+//
+// Developer: Marcus Daley
+// Date: January 10, 2026
+// Project: WizardJam
+
+#include "Code/Utility/WizardJamMovementComponent.h"
+#include "Code/Utility/AC_StaminaComponent.h"
+#include "GameFramework/Character.h"
+
+DEFINE_LOG_CATEGORY(LogWizardJamMovement);
+
+// ============================================================================
+// SAVED MOVE
+// Captures broom intents per move; 4 bits ride in the compressed flags byte
+// ============================================================================
+
+class FSavedMove_WizardJam : public FSavedMove_Character
+{
+public:
+    typedef FSavedMove_Character Super;
+
+    FSavedMove_WizardJam()
+        : bSavedWantsBroomFlight(0)
+        , bSavedWantsToAscend(0)
+        , bSavedWantsToDescend(0)
+        , bSavedWantsToBoost(0)
+        , SavedBroomStamina(0.0f)
+    {
+    }
+
+    virtual void Clear() override
+    {
+        Super::Clear();
+
+        bSavedWantsBroomFlight = 0;
+        bSavedWantsToAscend = 0;
+        bSavedWantsToDescend = 0;
+        bSavedWantsToBoost = 0;
+        SavedBroomStamina = 0.0f;
+    }
+
+    virtual uint8 GetCompressedFlags() const override
+    {
+        uint8 Result = Super::GetCompressedFlags();
+
+        if (bSavedWantsBroomFlight) Result |= FLAG_Custom_0;
+        if (bSavedWantsToAscend)    Result |= FLAG_Custom_1;
+        if (bSavedWantsToDescend)   Result |= FLAG_Custom_2;
+        if (bSavedWantsToBoost)     Result |= FLAG_Custom_3;
+
+        return Result;
+    }
+
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override
+    {
+        const FSavedMove_WizardJam* Other = static_cast<const FSavedMove_WizardJam*>(NewMove.Get());
+
+        // Only merge moves with identical broom intents
+        if (bSavedWantsBroomFlight != Other->bSavedWantsBroomFlight ||
+            bSavedWantsToAscend != Other->bSavedWantsToAscend ||
+            bSavedWantsToDescend != Other->bSavedWantsToDescend ||
+            bSavedWantsToBoost != Other->bSavedWantsToBoost)
+        {
+            return false;
+        }
+
+        return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+    }
+
+    virtual void SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel,
+        FNetworkPredictionData_Client_Character& ClientData) override
+    {
+        Super::SetMoveFor(Character, InDeltaTime, NewAccel, ClientData);
+
+        if (const UWizardJamMovementComponent* MoveComp =
+            Cast<UWizardJamMovementComponent>(Character->GetCharacterMovement()))
+        {
+            bSavedWantsBroomFlight = MoveComp->bWantsBroomFlight;
+            bSavedWantsToAscend = MoveComp->bWantsToAscend;
+            bSavedWantsToDescend = MoveComp->bWantsToDescend;
+            bSavedWantsToBoost = MoveComp->bWantsToBoost;
+            SavedBroomStamina = MoveComp->GetBroomStaminaAtMoveStart();
+        }
+    }
+
+    virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter,
+        APlayerController* PC, const FVector& OldStartLocation) override
+    {
+        Super::CombineWith(OldMove, InCharacter, PC, OldStartLocation);
+
+        // The pending move is redone as part of this one - undo its drain too
+        if (UWizardJamMovementComponent* MoveComp =
+            Cast<UWizardJamMovementComponent>(InCharacter->GetCharacterMovement()))
+        {
+            SavedBroomStamina = static_cast<const FSavedMove_WizardJam*>(OldMove)->SavedBroomStamina;
+            MoveComp->BroomStamina = SavedBroomStamina;
+        }
+    }
+
+    virtual void PrepMoveFor(ACharacter* Character) override
+    {
+        Super::PrepMoveFor(Character);
+
+        // Replays after a correction must see the intents of the original move
+        if (UWizardJamMovementComponent* MoveComp =
+            Cast<UWizardJamMovementComponent>(Character->GetCharacterMovement()))
+        {
+            MoveComp->bWantsBroomFlight = bSavedWantsBroomFlight;
+            MoveComp->bWantsToAscend = bSavedWantsToAscend;
+            MoveComp->bWantsToDescend = bSavedWantsToDescend;
+            MoveComp->bWantsToBoost = bSavedWantsToBoost;
+
+            // Stamina the move started with, so a replay drains from the same value
+            MoveComp->BroomStamina = SavedBroomStamina;
+        }
+    }
+
+    uint8 bSavedWantsBroomFlight : 1;
+    uint8 bSavedWantsToAscend : 1;
+    uint8 bSavedWantsToDescend : 1;
+    uint8 bSavedWantsToBoost : 1;
+    float SavedBroomStamina;
+};
+
+// ============================================================================
+// NETWORK MOVE DATA
+// Move-start stamina up to the server; the server's pool back on corrections
+// ============================================================================
+
+void FWizardJamNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    BroomStamina = static_cast<const FSavedMove_WizardJam&>(ClientMove).SavedBroomStamina;
+}
+
+bool FWizardJamNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar,
+    UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+    Ar << BroomStamina;
+    return !Ar.IsError();
+}
+
+void FWizardJamMoveResponseDataContainer::ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement,
+    const FClientAdjustment& PendingAdjustment)
+{
+    FCharacterMoveResponseDataContainer::ServerFillResponseData(CharacterMovement, PendingAdjustment);
+
+    BroomStamina = static_cast<const UWizardJamMovementComponent&>(CharacterMovement).GetBroomStamina();
+}
+
+bool FWizardJamMoveResponseDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar,
+    UPackageMap* PackageMap)
+{
+    if (!FCharacterMoveResponseDataContainer::Serialize(CharacterMovement, Ar, PackageMap))
+    {
+        return false;
+    }
+
+    // Acks stay as small as before; only corrections pay for the stamina
+    if (IsCorrection())
+    {
+        Ar << BroomStamina;
+    }
+    return !Ar.IsError();
+}
+
+class FNetworkPredictionData_Client_WizardJam : public FNetworkPredictionData_Client_Character
+{
+public:
+    typedef FNetworkPredictionData_Client_Character Super;
+
+    explicit FNetworkPredictionData_Client_WizardJam(const UCharacterMovementComponent& ClientMovement)
+        : Super(ClientMovement)
+    {
+    }
+
+    virtual FSavedMovePtr AllocateNewMove() override
+    {
+        return FSavedMovePtr(new FSavedMove_WizardJam());
+    }
+};
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+UWizardJamMovementComponent::UWizardJamMovementComponent()
+    : BroomFriction(2.0f)
+    , BroomFlySpeed(600.0f)
+    , BroomBoostSpeed(1200.0f)
+    , BroomVerticalSpeed(400.0f)
+    , BroomStaminaDrainRate(10.0f)
+    , BroomBoostStaminaDrainRate(25.0f)
+    , BroomMinStamina(20.0f)
+    , BroomStaminaTolerance(5.0f)
+    , bWantsBroomFlight(false)
+    , bWantsToAscend(false)
+    , bWantsToDescend(false)
+    , bWantsToBoost(false)
+    , BroomStamina(0.0f)
+    , StaminaComponent(nullptr)
+{
+    SetNetworkMoveDataContainer(MoveDataContainer);
+    SetMoveResponseDataContainer(MoveResponseDataContainer);
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+void UWizardJamMovementComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (AActor* Owner = GetOwner())
+    {
+        StaminaComponent = Owner->FindComponentByClass<UAC_StaminaComponent>();
+    }
+
+    if (!StaminaComponent)
+    {
+        UE_LOG(LogWizardJamMovement, Warning,
+            TEXT("[%s] No AC_StaminaComponent - broom flight will not drain stamina"),
+            *GetNameSafe(GetOwner()));
+    }
+}
+
+// ============================================================================
+// BROOM FLIGHT API
+// ============================================================================
+
+void UWizardJamMovementComponent::ConfigureBroomFlight(float InFlySpeed, float InBoostSpeed,
+    float InVerticalSpeed, float InDrainRate, float InBoostDrainRate, float InMinStamina)
+{
+    BroomFlySpeed = InFlySpeed;
+    BroomBoostSpeed = InBoostSpeed;
+    BroomVerticalSpeed = InVerticalSpeed;
+    BroomStaminaDrainRate = InDrainRate;
+    BroomBoostStaminaDrainRate = InBoostDrainRate;
+    BroomMinStamina = InMinStamina;
+}
+
+bool UWizardJamMovementComponent::IsBroomFlying() const
+{
+    return MovementMode == MOVE_Custom
+        && CustomMovementMode == static_cast<uint8>(EWizardJamMovementMode::Broom);
+}
+
+// ============================================================================
+// UCharacterMovementComponent OVERRIDES
+// ============================================================================
+
+float UWizardJamMovementComponent::GetMaxSpeed() const
+{
+    if (IsBroomFlying())
+    {
+        return bWantsToBoost ? BroomBoostSpeed : BroomFlySpeed;
+    }
+
+    return Super::GetMaxSpeed();
+}
+
+float UWizardJamMovementComponent::GetMaxBrakingDeceleration() const
+{
+    if (IsBroomFlying())
+    {
+        return BrakingDecelerationFlying;
+    }
+
+    return Super::GetMaxBrakingDeceleration();
+}
+
+void UWizardJamMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    bWantsBroomFlight = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+    bWantsToAscend = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+    bWantsToDescend = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+    bWantsToBoost = (Flags & FSavedMove_Character::FLAG_Custom_3) != 0;
+}
+
+FNetworkPredictionData_Client* UWizardJamMovementComponent::GetPredictionData_Client() const
+{
+    check(PawnOwner != nullptr);
+
+    if (ClientPredictionData == nullptr)
+    {
+        UWizardJamMovementComponent* MutableThis = const_cast<UWizardJamMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_WizardJam(*this);
+    }
+
+    return ClientPredictionData;
+}
+
+void UWizardJamMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+    Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+    // Out of flight the pool follows the stamina component. Replays keep the
+    // value PrepMoveFor restored - the component has moved on since
+    if (!IsBroomFlying() && !CharacterOwner->bClientUpdating)
+    {
+        BroomStamina = GetBroomStaminaAtMoveStart();
+    }
+
+    // Runs on the predicting client and on the server after flags are unpacked,
+    // so mode transitions happen on the same move on both ends
+    if (bWantsBroomFlight && !IsBroomFlying())
+    {
+        if (HasBroomStamina())
+        {
+            SetMovementMode(MOVE_Custom, static_cast<uint8>(EWizardJamMovementMode::Broom));
+        }
+        else
+        {
+            bWantsBroomFlight = false;
+        }
+    }
+    else if (!bWantsBroomFlight && IsBroomFlying())
+    {
+        SetMovementMode(MOVE_Falling);
+    }
+}
+
+void UWizardJamMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+    // Rebase before Super replays the unacked moves from their saved stamina
+    if (MoveResponse.IsCorrection())
+    {
+        ApplyBroomStaminaCorrection(
+            static_cast<const FWizardJamMoveResponseDataContainer&>(MoveResponse).BroomStamina,
+            MoveResponse.ClientAdjustment.TimeStamp);
+    }
+
+    Super::ClientHandleMoveResponse(MoveResponse);
+}
+
+void UWizardJamMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+    Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+    const bool bWasBroomFlying = PreviousMovementMode == MOVE_Custom
+        && PreviousCustomMode == static_cast<uint8>(EWizardJamMovementMode::Broom);
+
+    if (IsBroomFlying() && !bWasBroomFlying)
+    {
+        // Start level - vertical comes only from ascend/descend
+        Velocity.Z = 0.0f;
+        UpdateBroomStaminaDrain(0.0f);
+
+        UE_LOG(LogWizardJamMovement, Display, TEXT("[%s] Entered broom flight"),
+            *GetNameSafe(GetOwner()));
+    }
+    else if (bWasBroomFlying && !IsBroomFlying())
+    {
+        bWantsToAscend = false;
+        bWantsToDescend = false;
+        bWantsToBoost = false;
+
+        if (StaminaComponent && ShouldApplyBroomSideEffects())
+        {
+            StaminaComponent->SetSustainedDrainRate(0.0f);
+        }
+
+        UE_LOG(LogWizardJamMovement, Display, TEXT("[%s] Exited broom flight -> %s"),
+            *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(MovementMode));
+    }
+}
+
+// ============================================================================
+// BROOM PHYSICS
+// ============================================================================
+
+void UWizardJamMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+    if (CustomMovementMode == static_cast<uint8>(EWizardJamMovementMode::Broom))
+    {
+        PhysBroom(DeltaTime, Iterations);
+        return;
+    }
+
+    Super::PhysCustom(DeltaTime, Iterations);
+}
+
+void UWizardJamMovementComponent::PhysBroom(float DeltaTime, int32 Iterations)
+{
+    if (DeltaTime < MIN_TICK_TIME)
+    {
+        return;
+    }
+
+    // Stamina is checked inside the move so forced dismount is predicted
+    if (!HasBroomStamina())
+    {
+        bWantsBroomFlight = false;
+        SetMovementMode(MOVE_Falling);
+        if (ShouldApplyBroomSideEffects())
+        {
+            OnBroomStaminaExhausted.Broadcast();
+        }
+        StartNewPhysics(DeltaTime, Iterations);
+        return;
+    }
+
+    // Boost may have toggled this move - drain rate follows the move's flags
+    UpdateBroomStaminaDrain(DeltaTime);
+
+    RestorePreAdditiveRootMotionVelocity();
+
+    if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+    {
+        CalcVelocity(DeltaTime, BroomFriction, true, GetMaxBrakingDeceleration());
+
+        const float VerticalInput = (bWantsToAscend ? 1.0f : 0.0f) - (bWantsToDescend ? 1.0f : 0.0f);
+        Velocity.Z = VerticalInput * BroomVerticalSpeed;
+    }
+
+    ApplyRootMotionToVelocity(DeltaTime);
+
+    Iterations++;
+    bJustTeleported = false;
+
+    const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+    const FVector Adjusted = Velocity * DeltaTime;
+
+    FHitResult Hit(1.0f);
+    SafeMoveUpdatedComponent(Adjusted, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+    if (Hit.Time < 1.0f)
+    {
+        HandleImpact(Hit, DeltaTime, Adjusted);
+        SlideAlongSurface(Adjusted, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+    }
+
+    if (!bJustTeleported && !HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+    {
+        Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / DeltaTime;
+    }
+}
+
+// ============================================================================
+// STAMINA INTEGRATION
+// ============================================================================
+
+bool UWizardJamMovementComponent::HasBroomStamina() const
+{
+    // No stamina component = unlimited flight
+    return !StaminaComponent || BroomStamina >= BroomMinStamina;
+}
+
+float UWizardJamMovementComponent::GetBroomStaminaAtMoveStart() const
+{
+    if (IsBroomFlying() || !StaminaComponent)
+    {
+        return BroomStamina;
+    }
+
+    const float LocalStamina = StaminaComponent->GetCurrentStamina();
+
+    // Server running a remote client's move: start from the client's value so
+    // both ends decide flight entry alike, but never beyond what the server allows
+    if (CharacterOwner && CharacterOwner->HasAuthority() && !CharacterOwner->IsLocallyControlled())
+    {
+        if (const FWizardJamNetworkMoveData* MoveData =
+            static_cast<const FWizardJamNetworkMoveData*>(GetCurrentNetworkMoveData()))
+        {
+            return FMath::Clamp(MoveData->BroomStamina, 0.0f, LocalStamina + BroomStaminaTolerance);
+        }
+    }
+
+    return LocalStamina;
+}
+
+void UWizardJamMovementComponent::ApplyBroomStaminaCorrection(float ServerStamina, float CorrectionTimeStamp)
+{
+    FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+    if (!ClientData)
+    {
+        return;
+    }
+
+    // The first unacked move started where the corrected move ended on this client
+    int32 FirstUnacked = 0;
+    while (ClientData->SavedMoves.IsValidIndex(FirstUnacked)
+        && ClientData->SavedMoves[FirstUnacked]->TimeStamp <= CorrectionTimeStamp)
+    {
+        ++FirstUnacked;
+    }
+
+    const float ClientStamina = ClientData->SavedMoves.IsValidIndex(FirstUnacked)
+        ? static_cast<const FSavedMove_WizardJam*>(ClientData->SavedMoves[FirstUnacked].Get())->SavedBroomStamina
+        : BroomStamina;
+
+    // Within tolerance the server already took the client's value
+    const float Delta = ServerStamina - ClientStamina;
+    if (FMath::Abs(Delta) <= BroomStaminaTolerance)
+    {
+        return;
+    }
+
+    for (int32 Index = FirstUnacked; Index < ClientData->SavedMoves.Num(); ++Index)
+    {
+        FSavedMove_WizardJam* Move = static_cast<FSavedMove_WizardJam*>(ClientData->SavedMoves[Index].Get());
+        Move->SavedBroomStamina = FMath::Max(Move->SavedBroomStamina + Delta, 0.0f);
+    }
+    BroomStamina = FMath::Max(BroomStamina + Delta, 0.0f);
+
+    // Shift the local pool too, or the next move out of flight would seed from
+    // the old value and diverge again
+    if (StaminaComponent)
+    {
+        if (Delta > 0.0f)
+        {
+            StaminaComponent->RestoreStamina(Delta);
+        }
+        else
+        {
+            StaminaComponent->ConsumeStamina(FMath::Min(-Delta, StaminaComponent->GetCurrentStamina()));
+        }
+    }
+
+    UE_LOG(LogWizardJamMovement, Verbose, TEXT("[%s] Broom stamina corrected by %.1f"),
+        *GetNameSafe(GetOwner()), Delta);
+}
+
+void UWizardJamMovementComponent::UpdateBroomStaminaDrain(float DeltaTime)
+{
+    if (!StaminaComponent)
+    {
+        return;
+    }
+
+    // Drained by the move's own DeltaTime so client and server reach the
+    // exhaustion threshold on the same move
+    const float DrainRate = bWantsToBoost ? BroomBoostStaminaDrainRate : BroomStaminaDrainRate;
+    BroomStamina = FMath::Max(BroomStamina - DrainRate * DeltaTime, 0.0f);
+
+    // The component integrates the same rate analytically for the HUD; it only
+    // rebases when the rate actually changes (boost toggled)
+    if (ShouldApplyBroomSideEffects())
+    {
+        StaminaComponent->SetSustainedDrainRate(DrainRate);
+    }
+}
+
+bool UWizardJamMovementComponent::ShouldApplyBroomSideEffects() const
+{
+    // Replays after a correction re-run moves that already fired their events,
+    // and simulated proxies never own the stamina pool
+    return CharacterOwner
+        && !CharacterOwner->bClientUpdating
+        && (CharacterOwner->IsLocallyControlled() || CharacterOwner->HasAuthority());
+}
@@ -0,0 +1,303 @@
+// WizardJamStatsSubsystem.cpp
+// Developer: Marcus Daley
+// Date: January 14, 2026
+// Project: WizardJam
+
+#include "Code/Utility/WizardJamStatsSubsystem.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "Code/Utility/WizardJamStats.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogWizardJamStats, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+// ============================================================================
+// COUNTER STORAGE
+// ============================================================================
+
+#if WIZARDJAM_COUNTERS_ENABLED
+
+int32 FWizardJamCounters::Values[FWizardJamCounters::NumCounters] = {};
+int32 FWizardJamCounters::LastFrameValues[FWizardJamCounters::NumCounters] = {};
+FVector FWizardJamCounters::ViewLocation = FVector::ZeroVector;
+
+namespace
+{
+    uint64 LastRolloverFrame = 0;
+}
+
+bool FWizardJamCounters::RollOverFrame()
+{
+    if (LastRolloverFrame == GFrameCounter)
+    {
+        return false;
+    }
+    LastRolloverFrame = GFrameCounter;
+
+    for (int32 Index = 0; Index < NumCounters; ++Index)
+    {
+        if (IsPerFrame(static_cast<EWizardJamCounter>(Index)))
+        {
+            LastFrameValues[Index] = Values[Index];
+            Values[Index] = 0;
+        }
+    }
+    return true;
+}
+
+int32 FWizardJamCounters::Get(EWizardJamCounter Counter)
+{
+    const int32 Index = static_cast<int32>(Counter);
+    return IsPerFrame(Counter) ? LastFrameValues[Index] : Values[Index];
+}
+
+const TCHAR* FWizardJamCounters::GetName(EWizardJamCounter Counter)
+{
+    switch (Counter)
+    {
+    case EWizardJamCounter::LiveProjectiles:    return TEXT("LiveProjectiles");
+    case EWizardJamCounter::ProjectilesSpawned: return TEXT("ProjectilesSpawned");
+    case EWizardJamCounter::ProjectilesPooled:  return TEXT("ProjectilesPooled");
+    case EWizardJamCounter::AgentsTickingNear:  return TEXT("AgentsTickingNear");
+    case EWizardJamCounter::AgentsTickingMid:   return TEXT("AgentsTickingMid");
+    case EWizardJamCounter::AgentsTickingFar:   return TEXT("AgentsTickingFar");
+    case EWizardJamCounter::Traces:             return TEXT("Traces");
+    case EWizardJamCounter::DamageEvents:       return TEXT("DamageEvents");
+    case EWizardJamCounter::DelegateBroadcasts: return TEXT("DelegateBroadcasts");
+    case EWizardJamCounter::MIDsCreated:        return TEXT("MIDsCreated");
+    default:                                    return TEXT("Unknown");
+    }
+}
+
+bool FWizardJamCounters::IsPerFrame(EWizardJamCounter Counter)
+{
+    switch (Counter)
+    {
+    case EWizardJamCounter::AgentsTickingNear:
+    case EWizardJamCounter::AgentsTickingMid:
+    case EWizardJamCounter::AgentsTickingFar:
+    case EWizardJamCounter::Traces:
+    case EWizardJamCounter::DamageEvents:
+    case EWizardJamCounter::DelegateBroadcasts:
+        return true;
+    default:
+        return false;
+    }
+}
+
+#endif // WIZARDJAM_COUNTERS_ENABLED
+
+// ============================================================================
+// SUBSYSTEM LIFECYCLE
+// ============================================================================
+
+UWizardJamStatsSubsystem::UWizardJamStatsSubsystem()
+    : CsvSampleInterval(0.1f)
+    , CsvStartTime(0.0)
+    , NextCsvSampleTime(0.0)
+{
+    FMemory::Memzero(WindowPeakValues);
+}
+
+bool UWizardJamStatsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWizardJamStatsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+#if WIZARDJAM_COUNTERS_ENABLED
+    // Headless runs opt in from the command line
+    FString CsvFileName;
+    if (FParse::Value(FCommandLine::Get(), TEXT("WizardJamCountersCSV="), CsvFileName))
+    {
+        StartCSVCapture(CsvFileName);
+    }
+#endif
+}
+
+void UWizardJamStatsSubsystem::Deinitialize()
+{
+    StopCSVCapture();
+
+    Super::Deinitialize();
+}
+
+TStatId UWizardJamStatsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UWizardJamStatsSubsystem, STATGROUP_Tickables);
+}
+
+void UWizardJamStatsSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+#if WIZARDJAM_COUNTERS_ENABLED
+    if (FWizardJamCounters::RollOverFrame())
+    {
+        UpdateViewLocation();
+        RecordCsvProfilerStats();
+    }
+
+    if (!CsvFile)
+    {
+        return;
+    }
+
+    for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+    {
+        WindowPeakValues[Index] = FMath::Max(WindowPeakValues[Index], FWizardJamCounters::LastFrameValues[Index]);
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now >= NextCsvSampleTime)
+    {
+        WriteCSVRow();
+        NextCsvSampleTime = Now + CsvSampleInterval;
+    }
+#endif
+}
+
+// ============================================================================
+// COUNTER ACCESS
+// ============================================================================
+
+int32 UWizardJamStatsSubsystem::GetCounter(EWizardJamCounter Counter) const
+{
+#if WIZARDJAM_COUNTERS_ENABLED
+    return FWizardJamCounters::Get(Counter);
+#else
+    return 0;
+#endif
+}
+
+// ============================================================================
+// CSV CAPTURE
+// ============================================================================
+
+bool UWizardJamStatsSubsystem::StartCSVCapture(const FString& FileName)
+{
+#if WIZARDJAM_COUNTERS_ENABLED
+    StopCSVCapture();
+
+    FString FilePath = FileName;
+    if (FPaths::IsRelative(FilePath))
+    {
+        FilePath = FPaths::Combine(FPaths::ProfilingDir(), FilePath);
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+    CsvFile.Reset(PlatformFile.OpenWrite(*FilePath));
+    if (!CsvFile)
+    {
+        UE_LOG(LogWizardJamStats, Warning, TEXT("[WizardJamStats] Cannot open counters CSV: %s"), *FilePath);
+        return false;
+    }
+
+    // Header row: time, frame, then one column per counter
+    FString Header = TEXT("Time,Frame");
+    for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+    {
+        Header += TEXT(",");
+        Header += FWizardJamCounters::GetName(static_cast<EWizardJamCounter>(Index));
+    }
+    WriteCSVLine(Header);
+
+    FMemory::Memzero(WindowPeakValues);
+    CsvStartTime = FPlatformTime::Seconds();
+    NextCsvSampleTime = CsvStartTime;
+
+    UE_LOG(LogWizardJamStats, Display, TEXT("[WizardJamStats] Counters CSV capture started: %s"), *FilePath);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UWizardJamStatsSubsystem::StopCSVCapture()
+{
+    if (CsvFile)
+    {
+        CsvFile->Flush();
+        CsvFile.Reset();
+
+        UE_LOG(LogWizardJamStats, Display, TEXT("[WizardJamStats] Counters CSV capture stopped"));
+    }
+}
+
+bool UWizardJamStatsSubsystem::IsCapturingCSV() const
+{
+    return CsvFile.IsValid();
+}
+
+#if WIZARDJAM_COUNTERS_ENABLED
+
+void UWizardJamStatsSubsystem::RecordCsvProfilerStats()
+{
+#if CSV_PROFILER
+    // One value per counter per frame under -csvprofile, category "WizardJam"
+    static const TArray<FName> StatNames = []()
+    {
+        TArray<FName> Names;
+        for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+        {
+            Names.Add(FName(FWizardJamCounters::GetName(static_cast<EWizardJamCounter>(Index))));
+        }
+        return Names;
+    }();
+
+    for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+    {
+        FCsvProfiler::RecordCustomStat(StatNames[Index], CSV_CATEGORY_INDEX(WizardJam),
+            FWizardJamCounters::Get(static_cast<EWizardJamCounter>(Index)), ECsvCustomStatOp::Set);
+    }
+#endif
+}
+
+void UWizardJamStatsSubsystem::UpdateViewLocation()
+{
+    UWorld* World = GetWorld();
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PC)
+    {
+        return;
+    }
+
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(FWizardJamCounters::ViewLocation, ViewRotation);
+}
+
+void UWizardJamStatsSubsystem::WriteCSVRow()
+{
+    // Per-frame columns hold the peak since the previous row so short
+    // spikes are not lost between samples
+    FString Row = FString::Printf(TEXT("%.3f,%llu"), FPlatformTime::Seconds() - CsvStartTime, (uint64)GFrameCounter);
+    for (int32 Index = 0; Index < FWizardJamCounters::NumCounters; ++Index)
+    {
+        const EWizardJamCounter Counter = static_cast<EWizardJamCounter>(Index);
+        const int32 Value = FWizardJamCounters::IsPerFrame(Counter)
+            ? WindowPeakValues[Index]
+            : FWizardJamCounters::Values[Index];
+        Row += FString::Printf(TEXT(",%d"), Value);
+    }
+    WriteCSVLine(Row);
+
+    FMemory::Memzero(WindowPeakValues);
+}
+
+void UWizardJamStatsSubsystem::WriteCSVLine(const FString& Line)
+{
+    const FString LineWithEnding = Line + LINE_TERMINATOR;
+    const FTCHARToUTF8 Utf8(*LineWithEnding);
+    CsvFile->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+#endif // WIZARDJAM_COUNTERS_ENABLED
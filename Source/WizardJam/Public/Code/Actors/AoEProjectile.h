@@ -0,0 +1,96 @@
+// ============================================================================
+// AoEProjectile.h
+// Developer: Marcus Daley
+// Date: January 9, 2026
+// Project: WizardJam
+// Purpose:
+// Area-of-effect spell projectile. Flies like ABaseProjectile but detonates
+// on hit (or optionally on lifetime expiry) into radius damage.
+//
+// Detonation cost is one physics overlap query: victims are gathered from a
+// single sphere overlap, de-duplicated, team-filtered, sorted by distance,
+// capped at MaxTargets, and then damaged in one batch.
+//
+// Designer Usage:
+// 1. Create Blueprint child (BP_Projectile_Fireball, etc.)
+// 2. Set BlastRadius and MaxTargets
+// 3. Optionally assign DamageFalloffCurve (X = distance 0..1 of radius,
+//    Y = damage scale). Without a curve damage falls off linearly to
+//    MinFalloffScale at the edge.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Code/Actors/BaseProjectile.h"
+#include "Engine/EngineTypes.h"
+#include "AoEProjectile.generated.h"
+
+class UCurveFloat;
+
+// Broadcast after a detonation with the number of actors damaged
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+    FOnProjectileDetonated,
+    ABaseProjectile*, Projectile,
+    int32, VictimCount
+);
+
+UCLASS()
+class WIZARDJAM_API AAoEProjectile : public ABaseProjectile
+{
+    GENERATED_BODY()
+
+public:
+    AAoEProjectile();
+
+    // Detonate at a location - safe to call from Blueprint for manual triggers
+    UFUNCTION(BlueprintCallable, Category = "Projectile|AoE")
+    int32 Detonate(const FVector& Origin);
+
+    UPROPERTY(BlueprintAssignable, Category = "Projectile|Events")
+    FOnProjectileDetonated OnDetonated;
+
+protected:
+    // Replaces single-target damage with a radius detonation
+    virtual void HandleHit_Implementation(AActor* HitActor, const FHitResult& HitResult) override;
+
+    // Detonates in place when bDetonateOnExpire is set
+    virtual void OnLifetimeExpired() override;
+
+    // Damage scale for a normalized distance (0 = center, 1 = edge)
+    float GetFalloffScale(float NormalizedDistance) const;
+
+    // ========================================================================
+    // CONFIGURATION
+    // ========================================================================
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE",
+        meta = (ClampMin = "1.0"))
+    float BlastRadius;
+
+    // Hard cap on victims per detonation - closest targets win
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE",
+        meta = (ClampMin = "1"))
+    int32 MaxTargets;
+
+    // Optional falloff: X = distance / BlastRadius, Y = damage scale
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE")
+    UCurveFloat* DamageFalloffCurve;
+
+    // Edge damage scale for the linear fallback when no curve is assigned
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE",
+        meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MinFalloffScale;
+
+    // Object types gathered by the overlap query
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE")
+    TArray<TEnumAsByte<EObjectTypeQuery>> VictimObjectTypes;
+
+    // Detonate when lifetime runs out instead of fizzling
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|AoE")
+    bool bDetonateOnExpire;
+
+private:
+    // Guards against a second detonation from overlapping hit + expiry
+    bool bHasDetonated;
+};
@@ -40,6 +40,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/Actors/BaseCharacter.h"
 #include "Code/Utility/EnemyInterface.h"
 #include "BaseAgent.generated.h"
@@ -49,7 +50,7 @@ class UMaterialInstanceDynamic;
 class AAIC_BaseAgentAIController;
 class UBehaviorTree;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogBaseAgent, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogBaseAgent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // DELEGATES
@@ -147,6 +148,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
     // ========================================================================
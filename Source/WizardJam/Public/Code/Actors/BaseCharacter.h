@@ -31,6 +31,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/Character.h"
 #include "Code/Actors/InputCharacter.h"
 #include "Code/Utility/TeleportInterface.h"
@@ -41,7 +42,7 @@
 class UAC_HealthComponent;
 class UAC_StaminaComponent;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogBaseCharacter, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogBaseCharacter, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // SPELL COLLECTION DELEGATES
@@ -75,7 +76,7 @@ class WIZARDJAM_API ABaseCharacter : public AInputCharacter, public ITeleportInt
     GENERATED_BODY()
 
 public:
-    ABaseCharacter();
+    ABaseCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
     // ========================================================================
     // COMPONENT ACCESSORS
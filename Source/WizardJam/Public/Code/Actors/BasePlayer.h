@@ -34,6 +34,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/Actors/BaseCharacter.h"
 #include "Code/Utility/ISpellCollector.h"
 #include "BasePlayer.generated.h"
@@ -47,7 +48,7 @@ class ABaseProjectile;
 enum class EAimTraceResult : uint8;
 enum class EFireBlockedReason : uint8;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogBasePlayer, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogBasePlayer, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // DELEGATES
@@ -77,7 +78,8 @@ class WIZARDJAM_API ABasePlayer : public ABaseCharacter, public ISpellCollector
     GENERATED_BODY()
 
 public:
-    ABasePlayer();
+    // Uses UWizardJamMovementComponent for predicted broom flight
+    ABasePlayer(const FObjectInitializer& ObjectInitializer);
 
     // ========================================================================
     // ISpellCollector Interface
@@ -260,4 +262,19 @@ public:
 
     UFUNCTION(Exec)
     void Debug_ListSpells();
+
+    UFUNCTION(Exec)
+    void Debug_TogglePerfOverlay();
+
+    // Start (non-empty file name, relative to Saved/Profiling) or stop counter CSV capture
+    UFUNCTION(Exec)
+    void Debug_CountersCSV(const FString& FileName);
+
+    // Print the newest Count gameplay events (0 = whole ring buffer) to the log
+    UFUNCTION(Exec)
+    void Debug_DumpEvents(int32 Count);
+
+    // Write the gameplay event ring buffer as CSV (relative to Saved/Logs)
+    UFUNCTION(Exec)
+    void Debug_DumpEventsCSV(const FString& FileName);
 };
\ No newline at end of file
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/Actor.h"
 #include "GenericTeamAgentInterface.h"
 #include "BaseProjectile.generated.h"
@@ -29,7 +30,7 @@ class UNiagaraComponent;
 class UNiagaraSystem;
 class UParticleSystem;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogBaseProjectile, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogBaseProjectile, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // Delegate for projectile hit events
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
@@ -115,6 +116,12 @@ protected:
         meta = (ClampMin = "1.0"))
     float CollisionRadius;
 
+    // Strength of the elemental status effect applied on hit (0 disables)
+    // Element comes from SpellElement - see UStatusEffectSubsystem
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Combat",
+        meta = (ClampMin = "0.0"))
+    float StatusEffectMagnitude;
+
     // Niagara effects
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Effects|Niagara")
     UNiagaraSystem* TrailNiagaraSystem;
@@ -164,7 +171,9 @@ protected:
 
     bool bDidHitSomething;
 
+    // Called when LifetimeSeconds elapses without a hit - default destroys
+    virtual void OnLifetimeExpired();
+
 private:
     FTimerHandle LifetimeTimerHandle;
-    void OnLifetimeExpired();
 };
\ No newline at end of file
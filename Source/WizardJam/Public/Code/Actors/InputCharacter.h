@@ -34,6 +34,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/Character.h"
 #include "InputActionValue.h"
 #include "InputCharacter.generated.h"
@@ -43,7 +44,7 @@ class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogInputCharacter, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogInputCharacter, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 UCLASS()
 class WIZARDJAM_API AInputCharacter : public ACharacter
@@ -51,7 +52,8 @@ class WIZARDJAM_API AInputCharacter : public ACharacter
     GENERATED_BODY()
 
 public:
-    AInputCharacter();
+    // ObjectInitializer form lets children swap the movement component class
+    AInputCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
     virtual void BeginPlay() override;
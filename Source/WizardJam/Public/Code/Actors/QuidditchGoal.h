@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/Actor.h"
 #include "Code/Utility/SpellChannelTypes.h"
 #include "GenericTeamAgentInterface.h"
@@ -11,7 +12,7 @@ class UBoxComponent;
 class UStaticMeshComponent;
 class ABaseProjectile;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogQuidditchGoal, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogQuidditchGoal, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // Delegate broadcast when goal is scored
 // Parameters: ScoringActor (who scored), Element (spell type), PointsAwarded, bWasCorrectElement
@@ -90,6 +91,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void PostInitializeComponents() override;
 
 private:
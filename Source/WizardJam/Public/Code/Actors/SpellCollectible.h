@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Code/Actors/CollectiblePickup.h"
 #include "SpellCollectible.generated.h"
 
@@ -41,7 +42,7 @@ class UMaterialInterface;
 class UStaticMeshComponent;
 class USoundBase;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogSpellCollectible, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogSpellCollectible, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // STATIC DELEGATE
@@ -119,6 +120,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Spell|Requirements")
     TArray<FName> GetMissingChannels(AActor* Actor) const;
 
+    // First missing required channel, NAME_None if none (no array built)
+    UFUNCTION(BlueprintPure, Category = "Spell|Requirements")
+    FName GetFirstMissingChannel(AActor* Actor) const;
+
     // ========================================================================
     // INSTANCE DELEGATES
     // ========================================================================
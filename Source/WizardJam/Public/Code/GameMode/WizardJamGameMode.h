@@ -30,6 +30,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/GameModeBase.h"
 #include "WizardJamGameMode.generated.h"
 
@@ -38,7 +39,7 @@ class ASpellCollectible;
 class UAC_SpellCollectionComponent;
 class AQuidditchGoal;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogWizardJamGameMode, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogWizardJamGameMode, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // STATIC DELEGATE (For C++ Listeners like HUD)
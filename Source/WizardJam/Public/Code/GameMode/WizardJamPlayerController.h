@@ -22,13 +22,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "GameFramework/PlayerController.h"
 #include "WizardJamPlayerController.generated.h"
 
 class UWizardJamHUDWidget;
 class UInputMappingContext;
 class UEnhancedInputLocalPlayerSubsystem;
-DECLARE_LOG_CATEGORY_EXTERN(LogWizardJamController, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogWizardJamController, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // WIZARDJAM PLAYER CONTROLLER
@@ -0,0 +1,141 @@
+// ============================================================================
+// HUDViewModel.h
+// Developer: Marcus Daley
+// Date: January 13, 2026
+// Project: WizardJam
+// ============================================================================
+// Purpose:
+// Plain-value view-model between gameplay delegates and UWizardJamHUDWidget.
+// Delegate handlers only write values here; a setter that receives the value
+// already stored does nothing, otherwise it raises a dirty bit. The widget
+// applies dirty fields at most once per frame from NativeTick, so a burst of
+// broadcasts in one frame costs one widget write, and unchanged values never
+// reach Slate (no needless invalidation).
+//
+// No UObject, no widget pointers - safe to fill before widgets exist.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// One bit per independently applied HUD field
+enum class EHUDDirtyField : uint16
+{
+    None         = 0,
+    Health       = 1 << 0,
+    Stamina      = 1 << 1,
+    StaminaColor = 1 << 2,
+    Flight       = 1 << 3,
+    Boost        = 1 << 4,
+    SpellSlots   = 1 << 5,
+    SpellCount   = 1 << 6
+};
+ENUM_CLASS_FLAGS(EHUDDirtyField)
+
+struct FWizardJamHUDViewModel
+{
+    // ========================================================================
+    // VALUES
+    // ========================================================================
+
+    float Health = 0.0f;
+    float MaxHealth = 0.0f;
+
+    float Stamina = 0.0f;
+    float MaxStamina = 0.0f;
+
+    FLinearColor StaminaColor = FLinearColor::White;
+
+    bool bFlying = false;
+    bool bBoosting = false;
+
+    int32 CollectedSpellCount = 0;
+
+    // Unlock state per configured spell, and which of those changed
+    TMap<FName, bool> SpellUnlocked;
+    TSet<FName> DirtySpellSlots;
+
+    EHUDDirtyField DirtyFields = EHUDDirtyField::None;
+
+    // ========================================================================
+    // SETTERS - raise a dirty bit only when the value actually changes
+    // ========================================================================
+
+    void SetHealth(float InHealth, float InMaxHealth)
+    {
+        if (InHealth != Health || InMaxHealth != MaxHealth)
+        {
+            Health = InHealth;
+            MaxHealth = InMaxHealth;
+            DirtyFields |= EHUDDirtyField::Health;
+        }
+    }
+
+    void SetStamina(float InStamina, float InMaxStamina)
+    {
+        if (InStamina != Stamina || InMaxStamina != MaxStamina)
+        {
+            Stamina = InStamina;
+            MaxStamina = InMaxStamina;
+            DirtyFields |= EHUDDirtyField::Stamina;
+        }
+    }
+
+    void SetStaminaColor(const FLinearColor& InColor)
+    {
+        if (!InColor.Equals(StaminaColor))
+        {
+            StaminaColor = InColor;
+            DirtyFields |= EHUDDirtyField::StaminaColor;
+        }
+    }
+
+    void SetFlying(bool bInFlying)
+    {
+        if (bInFlying != bFlying)
+        {
+            bFlying = bInFlying;
+            DirtyFields |= EHUDDirtyField::Flight;
+        }
+    }
+
+    void SetBoosting(bool bInBoosting)
+    {
+        if (bInBoosting != bBoosting)
+        {
+            bBoosting = bInBoosting;
+            DirtyFields |= EHUDDirtyField::Boost;
+        }
+    }
+
+    void SetCollectedSpellCount(int32 InCount)
+    {
+        if (InCount != CollectedSpellCount)
+        {
+            CollectedSpellCount = InCount;
+            DirtyFields |= EHUDDirtyField::SpellCount;
+        }
+    }
+
+    // First write for a spell always counts as a change so the slot is initialized
+    void SetSpellUnlocked(FName SpellTypeName, bool bUnlocked)
+    {
+        bool* Existing = SpellUnlocked.Find(SpellTypeName);
+        if (!Existing || *Existing != bUnlocked)
+        {
+            SpellUnlocked.Add(SpellTypeName, bUnlocked);
+            DirtySpellSlots.Add(SpellTypeName);
+            DirtyFields |= EHUDDirtyField::SpellSlots;
+        }
+    }
+
+    // Force a field to re-apply (e.g. after widgets were rebuilt)
+    void MarkDirty(EHUDDirtyField Fields) { DirtyFields |= Fields; }
+
+    bool IsDirty(EHUDDirtyField Field) const { return EnumHasAnyFlags(DirtyFields, Field); }
+    void ClearDirty(EHUDDirtyField Field) { EnumRemoveFlags(DirtyFields, Field); }
+    bool HasAnyDirty() const { return DirtyFields != EHUDDirtyField::None; }
+
+    void Reset() { *this = FWizardJamHUDViewModel(); }
+};
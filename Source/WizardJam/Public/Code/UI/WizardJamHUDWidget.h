@@ -11,8 +11,12 @@
 //
 // Modular Architecture:
 // - SpellSlotConfigs: Designer-editable array of FSpellSlotConfig
-// - SpellSlotWidgets: TMap linking FName spell type to UImage widget
+// - SlotWidgets: Fixed slot table resolved once at construct (row per config)
 // - QuidditchWidget: Optional child widget for Quidditch-specific UI
+// - PerfOverlayWidget: Optional debug counters overlay (non-Shipping)
+// - ViewModel: Delegate handlers write plain values with dirty bits; widgets
+//   are written at most once per frame in NativeTick, and only when the
+//   displayed value actually changed
 //
 // Designer Workflow:
 // 1. Open WBP_PlayerHUD Blueprint
@@ -20,6 +24,12 @@
 // 3. Fill SpellSlotConfigs array with spell definitions (Flame, Ice, Lightning, Arcane)
 // 4. Assign locked/unlocked textures per spell
 // 5. System auto-matches spell collection events to slot configs
+// 6. Static frame/labels sit in an InvalidationBox named
+//    "StaticLayoutInvalidationBox" and the slot images in one named
+//    "SpellSlotInvalidationBox" (or a RetainerBox "StaticLayoutRetainer"
+//    with Render on Invalidation). If the Blueprint has no such panels,
+//    NativeOnInitialized wraps the root and SpellSlotContainer at runtime
+//    so only the bars repaint during combat.
 //
 // Widget Naming Convention:
 // - SpellSlot_X where X = SlotIndex from FSpellSlotConfig
@@ -32,6 +42,8 @@
 #include "Blueprint/UserWidget.h"
 #include "Code/UI/SpellSlotConfig.h"
 #include "Code/UI/WizardJamQuidditchWidget.h"
+#include "Code/UI/WizardJamPerfOverlayWidget.h"
+#include "Code/UI/HUDViewModel.h"
 #include "WizardJamHUDWidget.generated.h"
 
 // Forward declarations
@@ -43,6 +55,8 @@ class UProgressBar;
 class UImage;
 class UTextBlock;
 class UPanelWidget;
+class UInvalidationBox;
+class URetainerBox;
 
 
 UCLASS()
@@ -51,6 +65,8 @@ class WIZARDJAM_API UWizardJamHUDWidget : public UUserWidget
     GENERATED_BODY()
 
 public:
+    UWizardJamHUDWidget(const FObjectInitializer& ObjectInitializer);
+
     // ========================================================================
     // DESIGNER CONFIGURATION - SPELL SLOTS
     // Fill this array in Blueprint to define available spell types
@@ -77,6 +93,24 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Quidditch")
     bool bShowQuidditchOnStart;
 
+    // ========================================================================
+    // DESIGNER CONFIGURATION - DEBUG
+    // ========================================================================
+
+    // Gameplay performance counter overlay, created on first show
+    // Ignored in Shipping (counters are compiled out)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Debug")
+    TSubclassOf<UWizardJamPerfOverlayWidget> PerfOverlayWidgetClass;
+
+    // ========================================================================
+    // DESIGNER CONFIGURATION - UPDATE RATE
+    // ========================================================================
+
+    // Minimum seconds between rewrites of the "X / Y" health and stamina text
+    // (bars still update every frame). 0 = every frame.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HUD|Update", meta = (ClampMin = "0.0"))
+    float StatTextUpdateInterval;
+
     // ========================================================================
     // PUBLIC FUNCTIONS - RUNTIME CONTROL
     // ========================================================================
@@ -91,6 +125,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Quidditch")
     bool IsQuidditchUIVisible() const;
 
+    // Show or hide the performance counter overlay at runtime
+    UFUNCTION(BlueprintCallable, Category = "Debug")
+    void TogglePerfOverlay();
+
+    UFUNCTION(BlueprintPure, Category = "Debug")
+    bool IsPerfOverlayVisible() const;
+
     // Manually refresh all spell slots (useful after loading save data)
     UFUNCTION(BlueprintCallable, Category = "Spell Slots")
     void RefreshAllSpellSlots();
@@ -100,9 +141,13 @@ protected:
     // LIFECYCLE
     // ========================================================================
 
+    virtual void NativeOnInitialized() override;
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
 
+    // Samples moving health/stamina segments and applies dirty view-model fields
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
     // ========================================================================
     // COMPONENT REFERENCES (Cached at construction)
     // ========================================================================
@@ -156,18 +201,48 @@ protected:
     UPROPERTY(meta = (BindWidgetOptional))
     UTextBlock* OutOfStaminaWarningText;
 
+    // Cached panels - static layout and spell slots only repaint on change
+    UPROPERTY(meta = (BindWidgetOptional))
+    UInvalidationBox* StaticLayoutInvalidationBox;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UInvalidationBox* SpellSlotInvalidationBox;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    URetainerBox* StaticLayoutRetainer;
+
     // ========================================================================
     // RUNTIME STATE - SPELL SLOTS
     // ========================================================================
 
-    // Maps spell type name to the Image widget displaying it
-    // Populated at startup by scanning SpellSlotContainer for SpellSlot_X widgets
+    // Fixed slot table, one row per valid SpellSlotConfigs entry, resolved
+    // once at construct. Row widget may be null if SpellSlot_X is missing.
     UPROPERTY()
-    TMap<FName, UImage*> SpellSlotWidgets;
+    TArray<UImage*> SlotWidgets;
+
+    // Row -> index into SpellSlotConfigs (parallel to SlotWidgets)
+    TArray<int32> SlotConfigIndices;
 
-    // Maps spell type name to its config for fast lookup
-    // Populated from SpellSlotConfigs array at startup
-    TMap<FName, FSpellSlotConfig> SpellConfigLookup;
+    // Spell type name -> row, for channel events
+    TMap<FName, int32> SlotRowBySpell;
+
+    // ========================================================================
+    // RUNTIME STATE - VIEW MODEL
+    // ========================================================================
+
+    // Values pushed by delegate handlers, applied to widgets in NativeTick
+    FWizardJamHUDViewModel ViewModel;
+
+    // Last values actually written to widgets (skip identical writes)
+    float AppliedHealthPercent;
+    float AppliedStaminaPercent;
+    int32 AppliedHealthBand;
+    FIntPoint AppliedHealthText;
+    FIntPoint AppliedStaminaText;
+
+    // World time each stat text may next be rewritten
+    double NextHealthTextTime;
+    double NextStaminaTextTime;
 
     // ========================================================================
     // RUNTIME STATE - QUIDDITCH
@@ -177,6 +252,10 @@ protected:
     UPROPERTY()
     UWizardJamQuidditchWidget* QuidditchWidget;
 
+    // Runtime instance of the perf overlay (created on first TogglePerfOverlay)
+    UPROPERTY()
+    UWizardJamPerfOverlayWidget* PerfOverlayWidget;
+
     // ========================================================================
     // COMPONENT INITIALIZATION
     // ========================================================================
@@ -197,12 +276,36 @@ protected:
     // Build lookup maps and find slot widgets
     void InitializeSpellSlotSystem();
 
-    // Find Image widget by slot index (searches for "SpellSlot_X" in container)
-    UImage* FindSpellSlotWidget(int32 SlotIndex);
+    // One pass over SpellSlotContainer mapping "SpellSlot_X" -> X, with a
+    // widget tree lookup only for configured indices still missing
+    void ResolveSpellSlotWidgets(TMap<int32, UImage*>& OutWidgetsBySlotIndex) const;
+
+    // Update a single slot-table row's texture based on unlock state
+    void UpdateSpellSlotVisual(int32 Row, bool bIsUnlocked);
 
-    // Update a single spell slot's texture based on unlock state
-    void UpdateSpellSlotVisual(FName SpellTypeName, bool bIsUnlocked);
     void UpdateSpellCountText();
+
+    // Wrap the root and SpellSlotContainer in invalidation boxes the Blueprint lacks
+    void WrapMissingInvalidationPanels();
+
+    // Enable caching on the optional invalidation/retainer panels
+    void ConfigureInvalidationPanels();
+
+    // ========================================================================
+    // VIEW MODEL APPLICATION
+    // ========================================================================
+
+    // Forget what was written so the next apply rewrites every field
+    void ResetAppliedState();
+
+    // Write dirty fields to widgets - called once per frame
+    void ApplyViewModel();
+
+    // Return false while a throttled text write is still pending
+    bool ApplyHealth(double Now);
+    bool ApplyStamina(double Now);
+    void ApplySpellSlots();
+
     // ========================================================================
     // QUIDDITCH INITIALIZATION
     // ========================================================================
@@ -0,0 +1,98 @@
+// ============================================================================
+// WizardJamPerfOverlayWidget.h
+// Developer: Marcus Daley
+// Date: January 14, 2026
+// Project: WizardJam
+// ============================================================================
+// Purpose:
+// Debug overlay showing live gameplay performance counters fed by
+// UWizardJamStatsSubsystem: live projectiles, pooled vs spawned, ticking
+// agents per LOD bucket, traces / damage events / delegate broadcasts per
+// frame, and MIDs created. Created and toggled by WizardJamHUDWidget the same
+// way as the Quidditch widget. Never created in Shipping (counters compile out).
+//
+// Designer Workflow:
+// 1. Create WBP_PerfOverlay Blueprint (parent: WizardJamPerfOverlayWidget)
+// 2. Add TextBlocks named: LiveProjectilesText, ProjectileSourceText,
+//    AgentLODText, TracesText, DamageEventsText, BroadcastsText, MIDsText
+//    (all optional - missing ones are skipped)
+// 3. In WBP_PlayerHUD, set PerfOverlayWidgetClass to WBP_PerfOverlay
+//
+// Runtime Control:
+// - Console: Debug_TogglePerfOverlay
+// - WizardJamHUDWidget::TogglePerfOverlay()
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "WizardJamPerfOverlayWidget.generated.h"
+
+// Forward declarations
+class UTextBlock;
+
+UCLASS()
+class WIZARDJAM_API UWizardJamPerfOverlayWidget : public UUserWidget
+{
+    GENERATED_BODY()
+
+public:
+    UWizardJamPerfOverlayWidget(const FObjectInitializer& ObjectInitializer);
+
+protected:
+    // ========================================================================
+    // LIFECYCLE
+    // ========================================================================
+
+    virtual void NativeConstruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+    // ========================================================================
+    // WIDGET REFERENCES (Bound in Blueprint via BindWidgetOptional)
+    // ========================================================================
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* LiveProjectilesText;
+
+    // "pooled / spawned"
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* ProjectileSourceText;
+
+    // "near / mid / far"
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* AgentLODText;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* TracesText;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* DamageEventsText;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* BroadcastsText;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock* MIDsText;
+
+    // ========================================================================
+    // DESIGNER CONFIGURATION
+    // ========================================================================
+
+    // Seconds between text refreshes; per-frame counters show the peak
+    // frame seen in each window
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Debug",
+        meta = (ClampMin = "0.05"))
+    float RefreshInterval;
+
+private:
+    // Track per-frame peaks every tick, write text once per RefreshInterval
+    void SamplePeaks();
+    void RefreshText();
+
+    // Per-frame counter peaks since the last refresh
+    int32 PeakValues[static_cast<int32>(EWizardJamCounter::Count)];
+
+    float TimeSinceRefresh;
+};
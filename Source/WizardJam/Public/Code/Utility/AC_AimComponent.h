@@ -41,19 +41,27 @@
 // 3. Set TraceChannel (typically ECC_Visibility)
 // 4. Configure CrosshairScreenPosition if not using center
 // 5. Optionally enable bAutoUpdateOnTick for periodic broadcasts
+// 6. Optionally enable bUseAsyncTrace so periodic updates don't block the
+//    game thread (one frame of latency; "stat WizardJam" compares cost)
+// 7. Optionally enable bEnableAimAssist (or call SetAimAssistEnabled from
+//    input when a gamepad is in use) for soft-lock on registered targets
 // ============================================================================
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "Code/Utility/CameraTraceSubsystem.h"
+#include "Code/Utility/AimAssistSubsystem.h"
 #include "AC_AimComponent.generated.h"
 
 // Forward declarations keep header lightweight
 class APlayerController;
 class AActor;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogAimComponent, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogAimComponent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // ENUMS
@@ -68,7 +76,8 @@ enum class EAimTraceResult : uint8
     Friendly     UMETA(DisplayName = "Friendly Actor"),
     Enemy        UMETA(DisplayName = "Enemy Actor"),
     Interactable UMETA(DisplayName = "Interactable Object"),
-    Self         UMETA(DisplayName = "Self (Blocked)")
+    Self         UMETA(DisplayName = "Self (Blocked)"),
+    AimAssist    UMETA(DisplayName = "Aim Assist Target")
 };
 
 // ============================================================================
@@ -212,14 +221,24 @@ public:
 
     // Request fresh aim data - performs raycast and broadcasts if changed
     // Call this from systems that need current aim data
+    // Player traces come from the shared UCameraTraceSubsystem: SameFrame
+    // reuses this frame's crosshair trace, ExactView re-traces if the camera
+    // moved since (use for firing)
     // Returns the fresh aim data for convenience
     UFUNCTION(BlueprintCallable, Category = "Aim|Update")
-    FAimTraceData RequestAimUpdate();
+    FAimTraceData RequestAimUpdate(ECameraTraceStaleness Staleness = ECameraTraceStaleness::SameFrame);
 
     // Force broadcast of current aim state (useful for late-binding listeners)
     UFUNCTION(BlueprintCallable, Category = "Aim|Update")
     void BroadcastCurrentState();
 
+    // Toggle aim assist at runtime (input layer enables it for gamepad)
+    UFUNCTION(BlueprintCallable, Category = "Aim|Assist")
+    void SetAimAssistEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintPure, Category = "Aim|Assist")
+    bool IsAimAssistEnabled() const { return bEnableAimAssist; }
+
     // ========================================================================
     // DELEGATES - Bind to these for Observer pattern updates
     // ========================================================================
@@ -290,6 +309,23 @@ protected:
         meta = (EditCondition = "bAutoUpdateOnTick", ClampMin = "0.016"))
     float AutoUpdateInterval;
 
+    // ========================================================================
+    // AIM ASSIST
+    // Tuning (cone, range, soft-lock) lives in UAimAssistSubsystem config
+    // ========================================================================
+
+    // Bend the aim onto the best UAimAssistSubsystem target near the
+    // crosshair when the raw trace is not already on a target
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aim|Assist")
+    bool bEnableAimAssist;
+
+    // Issue auto-updates as async traces consumed on the next frame instead
+    // of blocking the game thread. Aim feedback lags one frame; firing still
+    // forces a synchronous trace.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aim|AutoUpdate",
+        meta = (EditCondition = "bAutoUpdateOnTick"))
+    bool bUseAsyncTrace;
+
 private:
     // ========================================================================
     // CACHED STATE
@@ -310,12 +346,50 @@ private:
     // Timer for auto-update interval
     float AutoUpdateTimer;
 
+    // Soft-lock state for UAimAssistSubsystem queries
+    FAimAssistState AimAssistState;
+
+    // In-flight async trace (invalid when none pending)
+    FTraceHandle AsyncTraceHandle;
+
+    // End point of the in-flight trace, used when it misses
+    FVector AsyncTraceEnd;
+
+    // Frame the async trace was issued
+    uint64 AsyncTraceIssueFrame;
+
+    // Frame of the last synchronous update - newer than an async request
+    // means the async result is discarded
+    uint64 LastSyncTraceFrame;
+
     // ========================================================================
     // INTERNAL HELPERS
     // ========================================================================
 
     // Perform raycast and populate aim data
-    void PerformAimTrace(FAimTraceData& OutData) const;
+    void PerformAimTrace(FAimTraceData& OutData, ECameraTraceStaleness Staleness) const;
+
+    // Crosshair ray for players, actor forward for AI
+    void BuildAimRay(ECameraTraceStaleness Staleness, FVector& OutStart, FVector& OutEnd) const;
+
+    // Query params shared by sync and async traces
+    FCollisionQueryParams MakeAimQueryParams() const;
+
+    // Convert a trace hit (or miss) into aim data
+    void FillAimData(FAimTraceData& OutData, bool bHit, const FHitResult& HitResult, const FVector& TraceEnd) const;
+
+    // Replace aim point with the aim assist target when one qualifies
+    void ApplyAimAssist(FAimTraceData& InOutData);
+
+    // Store new aim data, update blocked state and broadcast changes
+    void ApplyAimData(const FAimTraceData& NewData);
+
+    // Async auto-update: issue this frame, consume next frame
+    void IssueAsyncAimTrace();
+    void ConsumeAsyncAimTrace();
+
+    // Sync auto-update: blocking trace of the same ray the async path uses
+    void PerformSyncAimSample();
 
     // Classify what type of actor was hit
     EAimTraceResult ClassifyHitActor(AActor* HitActor) const;
@@ -1,5 +1,5 @@
 // AC_BroomComponent.h
-// Broom flight system - spawn-on-demand with full HUD integration
+// Broom flight system - persistent broom visual with full HUD integration
 //
 // Developer: Marcus Daley
 // Date: January 1, 2026
@@ -11,10 +11,22 @@
 // - OnForcedDismount (depletion feedback)
 // - OnBoostStateChanged (boost indicator)
 // - GetFlightStaminaPercent() (stamina display)
+//
+// BROOM VISUAL:
+// BroomVisualClass is a soft reference async-loaded at BeginPlay. The visual
+// actor is created once, attached to MountSocketName, and shown/hidden on
+// mount/dismount instead of being spawned and destroyed every time.
+//
+// MOVEMENT:
+// Flight physics live in UWizardJamMovementComponent's Broom custom mode.
+// This component forwards input intents (flight, ascend, descend, boost) to
+// the movement component, which packs them into saved moves for prediction
+// and applies stamina drain/exhaustion inside the simulated move.
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Components/ActorComponent.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
@@ -22,11 +34,12 @@
 
 // Forward declarations
 class UAC_StaminaComponent;
-class UCharacterMovementComponent;
+class UWizardJamMovementComponent;
 class UEnhancedInputComponent;
 class UEnhancedInputLocalPlayerSubsystem;
+struct FStreamableHandle;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogBroomComponent, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogBroomComponent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // Broadcast when flight state changes (for UI: show/hide broom icon)
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFlightStateChanged, bool, bIsFlying);
@@ -88,15 +101,24 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-        FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // ========================================================================
-    // BROOM VISUAL SPAWNING
+    // BROOM VISUAL (PERSISTENT)
     // ========================================================================
 
-    void SpawnBroomVisual();
-    void DestroyBroomVisual();
+    // Start async load of BroomVisualClass
+    void RequestBroomVisualClassLoad();
+
+    // Async load callback - creates the hidden visual
+    void OnBroomVisualClassLoaded();
+
+    // Spawn the visual once, attach to socket, start hidden
+    bool CreateBroomVisual();
+
+    // Toggle visibility (creates on demand if the class finished loading late)
+    void ShowBroomVisual();
+    void HideBroomVisual();
 
     // ========================================================================
     // INPUT BINDING
@@ -124,8 +146,6 @@ protected:
     // FLIGHT MECHANICS
     // ========================================================================
 
-    void ApplyVerticalMovement(float DeltaTime);
-    void SetMovementMode(bool bFlying);
     void UpdateInputContext(bool bAddContext);
     bool HasSufficientStamina() const;
     void ForceDismount();
@@ -134,20 +154,16 @@ protected:
     // STAMINA INTEGRATION
     // ========================================================================
 
-    void DrainStamina(float DeltaTime);
-
-    // Callback when stamina changes
-    // MUST match AC_StaminaComponent::OnStaminaChanged signature:
-    // DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStaminaChanged, AActor*, Owner, float, NewStamina, float, Delta)
-    UFUNCTION()
-    void OnStaminaChanged(AActor* Owner, float NewStamina, float Delta);
+    // Movement component ended flight inside a simulated move (stamina too low)
+    void HandleStaminaExhausted();
 
     // ========================================================================
     // CONFIGURATION
     // ========================================================================
 
+    // Soft reference so the broom Blueprint is not loaded with the character
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Broom|Visuals")
-    TSubclassOf<AActor> BroomVisualClass;
+    TSoftClassPtr<AActor> BroomVisualClass;
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Broom|Input")
     UInputMappingContext* FlightMappingContext;
@@ -195,15 +211,19 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Broom|State")
     bool bIsBoosting;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Broom|State")
-    float CurrentVerticalVelocity;
-
     // ========================================================================
-    // SPAWNED ACTOR REFERENCE
+    // BROOM VISUAL REFERENCE
     // ========================================================================
 
+    // Created once per character, hidden while grounded
     UPROPERTY()
-    AActor* SpawnedBroomVisual;
+    AActor* BroomVisual;
+
+    // Keeps the async-loaded class resident
+    TSharedPtr<FStreamableHandle> BroomClassLoadHandle;
+
+    // Binding on UWizardJamMovementComponent::OnBroomStaminaExhausted
+    FDelegateHandle StaminaExhaustedHandle;
 
     // ========================================================================
     // COMPONENT REFERENCES
@@ -213,7 +233,7 @@ protected:
     UAC_StaminaComponent* StaminaComponent;
 
     UPROPERTY()
-    UCharacterMovementComponent* MovementComponent;
+    UWizardJamMovementComponent* MovementComponent;
 
     UPROPERTY()
     APlayerController* PlayerController;
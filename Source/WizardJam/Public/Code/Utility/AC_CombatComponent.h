@@ -45,6 +45,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Components/ActorComponent.h"
 #include "AC_CombatComponent.generated.h"
 
@@ -54,7 +55,7 @@ class USceneComponent;
 class USkeletalMeshComponent;
 class ABaseProjectile;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogCombatComponent, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogCombatComponent, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // ENUMS
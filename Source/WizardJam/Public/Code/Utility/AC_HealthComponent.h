@@ -15,6 +15,12 @@
 // 2. Call Initialize(MaxHealth) in BeginPlay or use EditDefaultsOnly MaxHealth
 // 3. Bind to OnHealthChanged for HUD updates
 // 4. Bind to OnDeath for death handling
+// 5. Optional: set HealthRegenRate > 0 for out-of-combat regeneration
+//
+// REGENERATION:
+// Tick-free like AC_StaminaComponent - health is CurrentHealth at
+// SegmentStartTime plus regen after RegenStartTime, evaluated on demand.
+// One timer fires at the next boundary (regen start or full) to broadcast.
 
 #pragma once
 
@@ -75,6 +81,11 @@ public:
     UFUNCTION(BlueprintPure, Category = "Health")
     float GetHealthPercent() const;
 
+    // Active regen rate per second (0 during regen delay, when full, or dead)
+    // HUD bars use this to interpolate between OnHealthChanged broadcasts
+    UFUNCTION(BlueprintPure, Category = "Health")
+    float GetHealthRegenRate() const;
+
     // Delegates - bind to these for health updates
     UPROPERTY(BlueprintAssignable, Category = "Health|Events")
     FOnHealthChanged OnHealthChanged;
@@ -95,13 +106,42 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Health", meta = (ClampMin = "0.0"))
     float MaxHealth;
 
-    // Current health - visible but not editable
+    // Health regenerated per second after RegenDelay (0 disables regen)
+    UPROPERTY(EditDefaultsOnly, Category = "Health|Regen", meta = (ClampMin = "0.0"))
+    float HealthRegenRate;
+
+    // Seconds after taking damage before regen starts
+    UPROPERTY(EditDefaultsOnly, Category = "Health|Regen", meta = (ClampMin = "0.0"))
+    float HealthRegenDelay;
+
+    // Health at SegmentStartTime - visible but not editable
     UPROPERTY(VisibleAnywhere, Category = "Health")
     float CurrentHealth;
 
 private:
+    // Current world time, 0 if no world
+    double GetNow() const;
+
+    // Evaluate the regen segment at a given time
+    float EvaluateHealthAt(double Time) const;
+
+    // Fold accumulated regen into CurrentHealth and start a new segment at now
+    void FoldRegenSegment();
+
+    // Schedule the timer for the next regen boundary (regen start or full)
+    void ScheduleRegenBoundary();
+
+    // Timer callback - folds regen and broadcasts the new value
+    void HandleRegenBoundary();
+
     UPROPERTY()
     AActor* OwnerActor;
 
     bool bIsInitialized;
+
+    // Regen segment timing
+    double SegmentStartTime;
+    double RegenStartTime;
+
+    FTimerHandle RegenBoundaryTimer;
 };
\ No newline at end of file
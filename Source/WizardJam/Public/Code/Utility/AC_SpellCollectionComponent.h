@@ -37,10 +37,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
 #include "Components/ActorComponent.h"
 #include "AC_SpellCollectionComponent.generated.h"
 
-DECLARE_LOG_CATEGORY_EXTERN(LogSpellCollection, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogSpellCollection, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
 
 // ============================================================================
 // DELEGATES
@@ -184,6 +185,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Spells")
     TArray<FName> GetAllSpells() const;
 
+    // C++ read-only view of the collected spells - prefer this over
+    // GetAllSpells on gameplay paths, it does not copy
+    const TSet<FName>& GetSpellSet() const { return CollectedSpells; }
+
     // Get count of unique spells collected
     UFUNCTION(BlueprintPure, Category = "Spells")
     int32 GetSpellCount() const;
@@ -215,6 +220,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Spells|Channels")
     TArray<FName> GetAllChannels() const;
 
+    // C++ read-only view of the unlocked channels (no copy)
+    const TSet<FName>& GetChannelSet() const { return UnlockedChannels; }
+
+    // Get count of unlocked channels (no array copy)
+    UFUNCTION(BlueprintPure, Category = "Spells|Channels")
+    int32 GetChannelCount() const;
+
     // Clear all channels
     UFUNCTION(BlueprintCallable, Category = "Spells|Channels")
     void ClearAllChannels();
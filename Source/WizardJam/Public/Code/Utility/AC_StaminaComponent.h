@@ -15,12 +15,23 @@
 // - Added RestoreStamina() for pickups/buffs
 // - Added comprehensive logging
 // - Constructor initialization list format
+// - Tick-free: stamina is a piecewise-linear segment (value at time T + rate)
+//   evaluated on demand, with one timer per segment boundary
 //
 // USAGE:
 // 1. Add component to any actor needing stamina
 // 2. Bind to OnStaminaChanged for HUD updates
 // 3. Call SetSprinting(true/false) from movement input
 // 4. Call ConsumeStamina() for abilities (spells, dash, etc.)
+// 5. Call SetSustainedDrainRate() for continuous costs (broom flight)
+//
+// SEGMENT MODEL:
+// Stamina is stored as SegmentBaseStamina at SegmentStartTime plus SegmentRate.
+// Any state change (sprint, drain, consume, restore) rebases the segment at
+// the current time. A single timer fires at the next boundary (depleted, full,
+// or regen delay elapsed) so idle characters cost zero ticks. OnStaminaChanged
+// fires once per rebase; listeners that want smooth bars read GetStaminaRate()
+// and interpolate locally.
 
 #pragma once
 
@@ -95,7 +106,7 @@ public:
 
     /**
      * Check if actor has enough stamina to sprint
-     * @return True if CurrentStamina > 0
+     * @return True if current stamina > 0
      */
     UFUNCTION(BlueprintPure, Category = "Stamina")
     bool CanSprint() const;
@@ -106,6 +117,14 @@ public:
     UFUNCTION(BlueprintPure, Category = "Stamina")
     bool IsSprinting() const { return bIsSprinting; }
 
+    /**
+     * Set a continuous drain applied on top of sprinting (e.g. broom flight)
+     * Pass 0 to clear. Regen delay restarts when the drain stops.
+     * @param DrainPerSecond - Stamina removed per second (positive value)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Stamina")
+    void SetSustainedDrainRate(float DrainPerSecond);
+
     // ========== ABILITY USAGE ==========
 
     /**
@@ -129,23 +148,40 @@ public:
     UFUNCTION(BlueprintPure, Category = "Stamina")
     float GetStaminaPercent() const;
 
+    /**
+     * Evaluate the current segment at the current world time
+     */
     UFUNCTION(BlueprintPure, Category = "Stamina")
-    float GetCurrentStamina() const { return CurrentStamina; }
+    float GetCurrentStamina() const;
 
     UFUNCTION(BlueprintPure, Category = "Stamina")
     float GetMaxStamina() const { return MaxStamina; }
 
+    /**
+     * Rate of change of the active segment (negative while draining)
+     * HUD bars use this to interpolate between OnStaminaChanged broadcasts
+     */
+    UFUNCTION(BlueprintPure, Category = "Stamina")
+    float GetStaminaRate() const { return SegmentRate; }
+
+    /**
+     * Seconds until stamina reaches Threshold on the active segment
+     * @return Seconds until crossing, or -1 if the segment never reaches it
+     */
+    UFUNCTION(BlueprintPure, Category = "Stamina")
+    float GetTimeUntilStamina(float Threshold) const;
+
     /**
      * Check if stamina is full
      */
     UFUNCTION(BlueprintPure, Category = "Stamina")
-    bool IsStaminaFull() const { return CurrentStamina >= MaxStamina; }
+    bool IsStaminaFull() const { return GetCurrentStamina() >= MaxStamina; }
 
     /**
      * Check if stamina is empty
      */
     UFUNCTION(BlueprintPure, Category = "Stamina")
-    bool IsStaminaDepleted() const { return CurrentStamina <= 0.0f; }
+    bool IsStaminaDepleted() const { return GetCurrentStamina() <= 0.0f; }
 
     // ========== DELEGATES ==========
 
@@ -168,10 +204,6 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Stamina", meta = (ClampMin = "0.0"))
     float MaxStamina;
 
-    /** Current stamina - visible for debugging but not editable */
-    UPROPERTY(VisibleAnywhere, Category = "Stamina")
-    float CurrentStamina;
-
 protected:
     virtual void BeginPlay() override;
 
@@ -189,21 +221,52 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Stamina", meta = (ClampMin = "0.0"))
     float RegenDelay;
 
-    // ========== INTERNAL STATE ==========
+    // ========== SEGMENT STATE ==========
+
+    /** Stamina at SegmentStartTime - visible for debugging but not editable */
+    UPROPERTY(VisibleAnywhere, Category = "Stamina|Segment")
+    float SegmentBaseStamina;
+
+    /** Rate applied since SegmentStartTime (per second) */
+    UPROPERTY(VisibleAnywhere, Category = "Stamina|Segment")
+    float SegmentRate;
+
+    /** World time the active segment started */
+    double SegmentStartTime;
+
+    /** World time regeneration may begin (drain end + RegenDelay) */
+    double RegenStartTime;
+
+    /** Continuous drain from other systems (broom flight) */
+    float SustainedDrainRate;
 
     bool bIsSprinting;
-    float RegenDelayTimer;
+
+    /** Fires at the next segment boundary (depleted, full, regen start) */
+    FTimerHandle SegmentBoundaryTimer;
 
     UPROPERTY()
     AActor* OwnerActor;
 
-public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-        FActorComponentTickFunction* ThisTickFunction) override;
-
 private:
-    /** Internal method to apply stamina change and broadcast */
-    void ApplyStaminaChange(float Delta);
+    /** Current world time, 0 if no world */
+    double GetNow() const;
+
+    /** Evaluate the active segment at a given time, clamped to [0, Max] */
+    float EvaluateAt(double Time) const;
+
+    /** Total drain per second from sprinting and sustained sources */
+    float GetTotalDrainRate() const;
+
+    /**
+     * Close the active segment at the current time and open a new one
+     * Picks the new rate, schedules the boundary timer, broadcasts change
+     * @param Delta - Discrete change to apply at the rebase point
+     */
+    void Rebase(float Delta);
+
+    /** Timer callback at a segment boundary */
+    void HandleSegmentBoundary();
 
     /** Check if broadcast thresholds are crossed */
     void CheckThresholds(float OldStamina, float NewStamina);
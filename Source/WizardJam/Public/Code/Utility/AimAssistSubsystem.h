@@ -0,0 +1,151 @@
+// AimAssistSubsystem.h
+// Registry and cone query for controller aim assist / soft-lock
+//
+// Developer: Marcus Daley
+// Date: January 12, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Aim assist without a fan of line traces. Targetable actors (agents, goals,
+// the Snitch) register here and are binned into a coarse spatial grid. The
+// cone query only visits grid cells overlapping the cone's bounds and rejects
+// whole cells by their angular extent before scoring individual targets by
+// angle and distance. Line of sight is confirmed with a single trace per
+// frame, for the best candidate only.
+//
+// SOFT-LOCK:
+// The last confirmed target is kept while it stays inside a wider release
+// cone and gets a score bonus, so the assist does not flicker between two
+// targets near the crosshair. A candidate that fails line of sight is skipped
+// for a few frames so the next best gets its trace.
+//
+// USAGE:
+// 1. Targets: RegisterTarget(this) in BeginPlay, UnregisterTarget(this) in EndPlay
+// 2. Aim: FindAssistTarget(ViewOrigin, ViewDirection, Viewer, State, AimPoint)
+//    with an FAimAssistState owned by the caller (UAC_AimComponent)
+// 3. Tuning lives in DefaultGame.ini under [/Script/WizardJam.AimAssistSubsystem]
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AimAssistSubsystem.generated.h"
+
+// Per-viewer soft-lock state, owned by the querying component
+struct FAimAssistState
+{
+    TWeakObjectPtr<AActor> LockedTarget;
+    TWeakObjectPtr<AActor> OccludedTarget;
+    uint64 OccludedUntilFrame = 0;
+
+    // Result of the last query, reused for repeat queries in the same frame
+    uint64 LastQueryFrame = 0;
+    TWeakObjectPtr<AActor> LastResult;
+    FVector LastAimPoint = FVector::ZeroVector;
+};
+
+UCLASS(Config = Game)
+class WIZARDJAM_API UAimAssistSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UAimAssistSubsystem();
+
+    virtual void Deinitialize() override;
+
+    // ========================================================================
+    // REGISTRY
+    // ========================================================================
+
+    UFUNCTION(BlueprintCallable, Category = "Aim Assist")
+    void RegisterTarget(AActor* Target);
+
+    UFUNCTION(BlueprintCallable, Category = "Aim Assist")
+    void UnregisterTarget(AActor* Target);
+
+    UFUNCTION(BlueprintPure, Category = "Aim Assist")
+    int32 GetRegisteredTargetCount() const { return TargetCells.Num(); }
+
+    // ========================================================================
+    // QUERY
+    // ========================================================================
+
+    /**
+     * Best assist target inside the view cone with confirmed line of sight
+     * Runs at most one trace per frame per State; repeat calls in the same
+     * frame return the cached answer
+     * @param ViewOrigin - Camera ray start
+     * @param ViewDirection - Camera ray direction (normalized)
+     * @param Viewer - Pawn doing the aiming (ignored by LOS, used for team filter)
+     * @param State - Caller-owned soft-lock state
+     * @param OutAimPoint - Where to aim on the returned target
+     * @return Target actor, or nullptr if none qualifies this frame
+     */
+    AActor* FindAssistTarget(const FVector& ViewOrigin, const FVector& ViewDirection,
+        AActor* Viewer, FAimAssistState& State, FVector& OutAimPoint);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ========================================================================
+    // CONFIGURATION (DefaultGame.ini)
+    // ========================================================================
+
+    // Maximum distance a target can be assisted from
+    UPROPERTY(Config)
+    float AssistRange;
+
+    // Half angle of the acquisition cone around the crosshair
+    UPROPERTY(Config)
+    float ConeHalfAngleDegrees;
+
+    // Locked target stays locked inside ConeHalfAngle * this
+    UPROPERTY(Config)
+    float LockReleaseAngleScale;
+
+    // Locked target's score is multiplied by this (lower wins)
+    UPROPERTY(Config)
+    float LockedScoreScale;
+
+    // 0..1 weight of angle vs distance in candidate score
+    UPROPERTY(Config)
+    float AngleWeight;
+
+    // Grid cell edge length in world units
+    UPROPERTY(Config)
+    float CellSize;
+
+    // Seconds between re-binning moving targets into grid cells
+    UPROPERTY(Config)
+    float RefreshInterval;
+
+    // Frames a candidate that failed line of sight is skipped
+    UPROPERTY(Config)
+    int32 OcclusionRetryFrames;
+
+private:
+    FIntVector GetCell(const FVector& Location) const;
+    FVector GetCellCenter(const FIntVector& Cell) const;
+
+    void AddToCell(AActor* Target, const FIntVector& Cell);
+    void RemoveFromCell(AActor* Target, const FIntVector& Cell);
+
+    // Re-bin targets that moved and drop destroyed ones
+    void RefreshTargetCells();
+    void UpdateRefreshTimer();
+
+    // Cheapest-first candidate search, no traces
+    AActor* FindBestCandidate(const FVector& ViewOrigin, const FVector& ViewDirection,
+        AActor* Viewer, const FAimAssistState& State) const;
+
+    bool HasLineOfSight(const FVector& ViewOrigin, AActor* Target, AActor* Viewer) const;
+
+    // Grid cell -> targets binned there
+    TMap<FIntVector, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>>> Cells;
+
+    // Target -> cell it is currently binned in
+    TMap<TWeakObjectPtr<AActor>, FIntVector> TargetCells;
+
+    FTimerHandle RefreshTimerHandle;
+};
@@ -0,0 +1,140 @@
+// CameraTraceSubsystem.h
+// Shared per-frame crosshair trace for local player controllers
+//
+// Developer: Marcus Daley
+// Date: January 11, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Aim, interaction and fire all ask the same question: "what is under the
+// crosshair?" Each used to fetch the viewport, deproject and run its own line
+// trace on its own timer. This subsystem deprojects once per frame per
+// controller and keeps one trace result per collision channel. Shorter
+// queries on the same channel are answered from the longer cached trace
+// (a hit beyond the requested range reads as a miss), so interaction range
+// checks reuse the aim trace instead of re-tracing.
+//
+// STALENESS RULES:
+// - SameFrame  : Reuse anything traced this frame (GFrameCounter). Use for
+//                aim feedback, crosshair color, interaction focus.
+// - ExactView  : Reuse only if the camera view point has not moved since the
+//                cached trace. Use for fire, where muzzle alignment must match
+//                the crosshair the player sees right now.
+// Nothing carries across frames except the longest distance requested per
+// channel, which sizes the next frame's single trace.
+//
+// USAGE:
+// 1. UCameraTraceSubsystem* Traces = GetWorld()->GetSubsystem<UCameraTraceSubsystem>();
+// 2. FCameraTraceResult Result;
+//    Traces->TraceFromCamera(PC, FVector2D(0.5f, 0.5f), Range, ECC_Visibility,
+//        ECameraTraceStaleness::SameFrame, Result);
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "CameraTraceSubsystem.generated.h"
+
+class APlayerController;
+
+// How old a cached camera trace may be before it must be re-run
+UENUM(BlueprintType)
+enum class ECameraTraceStaleness : uint8
+{
+    SameFrame   UMETA(DisplayName = "Same Frame"),
+    ExactView   UMETA(DisplayName = "Exact Camera View")
+};
+
+// Result of a crosshair trace clamped to the caller's requested range
+struct FCameraTraceResult
+{
+    FVector TraceStart;
+    FVector TraceDirection;
+    FVector TraceEnd;
+    FHitResult Hit;
+    bool bHit;
+    bool bFromCache;
+
+    FCameraTraceResult()
+        : TraceStart(FVector::ZeroVector)
+        , TraceDirection(FVector::ForwardVector)
+        , TraceEnd(FVector::ZeroVector)
+        , bHit(false)
+        , bFromCache(false)
+    {
+    }
+};
+
+UCLASS()
+class WIZARDJAM_API UCameraTraceSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UCameraTraceSubsystem();
+
+    /**
+     * Trace from the controller's camera through a screen position
+     * Served from this frame's cache when the staleness rule allows it
+     * @param PC - Local player controller owning the view
+     * @param ScreenFraction - Crosshair position (0.5, 0.5 = center)
+     * @param MaxDistance - Caller's range; hits beyond it are reported as misses
+     * @param Channel - Collision channel to trace
+     * @param Staleness - How fresh the cached view and hit must be
+     * @param OutResult - Ray and hit, clamped to MaxDistance
+     * @return false if PC is null (no ray could be built)
+     */
+    bool TraceFromCamera(APlayerController* PC, const FVector2D& ScreenFraction, float MaxDistance,
+        ECollisionChannel Channel, ECameraTraceStaleness Staleness, FCameraTraceResult& OutResult);
+
+    /**
+     * Resolve the crosshair ray without tracing (for callers issuing their own
+     * async trace). Shares the per-frame deprojection with TraceFromCamera.
+     * @return false if PC is null
+     */
+    bool GetCameraRay(APlayerController* PC, const FVector2D& ScreenFraction,
+        ECameraTraceStaleness Staleness, FVector& OutStart, FVector& OutDirection);
+
+    // Lifetime counters for profiling how much sharing the cache achieves
+    uint32 GetTraceCount() const { return TraceCount; }
+    uint32 GetCacheHitCount() const { return CacheHitCount; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // One trace per channel, reused by every query this frame
+    struct FChannelTraceCache
+    {
+        ECollisionChannel Channel;
+        float TracedDistance;       // < 0 when this frame has no trace yet
+        float PeakRequestedDistance;
+        bool bHit;
+        FHitResult Hit;
+    };
+
+    // Deprojected ray for one controller + crosshair position
+    struct FCameraViewCache
+    {
+        TWeakObjectPtr<APlayerController> Controller;
+        FVector2D ScreenFraction;
+        uint64 FrameNumber;
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        FVector RayStart;
+        FVector RayDirection;
+        TArray<FChannelTraceCache, TInlineAllocator<2>> Channels;
+    };
+
+    FCameraViewCache& FindOrAddView(APlayerController* PC, const FVector2D& ScreenFraction);
+    bool IsViewCurrent(const FCameraViewCache& View, APlayerController* PC, ECameraTraceStaleness Staleness) const;
+    void ResolveView(FCameraViewCache& View, APlayerController* PC) const;
+    FChannelTraceCache& FindOrAddChannel(FCameraViewCache& View, ECollisionChannel Channel);
+    void RunTrace(const FCameraViewCache& View, APlayerController* PC, FChannelTraceCache& Entry, float Distance);
+
+    TArray<FCameraViewCache, TInlineAllocator<2>> Views;
+
+    uint32 TraceCount;
+    uint32 CacheHitCount;
+};
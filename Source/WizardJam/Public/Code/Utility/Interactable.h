@@ -9,6 +9,10 @@
 #include "UObject/Interface.h"
 #include "Interactable.generated.h"
 
+// Object channel for interactables; the interaction detection sphere overlaps
+// only this. Must match the "Interactable" channel in DefaultEngine.ini
+#define ECC_Interactable ECC_GameTraceChannel2
+
 UINTERFACE(MinimalAPI, Blueprintable)
 class UInteractable : public UInterface
 {
@@ -17,6 +21,8 @@ class UInteractable : public UInterface
 
 // Interface for actors that can be interacted with or display information
 // Usage: Implement on brooms, NPCs, doors, pickups, or any tooltip-enabled actor
+// Detection: give one collision component the "Interactable" profile (or the
+// ECC_Interactable object type with overlap events enabled)
 class WIZARDJAM_API IInteractable
 {
     GENERATED_BODY()
@@ -2,6 +2,15 @@
 // Component for player that detects and displays tooltips for interactable objects
 // Developer: Marcus Daley
 // Date: December 31, 2025
+//
+// Detection: a query-only sphere around the pawn collects IInteractable
+// actors as candidates through overlap events. While candidates exist the
+// component ticks, focuses the one closest to the crosshair (by view angle)
+// within InteractionTraceRange of the camera and confirms it with a single
+// occlusion trace to its bounds center. With no candidates in range the
+// component does not tick at all. The sphere only overlaps the Interactable
+// object channel, so interactables need a collision component with the
+// "Interactable" profile (see Interactable.h).
 
 #pragma once
 
@@ -11,6 +20,8 @@
 
 class IInteractable;
 class UTooltipWidget;
+class USphereComponent;
+class UPrimitiveComponent;
 // Broadcast when player looks at/away from interactable object
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractableTargeted, bool, bIsTargeting);
 
@@ -25,6 +36,7 @@ public:
     UInteractionComponent();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType,
         FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -35,10 +47,20 @@ public:
 protected:
     // Designer-configurable properties
 
-    // Maximum distance for interaction traces
+    // Maximum distance for interaction traces (from the camera)
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction Settings")
     float InteractionTraceRange;
 
+    // Radius of the detection sphere around the pawn that gathers candidates
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction Settings",
+        meta = (ClampMin = "1.0"))
+    float InteractionDetectionRadius;
+
+    // Largest angle off the crosshair a candidate can be focused at (degrees)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction Settings",
+        meta = (ClampMin = "1.0", ClampMax = "90.0"))
+    float MaxFocusAngle;
+
     // Widget class to spawn for tooltip display
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction Settings")
     TSubclassOf<UUserWidget> TooltipWidgetClass;
@@ -60,9 +82,35 @@ private:
     UPROPERTY()
     UUserWidget* TooltipWidgetInstance;
 
+    // Query-only sphere that feeds Candidates through overlap events
+    UPROPERTY()
+    USphereComponent* DetectionSphere;
+
+    // Interactables currently inside DetectionSphere
+    TArray<TWeakObjectPtr<AActor>> Candidates;
+
     // Helper functions
 
-    bool PerformInteractionTrace(FHitResult& OutHitResult);
+    void CreateDetectionSphere();
+    void AddCandidate(AActor* Actor);
+
+    // Tick only while candidates exist
+    void UpdateTickState();
+
+    UFUNCTION()
+    void OnDetectionBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnDetectionEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+    // Best candidate by view angle, confirmed by one occlusion trace
+    AActor* FindFocusCandidate();
+    bool IsCandidateVisible(const FVector& ViewOrigin, const FVector& FocusPoint, AActor* Candidate) const;
+
+    // Bounds center of the candidate's root - pivots sit at floor level on most pickups
+    static FVector GetFocusPoint(const AActor* Candidate);
     void UpdateFocusedActor(AActor* NewFocusedActor);
     void ShowTooltip(const FText& TooltipText, const FText& InteractionPrompt);
     void HideTooltip();
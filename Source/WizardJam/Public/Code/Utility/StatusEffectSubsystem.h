@@ -0,0 +1,220 @@
+// StatusEffectSubsystem.h
+// World subsystem managing elemental status effects in batched passes
+//
+// Developer: Marcus Daley
+// Date: January 8, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Spell hits apply status effects (Flame burn, Ice freeze, Lightning chain
+// shock, Arcane vulnerability) without adding a ticking component per actor.
+// Active effects live in parallel arrays (one row per target + element) and
+// are all updated in a single pass at UpdateInterval. Each target's rows are
+// chained from a per-target head index, so lookups never scan the table.
+// Results are written back in batches: one ApplyDamage per health component
+// and one speed write per movement component per pass.
+//
+// INTERACTIONS:
+// How an incoming element treats an existing one (Ice extinguishes Flame,
+// Flame melts Ice, Lightning shatters Ice) is a constexpr table indexed by
+// ESpellChannel - see ElementInteractionTable in the .cpp.
+//
+// USAGE:
+// 1. UStatusEffectSubsystem* Effects = GetWorld()->GetSubsystem<UStatusEffectSubsystem>();
+// 2. Effects->ApplyElementalEffect(Target, ESpellChannel::Flame, Instigator);
+// 3. Tuning lives in DefaultGame.ini under [/Script/WizardJam.StatusEffectSubsystem]
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Code/Utility/SpellChannelTypes.h"
+#include "StatusEffectSubsystem.generated.h"
+
+class UAC_HealthComponent;
+class UCharacterMovementComponent;
+
+// Broadcast when an effect is applied or removed (VFX, HUD icons)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
+    FOnStatusEffectChanged,
+    AActor*, Target,
+    ESpellChannel, Element,
+    bool, bActive
+);
+
+UCLASS(Config = Game)
+class WIZARDJAM_API UStatusEffectSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UStatusEffectSubsystem();
+
+    // ========================================================================
+    // SUBSYSTEM LIFECYCLE
+    // ========================================================================
+
+    virtual void Deinitialize() override;
+
+    // ========================================================================
+    // PUBLIC API
+    // ========================================================================
+
+    /**
+     * Apply an elemental status effect to a target
+     * Resolves interactions with effects already on the target first
+     * @param Target - Actor receiving the effect (needs AC_HealthComponent for damage)
+     * @param Element - Element of the hit
+     * @param EffectInstigator - Actor credited for effect damage
+     * @param Magnitude - Scales damage/slow strength (1.0 = default tuning)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ApplyElementalEffect(AActor* Target, ESpellChannel Element, AActor* EffectInstigator, float Magnitude = 1.0f);
+
+    // Remove every effect on a target and restore its movement speed
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ClearEffects(AActor* Target);
+
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    bool HasEffect(AActor* Target, ESpellChannel Element) const;
+
+    // Damage multiplier from Arcane vulnerability (1.0 when not debuffed)
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    float GetDamageTakenMultiplier(AActor* Target) const;
+
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    int32 GetActiveEffectCount() const { return Targets.Num(); }
+
+    // Maps projectile SpellElement names ("Flame", "Ice"...) to ESpellChannel
+    static ESpellChannel ElementNameToChannel(FName ElementName);
+
+    UPROPERTY(BlueprintAssignable, Category = "Status Effects|Events")
+    FOnStatusEffectChanged OnStatusEffectChanged;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ========================================================================
+    // CONFIGURATION (DefaultGame.ini)
+    // ========================================================================
+
+    // Seconds between batched update passes
+    UPROPERTY(Config)
+    float UpdateInterval;
+
+    UPROPERTY(Config)
+    float BurnDamagePerSecond;
+
+    UPROPERTY(Config)
+    float BurnDuration;
+
+    // Walk speed multiplier while frozen (0.5 = half speed)
+    UPROPERTY(Config)
+    float FreezeSpeedMultiplier;
+
+    UPROPERTY(Config)
+    float FreezeDuration;
+
+    // Damage dealt to each actor the shock chains to
+    UPROPERTY(Config)
+    float ShockChainDamage;
+
+    UPROPERTY(Config)
+    float ShockChainRadius;
+
+    UPROPERTY(Config)
+    int32 ShockChainMaxTargets;
+
+    // How long the shocked marker stays on the primary target
+    UPROPERTY(Config)
+    float ShockDuration;
+
+    // Extra magnitude when Lightning hits a frozen target
+    UPROPERTY(Config)
+    float ShatterMagnitudeMultiplier;
+
+    // Damage taken multiplier while Arcane vulnerability is active
+    UPROPERTY(Config)
+    float ArcaneDamageTakenMultiplier;
+
+    UPROPERTY(Config)
+    float ArcaneDuration;
+
+private:
+    // ========================================================================
+    // INTERNAL HELPERS
+    // ========================================================================
+
+    // Row index for target + element, INDEX_NONE if not active
+    int32 FindRow(const AActor* Target, ESpellChannel Element) const;
+
+    // Append a new row or refresh an existing one
+    void AddOrRefreshRow(AActor* Target, ESpellChannel Element, AActor* EffectInstigator, float Magnitude);
+
+    // Swap-remove a row from every array and broadcast removal
+    void RemoveRow(int32 RowIndex);
+
+    // Point whichever link references FromRow (target head or previous row) at ToRow
+    void RelinkRow(int32 FromRow, int32 ToRow);
+
+    float GetDurationFor(ESpellChannel Element) const;
+
+    // Chain shock damage to nearby actors with health (queued for next flush)
+    void ChainShock(AActor* PrimaryTarget, AActor* EffectInstigator, float Magnitude);
+
+    // Accumulate damage for the next batched flush
+    void QueueDamage(UAC_HealthComponent* HealthComp, float Amount, AActor* Causer);
+
+    // Start or stop the update timer based on pending work
+    void UpdateTimerState();
+
+    // Timer callback - one pass over every active effect
+    void ProcessEffects();
+
+    // Batched writes
+    void FlushPendingDamage();
+    void FlushSpeedMultipliers();
+
+    // ========================================================================
+    // EFFECT STORAGE (structure of arrays, one row per target + element)
+    // ========================================================================
+
+    TArray<TWeakObjectPtr<AActor>> Targets;
+    TArray<TWeakObjectPtr<AActor>> Instigators;
+    TArray<TWeakObjectPtr<UAC_HealthComponent>> HealthComponents;
+    TArray<TWeakObjectPtr<UCharacterMovementComponent>> MovementComponents;
+    TArray<ESpellChannel> Elements;
+    TArray<float> RemainingTimes;
+    TArray<float> Magnitudes;
+
+    // Key kept per row so a destroyed target's rows can still be unlinked
+    TArray<TObjectKey<AActor>> TargetKeys;
+
+    // Next row for the same target, INDEX_NONE at the end of the chain
+    TArray<int32> NextRowForTarget;
+
+    // First row of each target's chain (at most one row per element follows it)
+    TMap<TObjectKey<AActor>, int32> FirstRowByTarget;
+
+    // ========================================================================
+    // BATCHED WRITE STATE
+    // ========================================================================
+
+    struct FPendingDamage
+    {
+        float Amount;
+        TWeakObjectPtr<AActor> Causer;
+    };
+
+    // Damage accumulated this pass, applied once per health component
+    TMap<TWeakObjectPtr<UAC_HealthComponent>, FPendingDamage> PendingDamage;
+
+    // Walk speed before any slow, so it can be restored when the slow expires
+    TMap<TWeakObjectPtr<UCharacterMovementComponent>, float> SlowedBaseSpeeds;
+
+    // Strongest slow per movement component this pass (scratch, reused)
+    TMap<TWeakObjectPtr<UCharacterMovementComponent>, float> SpeedMultiplierScratch;
+
+    FTimerHandle UpdateTimerHandle;
+};
@@ -0,0 +1,111 @@
+// WizardJamCounters.h
+// Gameplay performance counters incremented from hot paths
+//
+// Developer: Marcus Daley
+// Date: January 14, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Cheap process-wide integer counters (live projectiles, traces, damage
+// events...) that gameplay code bumps through the WJ_COUNTER_* macros. An
+// increment is one inlined add into a static array - no subsystem lookup, no
+// lock, no allocation. UWizardJamStatsSubsystem rolls the per-frame counters
+// over once per frame and feeds the debug overlay and CSV capture.
+// Definitions live in WizardJamStatsSubsystem.cpp.
+//
+// Counters compile out entirely in Shipping (WIZARDJAM_COUNTERS_ENABLED == 0):
+// the macros expand to nothing and their arguments are not evaluated.
+//
+// Game thread only.
+//
+// USAGE:
+// #include "Code/Utility/WizardJamCounters.h"
+// WJ_COUNTER_INC(LiveProjectiles);
+// WJ_COUNTER_DEC(LiveProjectiles);
+// WJ_COUNTER_ADD(Traces, NumTraces);
+// WJ_COUNT_TICKING_AGENT(GetActorLocation());
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef WIZARDJAM_COUNTERS_ENABLED
+    #define WIZARDJAM_COUNTERS_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+// Keep in sync with FWizardJamCounters::GetName / IsPerFrame
+enum class EWizardJamCounter : uint8
+{
+    LiveProjectiles,        // Gauge - projectiles currently in the world
+    ProjectilesSpawned,     // Total - projectiles created with SpawnActor
+    ProjectilesPooled,      // Total - projectiles reused from a pool
+    AgentsTickingNear,      // Per frame - agents ticking inside NearAgentDistance
+    AgentsTickingMid,       // Per frame - agents ticking inside MidAgentDistance
+    AgentsTickingFar,       // Per frame - agents ticking beyond that
+    Traces,                 // Per frame - line traces and overlap queries
+    DamageEvents,           // Per frame - damage applied to health components
+    DelegateBroadcasts,     // Per frame - gameplay delegate broadcasts
+    MIDsCreated,            // Total - dynamic material instances created
+
+    Count
+};
+
+#if WIZARDJAM_COUNTERS_ENABLED
+
+struct WIZARDJAM_API FWizardJamCounters
+{
+    static constexpr int32 NumCounters = static_cast<int32>(EWizardJamCounter::Count);
+
+    // Agent LOD buckets by distance to the viewer (squared, world units)
+    static constexpr float NearAgentDistanceSq = 2000.0f * 2000.0f;
+    static constexpr float MidAgentDistanceSq = 6000.0f * 6000.0f;
+
+    // Live values (per-frame counters are zeroed by RollOverFrame)
+    static int32 Values[NumCounters];
+
+    // Per-frame counters as of the last completed frame
+    static int32 LastFrameValues[NumCounters];
+
+    // Viewer location used for agent buckets, set once per frame
+    static FVector ViewLocation;
+
+    FORCEINLINE static void Add(EWizardJamCounter Counter, int32 Amount)
+    {
+        Values[static_cast<int32>(Counter)] += Amount;
+    }
+
+    FORCEINLINE static void CountTickingAgent(const FVector& Location)
+    {
+        const float DistanceSq = FVector::DistSquared(Location, ViewLocation);
+        const EWizardJamCounter Bucket = DistanceSq <= NearAgentDistanceSq ? EWizardJamCounter::AgentsTickingNear
+            : DistanceSq <= MidAgentDistanceSq ? EWizardJamCounter::AgentsTickingMid
+            : EWizardJamCounter::AgentsTickingFar;
+        Add(Bucket, 1);
+    }
+
+    // Snapshot and zero the per-frame counters
+    // @return false if already rolled over this frame (GFrameCounter)
+    static bool RollOverFrame();
+
+    // Last completed frame for per-frame counters, current value otherwise
+    static int32 Get(EWizardJamCounter Counter);
+
+    static const TCHAR* GetName(EWizardJamCounter Counter);
+
+    // Per-frame counters reset every frame; the rest are gauges or totals
+    static bool IsPerFrame(EWizardJamCounter Counter);
+};
+
+#define WJ_COUNTER_ADD(Counter, Amount) FWizardJamCounters::Add(EWizardJamCounter::Counter, (Amount))
+#define WJ_COUNTER_INC(Counter) FWizardJamCounters::Add(EWizardJamCounter::Counter, 1)
+#define WJ_COUNTER_DEC(Counter) FWizardJamCounters::Add(EWizardJamCounter::Counter, -1)
+#define WJ_COUNT_TICKING_AGENT(Location) FWizardJamCounters::CountTickingAgent(Location)
+
+#else
+
+#define WJ_COUNTER_ADD(Counter, Amount)
+#define WJ_COUNTER_INC(Counter)
+#define WJ_COUNTER_DEC(Counter)
+#define WJ_COUNT_TICKING_AGENT(Location)
+
+#endif // WIZARDJAM_COUNTERS_ENABLED
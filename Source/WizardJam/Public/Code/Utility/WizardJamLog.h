@@ -0,0 +1,125 @@
+// WizardJamLog.h
+// Compile-time log gating and binary gameplay event ring buffer
+//
+// Developer: Marcus Daley
+// Date: January 15, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// 1. WIZARDJAM_LOG_COMPILETIME_VERBOSITY caps every gameplay log category.
+//    Test and Shipping builds strip everything below Warning, so the string
+//    formatting and argument evaluation (GetName() etc.) of Display/Log/Verbose
+//    lines does not exist in those binaries.
+// 2. FWizardJamEventLog replaces per-event Display logs on hot paths
+//    (projectile launch/hit, damage, spell pickup, flight toggle, agent attack,
+//    status effect applied, AoE detonation)
+//    with fixed-size binary records: event id, actor id/name, three floats.
+//    Recording is a struct copy into a static ring buffer - no formatting, no
+//    allocation. Dump the buffer on demand with Debug_DumpEvents or
+//    Debug_DumpEventsCSV. Definitions live in WizardJamLog.cpp.
+//
+// The event log compiles out in Shipping (WIZARDJAM_EVENTLOG_ENABLED == 0):
+// WJ_EVENT expands to nothing and its arguments are not evaluated.
+//
+// Game thread only.
+//
+// USAGE:
+// DECLARE_LOG_CATEGORY_EXTERN(LogMyThing, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+// DEFINE_LOG_CATEGORY_STATIC(LogMyThing, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+// WJ_EVENT(DamageTaken, GetOwner(), ActualDamage, CurrentHealth, MaxHealth);
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectBase.h"
+
+#ifndef WIZARDJAM_LOG_COMPILETIME_VERBOSITY
+    #if UE_BUILD_SHIPPING || UE_BUILD_TEST
+        #define WIZARDJAM_LOG_COMPILETIME_VERBOSITY Warning
+    #else
+        #define WIZARDJAM_LOG_COMPILETIME_VERBOSITY All
+    #endif
+#endif
+
+#ifndef WIZARDJAM_EVENTLOG_ENABLED
+    #define WIZARDJAM_EVENTLOG_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+// Keep in sync with FWizardJamEventLog::GetEventName / GetValueLabels
+enum class EWizardJamEvent : uint8
+{
+    ProjectileLaunched,     // Projectile   | Speed, OwnerId, -
+    ProjectileHit,          // Projectile   | HitActorId, ImpactX, ImpactY
+    ProjectileDamage,       // Projectile   | Damage, HitActorId, -
+    DamageTaken,            // Damaged actor| Damage, Health, MaxHealth
+    SpellAdded,             // Collector    | TotalSpells, -, -
+    FlightToggled,          // Flyer        | bFlying, Stamina, bDenied
+    AgentAttack,            // Agent        | TargetId, Damage, bProjectile
+    StatusEffectApplied,    // Target       | Element, Magnitude, Duration
+    AoEDetonated,           // Projectile   | Radius, Overlaps, Victims
+
+    Count
+};
+
+#if WIZARDJAM_EVENTLOG_ENABLED
+
+// Fixed size and trivially copyable - no heap data
+struct FWizardJamEventRecord
+{
+    double Time;            // FPlatformTime::Seconds
+    uint32 Frame;           // Low 32 bits of GFrameCounter
+    uint32 ActorId;         // UObject unique id (0 = none)
+    FName ActorName;        // Resolved to a string only when dumped
+    float Values[3];
+    EWizardJamEvent Event;
+};
+
+struct WIZARDJAM_API FWizardJamEventLog
+{
+    // Power of two so wrapping is a mask
+    static constexpr uint32 Capacity = 4096;
+
+    static FWizardJamEventRecord Records[Capacity];
+    static uint32 NumRecorded;
+
+    FORCEINLINE static void Record(EWizardJamEvent Event, const UObject* Object,
+        float A = 0.0f, float B = 0.0f, float C = 0.0f)
+    {
+        FWizardJamEventRecord& Entry = Records[NumRecorded++ & (Capacity - 1)];
+        Entry.Time = FPlatformTime::Seconds();
+        Entry.Frame = static_cast<uint32>(GFrameCounter);
+        Entry.ActorId = Object ? Object->GetUniqueID() : 0;
+        Entry.ActorName = Object ? Object->GetFName() : NAME_None;
+        Entry.Values[0] = A;
+        Entry.Values[1] = B;
+        Entry.Values[2] = C;
+        Entry.Event = Event;
+    }
+
+    // Object ids stored in float slots (exact up to 2^24 live objects)
+    FORCEINLINE static float IdOf(const UObject* Object)
+    {
+        return Object ? static_cast<float>(Object->GetUniqueID()) : 0.0f;
+    }
+
+    // Write the newest MaxEvents records (0 = all), oldest first
+    static void Dump(FOutputDevice& Ar, int32 MaxEvents = 0);
+
+    // Write the whole buffer as CSV (relative paths land in Saved/Logs)
+    static bool DumpToFile(const FString& FileName);
+
+    static void Reset();
+
+    static const TCHAR* GetEventName(EWizardJamEvent Event);
+    static const TCHAR* GetValueLabels(EWizardJamEvent Event);
+};
+
+#define WJ_EVENT(Event, Object, ...) FWizardJamEventLog::Record(EWizardJamEvent::Event, Object, ##__VA_ARGS__)
+#define WJ_EVENT_ID(Object) FWizardJamEventLog::IdOf(Object)
+
+#else
+
+#define WJ_EVENT(Event, Object, ...)
+#define WJ_EVENT_ID(Object) 0.0f
+
+#endif // WIZARDJAM_EVENTLOG_ENABLED
@@ -0,0 +1,212 @@
+// WizardJamMovementComponent.h
+// Character movement with a predicted broom flight custom mode
+//
+// Developer: Marcus Daley
+// Date: January 10, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Broom flight as a real CharacterMovementComponent custom mode instead of
+// MOVE_Flying plus velocity writes from a component tick. Flight request,
+// ascend, descend and boost ride in the saved-move compressed flags, so
+// clients predict flight and the server replays the same inputs without any
+// extra RPCs. Broom stamina is drained inside the simulated move by the move's
+// own DeltaTime and saved per move, so forced dismount happens at the same move
+// on both ends and replays reach the same result. Events and stamina component
+// updates only fire on live moves of the owning client or the server.
+//
+// STAMINA SYNC:
+// The stamina component is evaluated from local world time and not replicated,
+// so each move carries the stamina it starts from (FWizardJamNetworkMoveData).
+// Out of flight the server seeds from the client's value, capped at its own
+// pool plus BroomStaminaTolerance. Corrections send the server's pool back
+// (FWizardJamMoveResponseDataContainer) and the client rebases its unacked
+// moves and stamina component onto it, so both ends agree from then on.
+//
+// FLAG LAYOUT (FSavedMove_Character custom flags):
+// - FLAG_Custom_0 : Wants broom flight
+// - FLAG_Custom_1 : Ascend held
+// - FLAG_Custom_2 : Descend held
+// - FLAG_Custom_3 : Boost held
+//
+// USAGE:
+// 1. Character constructor: SetDefaultSubobjectClass<UWizardJamMovementComponent>
+//    (ABasePlayer does this)
+// 2. UAC_BroomComponent pushes tuning via ConfigureBroomFlight() and input
+//    intents via SetWantsBroomFlight/Ascend/Descend/Boost
+// 3. Bind OnBroomStaminaExhausted for forced dismount feedback
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Code/Utility/WizardJamLog.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "WizardJamMovementComponent.generated.h"
+
+class UAC_StaminaComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogWizardJamMovement, Log, WIZARDJAM_LOG_COMPILETIME_VERBOSITY);
+
+// Custom movement modes used with MOVE_Custom
+UENUM(BlueprintType)
+enum class EWizardJamMovementMode : uint8
+{
+    None    UMETA(Hidden),
+    Broom   UMETA(DisplayName = "Broom Flight")
+};
+
+// Fired when a simulated move ends broom flight because stamina ran low
+DECLARE_MULTICAST_DELEGATE(FOnBroomStaminaExhausted);
+
+// Sent with every move: the broom stamina the move starts from
+struct WIZARDJAM_API FWizardJamNetworkMoveData : public FCharacterNetworkMoveData
+{
+    float BroomStamina = 0.0f;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap,
+        ENetworkMoveType MoveType) override;
+};
+
+struct WIZARDJAM_API FWizardJamNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FWizardJamNetworkMoveDataContainer()
+    {
+        NewMoveData = &MoveData[0];
+        PendingMoveData = &MoveData[1];
+        OldMoveData = &MoveData[2];
+    }
+
+    FWizardJamNetworkMoveData MoveData[3];
+};
+
+// Corrections also carry the server's broom stamina after the corrected move
+struct WIZARDJAM_API FWizardJamMoveResponseDataContainer : public FCharacterMoveResponseDataContainer
+{
+    float BroomStamina = 0.0f;
+
+    virtual void ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement,
+        const FClientAdjustment& PendingAdjustment) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+};
+
+UCLASS()
+class WIZARDJAM_API UWizardJamMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    UWizardJamMovementComponent();
+
+    // ========================================================================
+    // BROOM FLIGHT API
+    // ========================================================================
+
+    // Tuning comes from the broom component so designers keep one place to edit
+    void ConfigureBroomFlight(float InFlySpeed, float InBoostSpeed, float InVerticalSpeed,
+        float InDrainRate, float InBoostDrainRate, float InMinStamina);
+
+    // Input intents - applied in the next move and replicated via compressed flags
+    void SetWantsBroomFlight(bool bWants) { bWantsBroomFlight = bWants; }
+    void SetWantsToAscend(bool bWants) { bWantsToAscend = bWants; }
+    void SetWantsToDescend(bool bWants) { bWantsToDescend = bWants; }
+    void SetWantsToBoost(bool bWants) { bWantsToBoost = bWants; }
+
+    UFUNCTION(BlueprintPure, Category = "Movement|Broom")
+    bool IsBroomFlying() const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement|Broom")
+    bool IsBroomBoosting() const { return bWantsToBoost && IsBroomFlying(); }
+
+    // Predicted pool the current move drains (what moves and corrections carry)
+    float GetBroomStamina() const { return BroomStamina; }
+
+    FOnBroomStaminaExhausted OnBroomStaminaExhausted;
+
+    // ========================================================================
+    // UCharacterMovementComponent OVERRIDES
+    // ========================================================================
+
+    virtual float GetMaxSpeed() const override;
+    virtual float GetMaxBrakingDeceleration() const override;
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+    virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+
+    // Saved move reads intents directly
+    friend class FSavedMove_WizardJam;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+    virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+    virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+
+    // Broom flight physics - horizontal from input, vertical from flags
+    void PhysBroom(float DeltaTime, int32 Iterations);
+
+    // Stamina checks and drain, run inside the simulated move
+    bool HasBroomStamina() const;
+    void UpdateBroomStaminaDrain(float DeltaTime);
+
+    // Pool a new move starts from: the predicted value in flight, the stamina
+    // component otherwise
+    float GetBroomStaminaAtMoveStart() const;
+
+    // False for replayed moves and simulated proxies
+    bool ShouldApplyBroomSideEffects() const;
+
+    // Client: move unacked saved moves and the stamina component onto the
+    // server's pool after the move corrected at CorrectionTimeStamp
+    void ApplyBroomStaminaCorrection(float ServerStamina, float CorrectionTimeStamp);
+
+    // ========================================================================
+    // CONFIGURATION
+    // ========================================================================
+
+    // Velocity friction while flying the broom (higher = snappier stops)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Broom", meta = (ClampMin = "0.0"))
+    float BroomFriction;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomFlySpeed;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomBoostSpeed;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomVerticalSpeed;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomStaminaDrainRate;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomBoostStaminaDrainRate;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|Broom")
+    float BroomMinStamina;
+
+    // How far a client's move-start stamina may exceed the server's pool and
+    // still be accepted; covers the two clocks evaluating regen a little apart
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Broom", meta = (ClampMin = "0.0"))
+    float BroomStaminaTolerance;
+
+    // ========================================================================
+    // INPUT INTENT STATE (packed into compressed flags)
+    // ========================================================================
+
+    uint8 bWantsBroomFlight : 1;
+    uint8 bWantsToAscend : 1;
+    uint8 bWantsToDescend : 1;
+    uint8 bWantsToBoost : 1;
+
+    // Predicted stamina while flying; saved and restored per move
+    float BroomStamina;
+
+private:
+    UPROPERTY()
+    UAC_StaminaComponent* StaminaComponent;
+
+    FWizardJamNetworkMoveDataContainer MoveDataContainer;
+    FWizardJamMoveResponseDataContainer MoveResponseDataContainer;
+};
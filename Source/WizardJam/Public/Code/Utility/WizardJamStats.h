@@ -0,0 +1,38 @@
+// WizardJamStats.h
+// Stat group, Insights trace channel and CSV category for gameplay code
+//
+// Developer: Marcus Daley
+// Date: January 15, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// One place for the profiling hooks every gameplay system shares:
+// - STATGROUP_WizardJam      : "stat WizardJam" in the viewport
+// - WizardJamChannel         : Insights CPU scopes, -trace=cpu,WizardJam
+// - CSV category "WizardJam" : one row per frame of gameplay counters under
+//                              -csvprofile (written by UWizardJamStatsSubsystem)
+// Channel and category are defined in WizardJam.cpp.
+//
+// USAGE:
+// 1. DECLARE_CYCLE_STAT(TEXT("Fire Projectile"), STAT_WizardJam_FireProjectile, STATGROUP_WizardJam);
+//    at the top of the .cpp
+// 2. WIZARDJAM_SCOPE_CYCLE_COUNTER(STAT_WizardJam_FireProjectile); at the top of the function
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("WizardJam"), STATGROUP_WizardJam, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(WizardJamChannel, WIZARDJAM_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(WIZARDJAM_API, WizardJam);
+
+// Cycle counter for "stat WizardJam" plus a named CPU scope on WizardJamChannel
+#define WIZARDJAM_SCOPE_CYCLE_COUNTER(Stat) \
+    SCOPE_CYCLE_COUNTER(Stat); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, WizardJamChannel)
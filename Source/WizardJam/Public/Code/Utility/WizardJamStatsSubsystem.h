@@ -0,0 +1,91 @@
+// WizardJamStatsSubsystem.h
+// Frame rollover, overlay access and CSV capture for gameplay counters
+//
+// Developer: Marcus Daley
+// Date: January 14, 2026
+// Project: WizardJam
+//
+// PURPOSE:
+// Gameplay code increments FWizardJamCounters (see WizardJamCounters.h).
+// Once per frame this subsystem snapshots the per-frame counters, zeroes
+// them for the next frame, and updates the viewer location used for agent
+// LOD buckets. The debug overlay (UWizardJamPerfOverlayWidget) reads the
+// snapshot; CSV capture appends one row per sample interval with the latest
+// gauges/totals and the peak per-frame values seen since the previous row.
+//
+// HEADLESS CAPTURE:
+// Launch with -WizardJamCountersCSV=<file> (relative paths land in
+// Saved/Profiling) to capture from the first frame, e.g. on a dedicated
+// server or -nullrhi automation run. StartCSVCapture / StopCSVCapture do the
+// same at runtime. Under -csvprofile the same counters are also recorded
+// every frame in the "WizardJam" CSV category (see WizardJamStats.h).
+//
+// Counters are process-wide; with several PIE worlds only the first
+// subsystem to tick each frame rolls them over and sets the viewer.
+// Does nothing in Shipping.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Code/Utility/WizardJamCounters.h"
+#include "WizardJamStatsSubsystem.generated.h"
+
+UCLASS(Config = Game)
+class WIZARDJAM_API UWizardJamStatsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UWizardJamStatsSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ========================================================================
+    // COUNTER ACCESS
+    // ========================================================================
+
+    // Last completed frame for per-frame counters, current value otherwise
+    int32 GetCounter(EWizardJamCounter Counter) const;
+
+    // ========================================================================
+    // CSV CAPTURE
+    // ========================================================================
+
+    // Open FileName (relative to Saved/Profiling) and append a row every CsvSampleInterval
+    UFUNCTION(BlueprintCallable, Category = "Debug|Counters")
+    bool StartCSVCapture(const FString& FileName);
+
+    UFUNCTION(BlueprintCallable, Category = "Debug|Counters")
+    void StopCSVCapture();
+
+    UFUNCTION(BlueprintPure, Category = "Debug|Counters")
+    bool IsCapturingCSV() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // Seconds between CSV rows (0 = every frame)
+    UPROPERTY(Config)
+    float CsvSampleInterval;
+
+private:
+    // Only defined when WIZARDJAM_COUNTERS_ENABLED
+    void UpdateViewLocation();
+    void RecordCsvProfilerStats();
+    void WriteCSVRow();
+    void WriteCSVLine(const FString& Line);
+
+    // Highest per-frame value since the last CSV row
+    int32 WindowPeakValues[static_cast<int32>(EWizardJamCounter::Count)];
+
+    TUniquePtr<IFileHandle> CsvFile;
+    double CsvStartTime;
+    double NextCsvSampleTime;
+};
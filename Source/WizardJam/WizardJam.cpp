@@ -2,5 +2,10 @@
 
 #include "WizardJam.h"
 #include "Modules/ModuleManager.h"
+#include "Code/Utility/WizardJamStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(WizardJamChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(WIZARDJAM_API, WizardJam, true);
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, WizardJam, "WizardJam" );